@@ -1,6 +1,27 @@
+// Chained hash table with int keys (insert/search/delete/display), plus
+// ConcurrentMap: a thread-safe map for read-heavy use with lock-free
+// optimistic reads (per-segment seqlocks), striped write locks, and segment
+// growth that arriving writers help migrate; StringMap: a string-keyed
+// table with an interned key arena and cached 64-bit hashes; and
+// PerfectHash/StaticTable: a PTHash-style minimal perfect hash for read-only
+// key sets, searched with one probe and loadable from a file with mmap.
+//
+// Compile with: gcc -O2 -pthread HashTableExample.c -o HashTableExample
+
 #include <stdio.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #define TABLE_SIZE 10
 
@@ -24,7 +45,7 @@ void insert(int key, const char* value) {
     int index = hashFunction(key);
     Node* newNode = (Node*)malloc(sizeof(Node));
     newNode->key = key;
-    strcpy(newNode->value, value);
+    snprintf(newNode->value, sizeof(newNode->value), "%s", value);
     newNode->next = hashTable[index];
     hashTable[index] = newNode;
 }
@@ -81,6 +102,2052 @@ void display() {
     }
 }
 
+// ---------------------------------------------------------------------------
+// ConcurrentMap
+// ---------------------------------------------------------------------------
+//
+// The key space is split into segments by the top bits of a 64-bit hash.
+// Each segment is its own open-addressing table (linear probing, one 64-byte
+// slot per entry with the value stored inline) guarded by its own lock:
+//
+//   - Writers take the segment lock, so writers to different segments never
+//     contend, and bracket each change with the segment's sequence counter
+//     (odd while a change is in progress).
+//   - Readers take no lock. They read the counter, probe, copy the value out
+//     and re-read the counter, retrying if a writer got in between. Slots
+//     hold no pointers, so a racing read can only produce a bad copy that the
+//     counter check throws away. After CMAP_OPTIMISTIC_TRIES failed attempts
+//     a reader takes the lock instead, so it cannot starve.
+//   - Growing a segment builds the new table off to the side. Readers keep
+//     using the old one, which does not change while the owner holds the
+//     lock. Writers that arrive meanwhile claim chunks of buckets and copy
+//     them instead of just waiting. A replaced table stays allocated until
+//     the map is freed, because a reader may still be probing it. Tables
+//     double, so the replaced ones add up to less than the live tables.
+//   - When tombstones rather than live entries fill a segment, it is purged
+//     in place inside one write section instead of being replaced, so
+//     put/remove churn never retires a table.
+
+#define CACHE_LINE 64
+#define SPIN_BEFORE_YIELD 64
+#define CMAP_VALUE_WORDS 7
+#define CMAP_VALUE_LENGTH (CMAP_VALUE_WORDS * 8)   // including the terminator
+#define CMAP_MIN_SEGMENT_CAPACITY 16
+#define CMAP_OPTIMISTIC_TRIES 16
+#define CMAP_MIGRATE_CHUNK 256
+
+enum { CMAP_EMPTY, CMAP_FULL, CMAP_DELETED };
+
+typedef struct {
+    _Atomic uint32_t state;
+    _Atomic int32_t key;
+    _Atomic uint64_t value[CMAP_VALUE_WORDS];
+} CMapSlot;
+
+typedef struct CMapTable {
+    size_t mask;
+    CMapSlot* slots;
+    struct CMapTable* retired;  // tables this one replaced
+} CMapTable;
+
+typedef struct {
+    _Alignas(CACHE_LINE) _Atomic unsigned sequence;
+    pthread_mutex_t lock;
+    CMapTable* _Atomic table;
+    _Atomic size_t count;       // live entries
+    size_t used;                // live entries plus tombstones
+
+    // growth in progress; kept inline so a late helper never touches freed memory
+    atomic_bool migrating;
+    _Atomic int helpers;
+    CMapTable* migrateFrom;
+    CMapTable* migrateTo;
+    _Atomic size_t nextChunk;
+    _Atomic size_t doneChunks;
+    size_t chunkCount;
+} CMapSegment;
+
+typedef struct {
+    CMapSegment* segments;
+    size_t segmentCount;
+    unsigned segmentShift;      // 64 - log2(segmentCount)
+} ConcurrentMap;
+
+// round n up to the next power of two (minimum 2)
+static size_t nextPowerOfTwo(size_t n) {
+    size_t p = 2;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+// allocate zeroed memory aligned to a cache line
+static void* allocAligned(size_t bytes) {
+    size_t rounded = (bytes + CACHE_LINE - 1) & ~(size_t)(CACHE_LINE - 1);
+    void* p = aligned_alloc(CACHE_LINE, rounded);
+    if (p) {
+        memset(p, 0, rounded);
+    }
+    return p;
+}
+
+// spin briefly, then give the core away (keeps single-core machines moving)
+static void backoff(unsigned* spins) {
+    if (++*spins >= SPIN_BEFORE_YIELD) {
+        *spins = 0;
+        sched_yield();
+    }
+}
+
+// 64-bit finalizer: segment from the top bits, slot from the bottom bits
+static inline uint64_t cmapHash(int key) {
+    uint64_t h = (uint64_t)(uint32_t)key * 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 32;
+    h *= 0xd6e8feb86659fd93ULL;
+    h ^= h >> 32;
+    return h;
+}
+
+static CMapTable* createTable(size_t capacity) {
+    CMapTable* t = (CMapTable*)malloc(sizeof(CMapTable));
+    t->slots = (CMapSlot*)allocAligned(capacity * sizeof(CMapSlot));
+    if (!t->slots) {
+        free(t);
+        return NULL;
+    }
+    t->mask = capacity - 1;
+    t->retired = NULL;
+    return t;
+}
+
+ConcurrentMap* createConcurrentMap(size_t expectedEntries, size_t segmentCount) {
+    ConcurrentMap* map = (ConcurrentMap*)malloc(sizeof(ConcurrentMap));
+    map->segmentCount = nextPowerOfTwo(segmentCount);
+    map->segmentShift = 64 - (unsigned)__builtin_ctzll(map->segmentCount);
+    map->segments = (CMapSegment*)allocAligned(map->segmentCount * sizeof(CMapSegment));
+    if (!map->segments) {
+        printf("Memory allocation failed!\n");
+        free(map);
+        return NULL;
+    }
+
+    // size each segment for a load factor of at most 1/2 at the expected count
+    size_t perSegment = nextPowerOfTwo(2 * expectedEntries / map->segmentCount + 1);
+    if (perSegment < CMAP_MIN_SEGMENT_CAPACITY) {
+        perSegment = CMAP_MIN_SEGMENT_CAPACITY;
+    }
+    for (size_t i = 0; i < map->segmentCount; i++) {
+        CMapSegment* s = &map->segments[i];
+        pthread_mutex_init(&s->lock, NULL);
+        atomic_init(&s->table, createTable(perSegment));
+    }
+    return map;
+}
+
+static inline CMapSegment* segmentFor(ConcurrentMap* map, uint64_t hash) {
+    return &map->segments[hash >> map->segmentShift];
+}
+
+static void storeValue(CMapSlot* slot, const char* value) {
+    uint64_t words[CMAP_VALUE_WORDS] = {0};
+    size_t length = strnlen(value, CMAP_VALUE_LENGTH - 1);
+    memcpy(words, value, length);
+    for (int w = 0; w < CMAP_VALUE_WORDS; w++) {
+        atomic_store_explicit(&slot->value[w], words[w], memory_order_relaxed);
+    }
+}
+
+static void loadValue(CMapSlot* slot, uint64_t* words) {
+    for (int w = 0; w < CMAP_VALUE_WORDS; w++) {
+        words[w] = atomic_load_explicit(&slot->value[w], memory_order_relaxed);
+    }
+}
+
+// probe for key; returns the slot or NULL, copying the value into words
+static CMapSlot* probe(CMapTable* t, int key, uint64_t hash, uint64_t* words) {
+    size_t i = hash & t->mask;
+    for (size_t n = 0; n <= t->mask; n++, i = (i + 1) & t->mask) {
+        CMapSlot* slot = &t->slots[i];
+        uint32_t state = atomic_load_explicit(&slot->state, memory_order_relaxed);
+        if (state == CMAP_EMPTY) {
+            return NULL;
+        }
+        if (state == CMAP_FULL && atomic_load_explicit(&slot->key, memory_order_relaxed) == key) {
+            if (words) {
+                loadValue(slot, words);
+            }
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static void writeBegin(CMapSegment* s) {
+    unsigned seq = atomic_load_explicit(&s->sequence, memory_order_relaxed);
+    atomic_store_explicit(&s->sequence, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void writeEnd(CMapSegment* s) {
+    unsigned seq = atomic_load_explicit(&s->sequence, memory_order_relaxed);
+    atomic_store_explicit(&s->sequence, seq + 1, memory_order_release);
+}
+
+// copy claimed chunks of migrateFrom into migrateTo (owner and helpers)
+static void migrateChunks(CMapSegment* s) {
+    CMapTable* from = s->migrateFrom;
+    CMapTable* to = s->migrateTo;
+    size_t chunk;
+    while ((chunk = atomic_fetch_add(&s->nextChunk, 1)) < s->chunkCount) {
+        size_t begin = chunk * CMAP_MIGRATE_CHUNK;
+        size_t end = begin + CMAP_MIGRATE_CHUNK <= from->mask + 1 ? begin + CMAP_MIGRATE_CHUNK : from->mask + 1;
+        for (size_t i = begin; i < end; i++) {
+            CMapSlot* src = &from->slots[i];
+            if (atomic_load_explicit(&src->state, memory_order_relaxed) != CMAP_FULL) {
+                continue;
+            }
+            int key = atomic_load_explicit(&src->key, memory_order_relaxed);
+            size_t j = cmapHash(key) & to->mask;
+            for (;;) {
+                uint32_t expected = CMAP_EMPTY;
+                if (atomic_compare_exchange_strong(&to->slots[j].state, &expected, CMAP_FULL)) {
+                    break;
+                }
+                j = (j + 1) & to->mask;
+            }
+            atomic_store_explicit(&to->slots[j].key, key, memory_order_relaxed);
+            for (int w = 0; w < CMAP_VALUE_WORDS; w++) {
+                atomic_store_explicit(&to->slots[j].value[w],
+                                      atomic_load_explicit(&src->value[w], memory_order_relaxed),
+                                      memory_order_relaxed);
+            }
+        }
+        atomic_fetch_add_explicit(&s->doneChunks, 1, memory_order_release);
+    }
+}
+
+// lock a segment; while its owner is growing it, help with the copy first
+static void lockSegment(CMapSegment* s) {
+    if (pthread_mutex_trylock(&s->lock) == 0) {
+        return;
+    }
+    if (atomic_load_explicit(&s->migrating, memory_order_acquire)) {
+        atomic_fetch_add(&s->helpers, 1);
+        if (atomic_load(&s->migrating)) {
+            migrateChunks(s);
+        }
+        atomic_fetch_sub(&s->helpers, 1);
+    }
+    pthread_mutex_lock(&s->lock);
+}
+
+// drop tombstones by reinserting the live entries into the same slots; one
+// write section covers it, so optimistic readers just retry
+static bool purgeSegment(CMapSegment* s) {
+    CMapTable* t = atomic_load_explicit(&s->table, memory_order_relaxed);
+    size_t live = atomic_load_explicit(&s->count, memory_order_relaxed);
+    int* keys = (int*)malloc((live + 1) * sizeof(int));
+    uint64_t* values = (uint64_t*)malloc((live + 1) * sizeof(uint64_t) * CMAP_VALUE_WORDS);
+    if (!keys || !values) {
+        free(keys);
+        free(values);
+        return false;
+    }
+
+    writeBegin(s);
+    size_t n = 0;
+    for (size_t i = 0; i <= t->mask; i++) {
+        CMapSlot* slot = &t->slots[i];
+        if (atomic_load_explicit(&slot->state, memory_order_relaxed) == CMAP_FULL) {
+            keys[n] = atomic_load_explicit(&slot->key, memory_order_relaxed);
+            loadValue(slot, &values[n * CMAP_VALUE_WORDS]);
+            n++;
+        }
+        atomic_store_explicit(&slot->state, CMAP_EMPTY, memory_order_relaxed);
+    }
+    for (size_t e = 0; e < n; e++) {
+        size_t j = cmapHash(keys[e]) & t->mask;
+        while (atomic_load_explicit(&t->slots[j].state, memory_order_relaxed) == CMAP_FULL) {
+            j = (j + 1) & t->mask;
+        }
+        CMapSlot* slot = &t->slots[j];
+        atomic_store_explicit(&slot->key, keys[e], memory_order_relaxed);
+        for (int w = 0; w < CMAP_VALUE_WORDS; w++) {
+            atomic_store_explicit(&slot->value[w], values[e * CMAP_VALUE_WORDS + w], memory_order_relaxed);
+        }
+        atomic_store_explicit(&slot->state, CMAP_FULL, memory_order_relaxed);
+    }
+    writeEnd(s);
+
+    s->used = n;
+    free(keys);
+    free(values);
+    return true;
+}
+
+// rebuild into a table twice as large, or purge in place if tombstones
+// caused the pressure; the caller holds the segment lock
+static bool growSegment(CMapSegment* s) {
+    CMapTable* from = atomic_load_explicit(&s->table, memory_order_relaxed);
+    if (atomic_load_explicit(&s->count, memory_order_relaxed) * 4 < from->mask + 1) {
+        return purgeSegment(s);
+    }
+    CMapTable* to = createTable(2 * (from->mask + 1));
+    if (!to) {
+        return false;
+    }
+
+    s->migrateFrom = from;
+    s->migrateTo = to;
+    s->chunkCount = (from->mask + CMAP_MIGRATE_CHUNK) / CMAP_MIGRATE_CHUNK;
+    atomic_store(&s->nextChunk, 0);
+    atomic_store(&s->doneChunks, 0);
+    atomic_store_explicit(&s->migrating, true, memory_order_release);
+
+    migrateChunks(s);
+    unsigned spins = 0;
+    while (atomic_load_explicit(&s->doneChunks, memory_order_acquire) < s->chunkCount) {
+        backoff(&spins);
+    }
+    atomic_store(&s->migrating, false);
+    while (atomic_load(&s->helpers) > 0) {
+        backoff(&spins);
+    }
+
+    to->retired = from;
+    atomic_store_explicit(&s->table, to, memory_order_release);
+    s->used = atomic_load_explicit(&s->count, memory_order_relaxed);
+    return true;
+}
+
+// copy the value for key into out; returns false if absent
+bool cmapGet(ConcurrentMap* map, int key, char* out, size_t outSize) {
+    uint64_t hash = cmapHash(key);
+    CMapSegment* s = segmentFor(map, hash);
+    uint64_t words[CMAP_VALUE_WORDS];
+    bool found = false;
+    bool consistent = false;
+
+    for (int attempt = 0; attempt < CMAP_OPTIMISTIC_TRIES && !consistent; attempt++) {
+        unsigned before = atomic_load_explicit(&s->sequence, memory_order_acquire);
+        if (before & 1) {
+            sched_yield();
+            continue;
+        }
+        CMapTable* t = atomic_load_explicit(&s->table, memory_order_acquire);
+        found = probe(t, key, hash, words) != NULL;
+        atomic_thread_fence(memory_order_acquire);
+        consistent = atomic_load_explicit(&s->sequence, memory_order_relaxed) == before;
+    }
+    if (!consistent) {
+        lockSegment(s);
+        found = probe(atomic_load_explicit(&s->table, memory_order_relaxed), key, hash, words) != NULL;
+        pthread_mutex_unlock(&s->lock);
+    }
+
+    if (found && out && outSize > 0) {
+        size_t length = strnlen((const char*)words, CMAP_VALUE_LENGTH - 1);
+        if (length >= outSize) {
+            length = outSize - 1;
+        }
+        memcpy(out, words, length);
+        out[length] = '\0';
+    }
+    return found;
+}
+
+// insert or replace; values longer than CMAP_VALUE_LENGTH - 1 are truncated.
+// Returns true if the key was new.
+bool cmapPut(ConcurrentMap* map, int key, const char* value) {
+    uint64_t hash = cmapHash(key);
+    CMapSegment* s = segmentFor(map, hash);
+    lockSegment(s);
+
+    CMapTable* t = atomic_load_explicit(&s->table, memory_order_relaxed);
+    CMapSlot* slot = probe(t, key, hash, NULL);
+    if (slot) {
+        writeBegin(s);
+        storeValue(slot, value);
+        writeEnd(s);
+        pthread_mutex_unlock(&s->lock);
+        return false;
+    }
+
+    if ((s->used + 1) * 4 > (t->mask + 1) * 3) {
+        if (!growSegment(s)) {
+            printf("Memory allocation failed!\n");
+            pthread_mutex_unlock(&s->lock);
+            return false;
+        }
+        t = atomic_load_explicit(&s->table, memory_order_relaxed);
+    }
+
+    // first tombstone or empty slot on the probe path
+    size_t i = hash & t->mask;
+    while (atomic_load_explicit(&t->slots[i].state, memory_order_relaxed) == CMAP_FULL) {
+        i = (i + 1) & t->mask;
+    }
+    slot = &t->slots[i];
+    bool reused = atomic_load_explicit(&slot->state, memory_order_relaxed) == CMAP_DELETED;
+
+    writeBegin(s);
+    atomic_store_explicit(&slot->key, key, memory_order_relaxed);
+    storeValue(slot, value);
+    atomic_store_explicit(&slot->state, CMAP_FULL, memory_order_relaxed);
+    writeEnd(s);
+
+    if (!reused) {
+        s->used++;
+    }
+    atomic_fetch_add_explicit(&s->count, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&s->lock);
+    return true;
+}
+
+// returns true if the key was present
+bool cmapRemove(ConcurrentMap* map, int key) {
+    uint64_t hash = cmapHash(key);
+    CMapSegment* s = segmentFor(map, hash);
+    lockSegment(s);
+
+    CMapSlot* slot = probe(atomic_load_explicit(&s->table, memory_order_relaxed), key, hash, NULL);
+    if (slot) {
+        writeBegin(s);
+        atomic_store_explicit(&slot->state, CMAP_DELETED, memory_order_relaxed);
+        writeEnd(s);
+        atomic_fetch_sub_explicit(&s->count, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return slot != NULL;
+}
+
+size_t cmapSize(ConcurrentMap* map) {
+    size_t total = 0;
+    for (size_t i = 0; i < map->segmentCount; i++) {
+        total += atomic_load_explicit(&map->segments[i].count, memory_order_relaxed);
+    }
+    return total;
+}
+
+void freeConcurrentMap(ConcurrentMap* map) {
+    if (!map) {
+        return;
+    }
+    for (size_t i = 0; i < map->segmentCount; i++) {
+        CMapTable* t = atomic_load_explicit(&map->segments[i].table, memory_order_relaxed);
+        while (t) {
+            CMapTable* older = t->retired;
+            free(t->slots);
+            free(t);
+            t = older;
+        }
+        pthread_mutex_destroy(&map->segments[i].lock);
+    }
+    free(map->segments);
+    free(map);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: ConcurrentMap vs the same table behind one global lock
+// ---------------------------------------------------------------------------
+
+#define BENCH_KEY_SPACE (1 << 17)
+
+typedef struct {
+    ConcurrentMap* map;
+    pthread_mutex_t* globalLock;    // non-NULL: every call goes through it
+    int readPercent;
+    unsigned seed;
+    atomic_bool* stop;
+    long operations;
+    long badReads;
+} MapWorker;
+
+// values always start with "k<key>:", so a read can check it got its own key's value
+static void* mapWorker(void* arg) {
+    MapWorker* w = (MapWorker*)arg;
+    char value[CMAP_VALUE_LENGTH];
+    char expected[16];
+    long ops = 0;
+    while (!atomic_load_explicit(w->stop, memory_order_relaxed)) {
+        for (int batch = 0; batch < 64; batch++) {
+            int key = rand_r(&w->seed) % BENCH_KEY_SPACE;
+            int roll = rand_r(&w->seed) % 100;
+            if (w->globalLock) {
+                pthread_mutex_lock(w->globalLock);
+            }
+            if (roll < w->readPercent) {
+                if (cmapGet(w->map, key, value, sizeof(value))) {
+                    int length = snprintf(expected, sizeof(expected), "k%d:", key);
+                    w->badReads += strncmp(value, expected, length) != 0;
+                }
+            } else if (roll % 2) {
+                snprintf(value, sizeof(value), "k%d:%ld", key, ops);
+                cmapPut(w->map, key, value);
+            } else {
+                cmapRemove(w->map, key);
+            }
+            if (w->globalLock) {
+                pthread_mutex_unlock(w->globalLock);
+            }
+            ops++;
+        }
+    }
+    w->operations = ops;
+    return NULL;
+}
+
+static double runMapBenchmark(int threads, int readPercent, bool globalLock, double seconds, long* badReads) {
+    ConcurrentMap* map = createConcurrentMap(BENCH_KEY_SPACE / 2, globalLock ? 2 : 256);
+    char value[32];
+    for (int key = 0; key < BENCH_KEY_SPACE; key += 2) {
+        snprintf(value, sizeof(value), "k%d:init", key);
+        cmapPut(map, key, value);
+    }
+
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    atomic_bool stop = false;
+    MapWorker* workers = (MapWorker*)calloc(threads, sizeof(MapWorker));
+    pthread_t* ids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        workers[t] = (MapWorker){ map, globalLock ? &lock : NULL, readPercent, 1234u + t, &stop, 0, 0 };
+        pthread_create(&ids[t], NULL, mapWorker, &workers[t]);
+    }
+    struct timespec pause = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+    nanosleep(&pause, NULL);
+    atomic_store(&stop, true);
+
+    long total = 0;
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+        total += workers[t].operations;
+        *badReads += workers[t].badReads;
+    }
+    free(workers);
+    free(ids);
+    freeConcurrentMap(map);
+    return total / seconds / 1e6;
+}
+
+void benchmarkConcurrentMap(void) {
+    int threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+    int mixes[] = {90, 50};
+    long badReads = 0;
+    printf("%d keys (half present), %ld CPU(s); million operations per second\n",
+           BENCH_KEY_SPACE, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-8s %-10s %-14s %-14s %-8s\n", "Threads", "Reads", "Global lock", "ConcurrentMap", "Speedup");
+    for (int m = 0; m < 2; m++) {
+        for (int i = 0; i < 7; i++) {
+            double locked = runMapBenchmark(threadCounts[i], mixes[m], true, 0.2, &badReads);
+            double striped = runMapBenchmark(threadCounts[i], mixes[m], false, 0.2, &badReads);
+            printf("%-8d %-10d %-14.2f %-14.2f %.2fx\n", threadCounts[i], mixes[m], locked, striped, striped / locked);
+        }
+    }
+    printf("Reads that returned another key's value: %ld\n", badReads);
+}
+
+// grow from a tiny map with several writer threads; check nothing is lost
+static void* growthWriter(void* arg) {
+    MapWorker* w = (MapWorker*)arg;
+    char value[32];
+    for (int key = (int)w->seed; key < 200000; key += w->readPercent) {
+        snprintf(value, sizeof(value), "k%d:", key);
+        cmapPut(w->map, key, value);
+    }
+    return NULL;
+}
+
+void verifyConcurrentGrowth(int threads) {
+    ConcurrentMap* map = createConcurrentMap(16, 4);
+    MapWorker* workers = (MapWorker*)calloc(threads, sizeof(MapWorker));
+    pthread_t* ids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        workers[t].map = map;
+        workers[t].seed = (unsigned)t;
+        workers[t].readPercent = threads;   // stride: thread t writes keys t, t + threads, ...
+        pthread_create(&ids[t], NULL, growthWriter, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+
+    int missing = 0;
+    char value[CMAP_VALUE_LENGTH], expected[32];
+    for (int key = 0; key < 200000; key++) {
+        snprintf(expected, sizeof(expected), "k%d:", key);
+        if (!cmapGet(map, key, value, sizeof(value)) || strcmp(value, expected) != 0) {
+            missing++;
+        }
+    }
+    printf("Grew a 4-segment map from 64 slots to 200000 keys with %d writers: size %zu, missing %d\n",
+           threads, cmapSize(map), missing);
+    free(workers);
+    free(ids);
+    freeConcurrentMap(map);
+}
+
+// ---------------------------------------------------------------------------
+// StringMap
+// ---------------------------------------------------------------------------
+//
+// Hash table with string keys (URLs, user IDs) and 64-bit values:
+//
+//   - Keys are copied once into an arena of large blocks instead of one
+//     malloc per key; entries point into it and the blocks never move.
+//   - Each 32-byte entry caches the key's 64-bit hash. A probe compares
+//     hashes first, so keys that differ almost never reach memcmp.
+//   - Keys of up to STRMAP_INLINE_KEY bytes (most user IDs) are stored in
+//     the entry itself and never touch the arena.
+//   - Lookups take a pointer and a length, so callers can pass a slice of a
+//     larger buffer without copying or terminating it.
+//   - strMapPutMany hashes keys STRMAP_BATCH at a time and prefetches their
+//     home slots before inserting, so the cache misses overlap.
+//
+// Collisions use linear probing and removal shifts later entries back, so
+// there are no tombstones. The arena does not reclaim the bytes of removed
+// keys; it is freed with the map.
+
+#define STRMAP_INLINE_KEY 12
+#define STRMAP_ARENA_BLOCK (64 * 1024)
+#define STRMAP_BATCH 16
+#define STRMAP_SEED 0x243f6a8885a308d3ULL
+
+typedef struct {
+    uint64_t hash;      // 0 marks an empty slot
+    uint64_t value;
+    uint32_t length;
+    char key[STRMAP_INLINE_KEY];    // the key itself, or a pointer into the arena
+} StrEntry;
+
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t used;
+    size_t capacity;
+    char data[];
+} ArenaBlock;
+
+typedef struct {
+    StrEntry* entries;
+    size_t mask;
+    size_t count;
+    ArenaBlock* arena;
+    size_t arenaBytes;
+} StringMap;
+
+// wyhash-style 64-bit hash: 64x64->128 multiply-and-fold over 16-byte steps
+static const uint64_t wyP0 = 0xa0761d6478bd642fULL, wyP1 = 0xe7037ed1a0b428dbULL,
+                      wyP2 = 0x8ebc6af09c88c6e3ULL, wyP3 = 0x589965cc75374cc3ULL;
+
+static inline uint64_t wyMix(uint64_t a, uint64_t b) {
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+}
+
+static inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static inline uint64_t read32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline uint64_t hashBytes(const void* key, size_t length) {
+    const uint8_t* p = (const uint8_t*)key;
+    uint64_t seed = STRMAP_SEED ^ wyMix(STRMAP_SEED ^ wyP0, wyP1);
+    uint64_t a, b;
+    if (length <= 16) {
+        if (length >= 4) {
+            size_t step = (length >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + step);
+            b = (read32(p + length - 4) << 32) | read32(p + length - 4 - step);
+        } else if (length > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | p[length - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = length;
+        if (i > 48) {
+            uint64_t s1 = seed, s2 = seed;
+            do {
+                seed = wyMix(read64(p) ^ wyP1, read64(p + 8) ^ seed);
+                s1 = wyMix(read64(p + 16) ^ wyP2, read64(p + 24) ^ s1);
+                s2 = wyMix(read64(p + 32) ^ wyP3, read64(p + 40) ^ s2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= s1 ^ s2;
+        }
+        while (i > 16) {
+            seed = wyMix(read64(p) ^ wyP1, read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = read64(p + i - 16);
+        b = read64(p + i - 8);
+    }
+    __uint128_t r = (__uint128_t)(a ^ wyP1) * (b ^ seed);
+    uint64_t h = wyMix((uint64_t)r ^ wyP0 ^ length, (uint64_t)(r >> 64) ^ wyP1);
+    return h ? h : 1;
+}
+
+static inline const char* entryKey(const StrEntry* e) {
+    if (e->length <= STRMAP_INLINE_KEY) {
+        return e->key;
+    }
+    const char* p;
+    memcpy(&p, e->key, sizeof(p));
+    return p;
+}
+
+// copy a key into the arena (NUL-terminated for printing)
+static const char* arenaCopy(StringMap* map, const char* key, size_t length) {
+    ArenaBlock* block = map->arena;
+    if (!block || block->used + length + 1 > block->capacity) {
+        size_t capacity = length + 1 > STRMAP_ARENA_BLOCK ? length + 1 : STRMAP_ARENA_BLOCK;
+        block = (ArenaBlock*)malloc(sizeof(ArenaBlock) + capacity);
+        if (!block) {
+            return NULL;
+        }
+        block->next = map->arena;
+        block->used = 0;
+        block->capacity = capacity;
+        map->arena = block;
+        map->arenaBytes += sizeof(ArenaBlock) + capacity;
+    }
+    char* copy = block->data + block->used;
+    memcpy(copy, key, length);
+    copy[length] = '\0';
+    block->used += length + 1;
+    return copy;
+}
+
+StringMap* createStringMap(size_t expectedEntries) {
+    StringMap* map = (StringMap*)calloc(1, sizeof(StringMap));
+    size_t capacity = nextPowerOfTwo(expectedEntries + expectedEntries / 3 + 1);
+    if (capacity < 16) {
+        capacity = 16;
+    }
+    map->entries = (StrEntry*)allocAligned(capacity * sizeof(StrEntry));
+    if (!map->entries) {
+        printf("Memory allocation failed!\n");
+        free(map);
+        return NULL;
+    }
+    map->mask = capacity - 1;
+    return map;
+}
+
+static StrEntry* findEntry(const StringMap* map, const char* key, size_t length, uint64_t hash) {
+    size_t i = hash & map->mask;
+    for (;;) {
+        StrEntry* e = &map->entries[i];
+        if (e->hash == 0) {
+            return NULL;
+        }
+        if (e->hash == hash && e->length == length && memcmp(entryKey(e), key, length) == 0) {
+            return e;
+        }
+        i = (i + 1) & map->mask;
+    }
+}
+
+static bool resizeStringMap(StringMap* map, size_t capacity) {
+    StrEntry* entries = (StrEntry*)allocAligned(capacity * sizeof(StrEntry));
+    if (!entries) {
+        printf("Memory allocation failed!\n");
+        return false;
+    }
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i <= map->mask; i++) {
+        StrEntry* e = &map->entries[i];
+        if (e->hash) {
+            size_t j = e->hash & mask;
+            while (entries[j].hash) {
+                j = (j + 1) & mask;
+            }
+            entries[j] = *e;
+        }
+    }
+    free(map->entries);
+    map->entries = entries;
+    map->mask = mask;
+    return true;
+}
+
+// insert with a precomputed hash; the caller has made room
+static bool putHashed(StringMap* map, const char* key, size_t length, uint64_t hash, uint64_t value) {
+    size_t i = hash & map->mask;
+    StrEntry* e;
+    for (;;) {
+        e = &map->entries[i];
+        if (e->hash == 0) {
+            break;
+        }
+        if (e->hash == hash && e->length == length && memcmp(entryKey(e), key, length) == 0) {
+            e->value = value;
+            return false;
+        }
+        i = (i + 1) & map->mask;
+    }
+
+    if (length <= STRMAP_INLINE_KEY) {
+        memcpy(e->key, key, length);
+    } else {
+        const char* copy = arenaCopy(map, key, length);
+        if (!copy) {
+            printf("Memory allocation failed!\n");
+            return false;
+        }
+        memcpy(e->key, &copy, sizeof(copy));
+    }
+    e->hash = hash;
+    e->length = (uint32_t)length;
+    e->value = value;
+    map->count++;
+    return true;
+}
+
+// keep the load factor at or below 3/4 after adding `extra` keys
+static bool reserveStringMap(StringMap* map, size_t extra) {
+    size_t capacity = map->mask + 1;
+    while ((map->count + extra) * 4 > capacity * 3) {
+        capacity *= 2;
+    }
+    return capacity == map->mask + 1 || resizeStringMap(map, capacity);
+}
+
+// insert or replace; returns true if the key was new
+bool strMapPut(StringMap* map, const char* key, size_t length, uint64_t value) {
+    if (length > UINT32_MAX || !reserveStringMap(map, 1)) {
+        return false;
+    }
+    return putHashed(map, key, length, hashBytes(key, length), value);
+}
+
+bool strMapGet(const StringMap* map, const char* key, size_t length, uint64_t* value) {
+    StrEntry* e = findEntry(map, key, length, hashBytes(key, length));
+    if (e && value) {
+        *value = e->value;
+    }
+    return e != NULL;
+}
+
+// returns true if the key was present
+bool strMapRemove(StringMap* map, const char* key, size_t length) {
+    StrEntry* e = findEntry(map, key, length, hashBytes(key, length));
+    if (!e) {
+        return false;
+    }
+    // shift back every later entry in the run that may sit at or before the hole
+    size_t hole = (size_t)(e - map->entries);
+    size_t i = hole;
+    for (;;) {
+        i = (i + 1) & map->mask;
+        StrEntry* next = &map->entries[i];
+        if (next->hash == 0) {
+            break;
+        }
+        size_t home = next->hash & map->mask;
+        if (((i - home) & map->mask) >= ((i - hole) & map->mask)) {
+            map->entries[hole] = *next;
+            hole = i;
+        }
+    }
+    memset(&map->entries[hole], 0, sizeof(StrEntry));
+    map->count--;
+    return true;
+}
+
+// insert `count` keys; hashes a batch, prefetches the home slots, then inserts
+void strMapPutMany(StringMap* map, const char* const* keys, const size_t* lengths,
+                   const uint64_t* values, size_t count) {
+    if (!reserveStringMap(map, count)) {
+        return;
+    }
+    uint64_t hashes[STRMAP_BATCH];
+    for (size_t start = 0; start < count; start += STRMAP_BATCH) {
+        size_t n = count - start < STRMAP_BATCH ? count - start : STRMAP_BATCH;
+        for (size_t k = 0; k < n; k++) {
+            hashes[k] = hashBytes(keys[start + k], lengths[start + k]);
+            __builtin_prefetch(&map->entries[hashes[k] & map->mask], 1);
+        }
+        for (size_t k = 0; k < n; k++) {
+            putHashed(map, keys[start + k], lengths[start + k], hashes[k], values[start + k]);
+        }
+    }
+}
+
+size_t strMapSize(const StringMap* map) {
+    return map->count;
+}
+
+size_t strMapMemory(const StringMap* map) {
+    return (map->mask + 1) * sizeof(StrEntry) + map->arenaBytes + sizeof(StringMap);
+}
+
+void freeStringMap(StringMap* map) {
+    if (!map) {
+        return;
+    }
+    while (map->arena) {
+        ArenaBlock* next = map->arena->next;
+        free(map->arena);
+        map->arena = next;
+    }
+    free(map->entries);
+    free(map);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: StringMap vs a chained table of malloc'd nodes and strdup'd keys
+// ---------------------------------------------------------------------------
+
+// The baseline is the table at the top of this file with string keys: djb2
+// hash, one malloc for the node and one for the key, strcmp on every node.
+typedef struct StrNode {
+    char* key;
+    uint64_t value;
+    struct StrNode* next;
+} StrNode;
+
+typedef struct {
+    StrNode** buckets;
+    size_t mask;
+    size_t memory;
+} ChainedStringTable;
+
+static uint64_t djb2(const char* s) {
+    uint64_t h = 5381;
+    while (*s) {
+        h = h * 33 + (unsigned char)*s++;
+    }
+    return h;
+}
+
+static void chainedPut(ChainedStringTable* t, const char* key, uint64_t value) {
+    size_t index = djb2(key) & t->mask;
+    for (StrNode* n = t->buckets[index]; n; n = n->next) {
+        if (strcmp(n->key, key) == 0) {
+            n->value = value;
+            return;
+        }
+    }
+    StrNode* node = (StrNode*)malloc(sizeof(StrNode));
+    node->key = strdup(key);
+    node->value = value;
+    node->next = t->buckets[index];
+    t->buckets[index] = node;
+    // malloc rounds each request up to 16 bytes plus an 8-byte header
+    t->memory += ((sizeof(StrNode) + 8 + 15) & ~(size_t)15) + ((strlen(key) + 1 + 8 + 15) & ~(size_t)15);
+}
+
+static bool chainedGet(const ChainedStringTable* t, const char* key, uint64_t* value) {
+    for (StrNode* n = t->buckets[djb2(key) & t->mask]; n; n = n->next) {
+        if (strcmp(n->key, key) == 0) {
+            *value = n->value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void freeChained(ChainedStringTable* t) {
+    for (size_t i = 0; i <= t->mask; i++) {
+        StrNode* n = t->buckets[i];
+        while (n) {
+            StrNode* next = n->next;
+            free(n->key);
+            free(n);
+            n = next;
+        }
+    }
+    free(t->buckets);
+}
+
+static double elapsedSince(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+}
+
+// Zipf(1) rank in [0, n) by binary search over a precomputed CDF
+static size_t zipfRank(const double* cdf, size_t n, double u) {
+    size_t lo = 0, hi = n - 1;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (cdf[mid] < u) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static double* zipfCdf(size_t n) {
+    double* cdf = (double*)malloc(n * sizeof(double));
+    double sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += 1.0 / (i + 1);
+        cdf[i] = sum;
+    }
+    for (size_t i = 0; i < n; i++) {
+        cdf[i] /= sum;
+    }
+    return cdf;
+}
+
+// URLs: Zipf-popular hosts, 1-5 path segments, optional query string
+static char* makeUrl(unsigned* seed, const double* hostCdf, size_t hosts, size_t id) {
+    static const char* words[] = {
+        "api", "v1", "v2", "users", "items", "search", "static", "img", "products", "cart",
+        "account", "settings", "news", "2024", "article", "video", "watch", "docs", "blog", "assets",
+    };
+    static const char* tlds[] = {"com", "org", "net", "io", "co.uk"};
+    char url[256];
+    size_t host = zipfRank(hostCdf, hosts, rand_r(seed) / (RAND_MAX + 1.0));
+    int length = snprintf(url, sizeof(url), "https://%s%zu.example.%s", host % 3 ? "www.site" : "cdn", host,
+                          tlds[host % 5]);
+    int segments = 1 + rand_r(seed) % 5;
+    for (int s = 0; s < segments; s++) {
+        length += snprintf(url + length, sizeof(url) - length, "/%s", words[rand_r(seed) % 20]);
+    }
+    if (rand_r(seed) % 2) {
+        length += snprintf(url + length, sizeof(url) - length, "?id=%zu&ref=%u", id, rand_r(seed) % 1000);
+    } else {
+        length += snprintf(url + length, sizeof(url) - length, "/%zu", id);
+    }
+    return strdup(url);
+}
+
+void benchmarkStringMap(size_t n) {
+    unsigned seed = 42;
+    size_t hosts = 2000;
+    double* hostCdf = zipfCdf(hosts);
+    char** keys = (char**)malloc(n * sizeof(char*));
+    size_t* lengths = (size_t*)malloc(n * sizeof(size_t));
+    uint64_t* values = (uint64_t*)malloc(n * sizeof(uint64_t));
+    size_t totalLength = 0;
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = makeUrl(&seed, hostCdf, hosts, i);
+        lengths[i] = strlen(keys[i]);
+        values[i] = i;
+        totalLength += lengths[i];
+    }
+
+    // request stream: Zipf popularity over the keys, 10% misses
+    size_t queries = 4 * n;
+    double* keyCdf = zipfCdf(n);
+    char** misses = (char**)malloc(n / 10 * sizeof(char*));
+    for (size_t i = 0; i < n / 10; i++) {
+        misses[i] = makeUrl(&seed, hostCdf, hosts, n + i);
+    }
+    const char** stream = (const char**)malloc(queries * sizeof(char*));
+    size_t* streamLengths = (size_t*)malloc(queries * sizeof(size_t));
+    for (size_t q = 0; q < queries; q++) {
+        const char* key = rand_r(&seed) % 10 == 0
+            ? misses[rand_r(&seed) % (n / 10)]
+            : keys[(zipfRank(keyCdf, n, rand_r(&seed) / (RAND_MAX + 1.0)) * 2654435761u) % n];
+        stream[q] = key;
+        streamLengths[q] = strlen(key);
+    }
+    printf("\n%zu URLs (average %.1f bytes), %zu lookups (Zipf popularity, 10%% misses)\n",
+           n, (double)totalLength / n, queries);
+
+    struct timespec start;
+    uint64_t value, checksum = 0;
+
+    ChainedStringTable chained = { (StrNode**)calloc(nextPowerOfTwo(n), sizeof(StrNode*)), nextPowerOfTwo(n) - 1, 0 };
+    chained.memory = (chained.mask + 1) * sizeof(StrNode*);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < n; i++) {
+        chainedPut(&chained, keys[i], values[i]);
+    }
+    double chainedInsert = elapsedSince(start);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t q = 0; q < queries; q++) {
+        checksum += chainedGet(&chained, stream[q], &value) ? value : 1;
+    }
+    double chainedLookup = elapsedSince(start);
+    size_t chainedMemory = chained.memory;
+    freeChained(&chained);
+
+    StringMap* single = createStringMap(16);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < n; i++) {
+        strMapPut(single, keys[i], lengths[i], values[i]);
+    }
+    double singleInsert = elapsedSince(start);
+    freeStringMap(single);
+
+    StringMap* map = createStringMap(16);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    strMapPutMany(map, (const char* const*)keys, lengths, values, n);
+    double batchInsert = elapsedSince(start);
+    uint64_t mapChecksum = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t q = 0; q < queries; q++) {
+        mapChecksum += strMapGet(map, stream[q], streamLengths[q], &value) ? value : 1;
+    }
+    double mapLookup = elapsedSince(start);
+
+    printf("%-22s %-14s %-14s %-12s\n", "", "Insert ns/key", "Lookup ns", "Bytes/key");
+    printf("%-22s %-14.1f %-14.1f %-12.1f\n", "Chained (djb2, strdup)", chainedInsert * 1e9 / n,
+           chainedLookup * 1e9 / queries, (double)chainedMemory / n);
+    printf("%-22s %-14.1f %-14.1f %-12.1f\n", "StringMap", singleInsert * 1e9 / n,
+           mapLookup * 1e9 / queries, (double)strMapMemory(map) / n);
+    printf("%-22s %-14.1f\n", "StringMap putMany", batchInsert * 1e9 / n);
+    printf("Lookup results agree: %s\n", checksum == mapChecksum ? "yes" : "NO");
+    freeStringMap(map);
+
+    // short user IDs live entirely in the entry
+    StringMap* users = createStringMap(n);
+    char id[16];
+    for (size_t i = 0; i < n; i++) {
+        int length = snprintf(id, sizeof(id), "u%07zu", i * 7919 % 10000000);
+        strMapPut(users, id, length, i);
+    }
+    printf("%zu user IDs: %.1f bytes/key, %zu bytes of arena\n", strMapSize(users),
+           (double)strMapMemory(users) / strMapSize(users), users->arenaBytes);
+    freeStringMap(users);
+
+    for (size_t i = 0; i < n; i++) {
+        free(keys[i]);
+    }
+    for (size_t i = 0; i < n / 10; i++) {
+        free(misses[i]);
+    }
+    free(keys);
+    free(lengths);
+    free(values);
+    free(misses);
+    free(stream);
+    free(streamLengths);
+    free(keyCdf);
+    free(hostCdf);
+}
+
+void demonstrateStringMap(void) {
+    printf("\nStringMap:\n");
+    StringMap* map = createStringMap(4);
+    const char* request = "GET https://www.example.com/api/v1/users/42 HTTP/1.1";
+    strMapPut(map, "u0000042", 8, 42);
+    strMapPut(map, "https://www.example.com/api/v1/users/42", 39, 1001);
+
+    // look up the URL inside the request line without copying it out
+    const char* url = strchr(request, ' ') + 1;
+    size_t urlLength = (size_t)(strchr(url, ' ') - url);
+    uint64_t value;
+    if (strMapGet(map, url, urlLength, &value)) {
+        printf("Value for %.*s: %llu\n", (int)urlLength, url, (unsigned long long)value);
+    }
+    strMapRemove(map, "u0000042", 8);
+    printf("u0000042 after removal: %s, size %zu\n", strMapGet(map, "u0000042", 8, NULL) ? "found" : "not found",
+           strMapSize(map));
+    freeStringMap(map);
+}
+
+// ---------------------------------------------------------------------------
+// PerfectHash: minimal perfect hashing for static key sets
+// ---------------------------------------------------------------------------
+//
+// For a fixed set of n keys, PerfectHash maps every key to a distinct slot
+// in [0, n), so a read-only table built on it needs no chaining, no probing
+// and no empty slots: one probe of StaticTable, which holds the key and value
+// in that slot. The construction follows PTHash:
+//
+//   - Keys are split into partitions of about MPH_PARTITION_KEYS by hash.
+//     Partitions are built independently, one per worker thread at a time,
+//     and each one's position bitmap fits in cache.
+//   - Inside a partition, keys fall into c*n/log2(n) buckets, skewed so that
+//     60% of the keys land in the first 30% of buckets. Buckets are placed
+//     largest first. For each bucket a "pilot" value is searched so that
+//     position(key, pilot) is free for every key in it. The big buckets go
+//     first, while the table is still empty.
+//   - Positions range over n/alpha slots, which makes the last buckets much
+//     easier to place. The few keys that land past n are sent to a free slot
+//     below n through a small remap array.
+//   - Pilots are mostly small and repeat a lot. They are stored as indexes of
+//     pilotBits bits into a dictionary of distinct values, which keeps
+//     pre-hashed values so a lookup does no extra mixing.
+//
+// A lookup costs two hashes, one load from the pilot index (plus the tiny,
+// cache-resident dictionary and partition headers) and, for about 0.5% of
+// keys, one remap load.
+//
+// File layout, native byte order, every section 8-byte aligned:
+//   [PerfectHashHeader][MphPartition x partitions][dictionary uint64 x size]
+//   [remap uint32 x count, padded][pilot indexes, packed, + 8 bytes padding]
+// Lookups clamp pilot indexes to the dictionary, so a corrupt index stays in
+// bounds, and the header carries a checksum of everything after it. A build produces
+// exactly this image in memory, so a read-only mmap of a saved file is used
+// as-is once the header, partition records and remap entries check out.
+
+#define MPH_FILE_MAGIC "PERFHASH"
+#define MPH_FORMAT_VERSION 2
+#define MPH_HASH_VERSION 1              // mphMix() with the seed scheme below
+#define MPH_ENDIAN_TAG 0x01020304u
+#define MPH_PARTITION_KEYS (1 << 23)
+#define MPH_BUCKET_FACTOR 5.0           // c: buckets = c * n / log2(n)
+#define MPH_ALPHA 0.995                 // keys per position slot
+#define MPH_DENSE_FRACTION 0x999999999999999AULL   // 0.6 * 2^64 of keys ...
+#define MPH_DENSE_BUCKETS 0.3                      // ... go to 30% of buckets
+#define MPH_MAX_PILOT (1u << 20)
+#define MPH_CACHED_PILOTS (1u << 16)    // pilot hashes precomputed for the search
+#define MPH_MAX_SEEDS 8
+
+typedef struct {
+    char magic[8];
+    uint32_t formatVersion;
+    uint32_t hashVersion;
+    uint32_t endianTag;
+    uint32_t pilotBits;
+    uint64_t seed;
+    uint64_t keyCount;
+    uint64_t partitionCount;
+    uint64_t dictionarySize;
+    uint64_t bucketCount;
+    uint64_t remapCount;
+    uint64_t totalBytes;
+    uint64_t checksum;          // hashBytes() of the image after the header
+} PerfectHashHeader;
+
+typedef struct {
+    uint64_t keyOffset;         // first output slot of this partition
+    uint64_t bucketOffset;      // first pilot index of this partition
+    uint64_t remapOffset;
+    uint64_t denseScale;        // frac -> dense bucket, see mphBucket()
+    uint64_t sparseScale;
+    uint32_t denseBuckets;
+    uint32_t bucketCount;
+    uint32_t tableSize;         // positions, about keyCount / alpha
+    uint32_t keyCount;
+} MphPartition;
+
+_Static_assert(sizeof(PerfectHashHeader) == 88, "header must keep the sections 8-byte aligned");
+_Static_assert(sizeof(MphPartition) == 56, "partition records are part of the file format");
+
+typedef struct {
+    const PerfectHashHeader* header;
+    const MphPartition* partitions;
+    const uint64_t* dictionary;
+    const uint32_t* remap;
+    const uint8_t* pilots;
+    uint64_t seed;
+    uint64_t partitionCount;
+    uint64_t pilotMask;
+    uint64_t dictionaryLast;    // largest valid pilot index
+    uint32_t pilotBits;
+    void* image;                // malloc'd build or mmap'd file
+    size_t mappedBytes;         // non-zero if image is a mapping
+} PerfectHash;
+
+static inline uint64_t mphMix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+static inline uint64_t mulHigh(uint64_t a, uint64_t b) {
+    return (uint64_t)(((__uint128_t)a * b) >> 64);
+}
+
+// bucket inside a partition from the hash bits left over by the partition choice
+static inline uint64_t mphBucket(const MphPartition* p, uint64_t frac) {
+    if (frac < MPH_DENSE_FRACTION) {
+        return mulHigh(frac, p->denseScale);
+    }
+    return p->denseBuckets + mulHigh(frac - MPH_DENSE_FRACTION, p->sparseScale);
+}
+
+// the multiply spreads low-bit differences upward before the top bits are used
+static inline uint64_t mphPosition(uint64_t h2, uint64_t pilotHash, uint32_t tableSize) {
+    return mulHigh((h2 ^ pilotHash) * 0x9e3779b97f4a7c15ULL, tableSize);
+}
+
+// slot in [0, keyCount) for a key of the build set; any other key gets an
+// arbitrary slot, so callers compare the stored key (see staticSearch)
+static inline uint64_t perfectHashLookup(const PerfectHash* ph, uint64_t key) {
+    uint64_t h1 = mphMix(key ^ ph->seed);
+    uint64_t h2 = mphMix(h1 ^ 0x5851f42d4c957f2dULL);
+    __uint128_t split = (__uint128_t)h1 * ph->partitionCount;
+    const MphPartition* p = &ph->partitions[(uint64_t)(split >> 64)];
+
+    uint64_t bit = (p->bucketOffset + mphBucket(p, (uint64_t)split)) * ph->pilotBits;
+    uint64_t word;
+    memcpy(&word, ph->pilots + (bit >> 3), sizeof(word));
+    uint64_t pilot = (word >> (bit & 7)) & ph->pilotMask;
+    uint64_t pilotHash = ph->dictionary[pilot < ph->dictionaryLast ? pilot : ph->dictionaryLast];
+
+    uint64_t position = mphPosition(h2, pilotHash, p->tableSize);
+    if (position >= p->keyCount) {
+        position = ph->remap[p->remapOffset + position - p->keyCount];
+    }
+    return p->keyOffset + position;
+}
+
+// --- construction ---
+
+typedef struct {
+    const uint64_t* keys;
+    size_t keyCount;
+    uint64_t seed;
+    uint64_t partitionCount;
+    int threads;
+    uint64_t* counts;           // [thread][partition] keys, then scatter cursors
+    uint64_t* hashes;           // h1 of every key, grouped by partition
+    MphPartition* partitions;
+    uint32_t* pilots;           // raw pilot per bucket
+    uint32_t* remap;
+    uint64_t* pilotHashes;      // mphMix(pilot ^ seed) for small pilots
+    uint64_t bucketCount;
+    uint64_t remapCount;
+    _Atomic uint64_t nextPartition;
+    atomic_bool failed;
+    atomic_bool duplicate;
+} MphBuild;
+
+typedef struct {
+    MphBuild* build;
+    int index;
+} MphWorker;
+
+static inline uint64_t mphPartitionOf(const MphBuild* b, uint64_t h1) {
+    return mulHigh(h1, b->partitionCount);
+}
+
+static void mphKeyRange(const MphBuild* b, int thread, size_t* begin, size_t* end) {
+    *begin = b->keyCount * thread / b->threads;
+    *end = b->keyCount * (thread + 1) / b->threads;
+}
+
+static void* mphCountWorker(void* arg) {
+    MphWorker* w = (MphWorker*)arg;
+    MphBuild* b = w->build;
+    uint64_t* counts = b->counts + (size_t)w->index * b->partitionCount;
+    size_t begin, end;
+    mphKeyRange(b, w->index, &begin, &end);
+    for (size_t i = begin; i < end; i++) {
+        counts[mphPartitionOf(b, mphMix(b->keys[i] ^ b->seed))]++;
+    }
+    return NULL;
+}
+
+static void* mphScatterWorker(void* arg) {
+    MphWorker* w = (MphWorker*)arg;
+    MphBuild* b = w->build;
+    uint64_t* cursors = b->counts + (size_t)w->index * b->partitionCount;
+    size_t begin, end;
+    mphKeyRange(b, w->index, &begin, &end);
+    for (size_t i = begin; i < end; i++) {
+        uint64_t h1 = mphMix(b->keys[i] ^ b->seed);
+        b->hashes[cursors[mphPartitionOf(b, h1)]++] = h1;
+    }
+    return NULL;
+}
+
+// place every bucket of one partition; returns false if some bucket has no pilot
+static bool mphBuildPartition(MphBuild* b, const MphPartition* p, uint64_t* grouped, uint32_t* starts,
+                              uint32_t* order, uint64_t* taken) {
+    const uint64_t* h1s = b->hashes + p->keyOffset;
+    uint32_t n = p->keyCount;
+    uint32_t buckets = p->bucketCount;
+    uint32_t* pilots = b->pilots + p->bucketOffset;
+
+    // group h2 values by bucket (counting sort)
+    memset(starts, 0, (buckets + 1) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < n; i++) {
+        starts[mphBucket(p, h1s[i] * b->partitionCount) + 1]++;
+    }
+    uint32_t largest = 0;
+    for (uint32_t k = 0; k < buckets; k++) {
+        largest = starts[k + 1] > largest ? starts[k + 1] : largest;
+        starts[k + 1] += starts[k];
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        uint64_t bucket = mphBucket(p, h1s[i] * b->partitionCount);
+        grouped[starts[bucket]++] = mphMix(h1s[i] ^ 0x5851f42d4c957f2dULL);
+    }
+    for (uint32_t k = buckets; k > 0; k--) {
+        starts[k] = starts[k - 1];
+    }
+    starts[0] = 0;
+
+    // buckets by size, largest first (counting sort on size)
+    uint32_t* bySize = (uint32_t*)calloc(largest + 2, sizeof(uint32_t));
+    for (uint32_t k = 0; k < buckets; k++) {
+        bySize[largest - (starts[k + 1] - starts[k]) + 1]++;
+    }
+    for (uint32_t s = 0; s <= largest; s++) {
+        bySize[s + 1] += bySize[s];
+    }
+    for (uint32_t k = 0; k < buckets; k++) {
+        order[bySize[largest - (starts[k + 1] - starts[k])]++] = k;
+    }
+    free(bySize);
+
+    memset(taken, 0, ((p->tableSize + 63) / 64) * sizeof(uint64_t));
+    memset(pilots, 0, buckets * sizeof(uint32_t));
+    uint64_t positions[256];
+    for (uint32_t o = 0; o < buckets; o++) {
+        uint32_t k = order[o];
+        const uint64_t* keys = grouped + starts[k];
+        uint32_t size = starts[k + 1] - starts[k];
+        if (size == 0) {
+            break;          // sorted by size: the rest are empty too
+        }
+        if (size > 256) {
+            return false;
+        }
+        for (uint32_t i = 1; i < size; i++) {
+            for (uint32_t j = 0; j < i; j++) {
+                if (keys[i] == keys[j]) {
+                    atomic_store(&b->duplicate, true);
+                    return false;
+                }
+            }
+        }
+
+        uint32_t pilot = 0;
+        for (; pilot < MPH_MAX_PILOT; pilot++) {
+            uint64_t pilotHash = pilot < MPH_CACHED_PILOTS ? b->pilotHashes[pilot] : mphMix(pilot ^ b->seed);
+            uint32_t placed = 0;
+            for (; placed < size; placed++) {
+                uint64_t pos = mphPosition(keys[placed], pilotHash, p->tableSize);
+                if (taken[pos >> 6] & (1ULL << (pos & 63))) {
+                    break;
+                }
+                taken[pos >> 6] |= 1ULL << (pos & 63);
+                positions[placed] = pos;
+            }
+            if (placed == size) {
+                break;
+            }
+            while (placed-- > 0) {
+                taken[positions[placed] >> 6] &= ~(1ULL << (positions[placed] & 63));
+            }
+        }
+        if (pilot == MPH_MAX_PILOT) {
+            return false;
+        }
+        pilots[k] = pilot;
+    }
+
+    // occupied positions past keyCount move to the free slots below it
+    uint32_t* remap = b->remap + p->remapOffset;
+    uint32_t freeSlot = 0;
+    for (uint32_t pos = n; pos < p->tableSize; pos++) {
+        remap[pos - n] = 0;
+        if (taken[pos >> 6] & (1ULL << (pos & 63))) {
+            while (taken[freeSlot >> 6] & (1ULL << (freeSlot & 63))) {
+                freeSlot++;
+            }
+            remap[pos - n] = freeSlot++;
+        }
+    }
+    return true;
+}
+
+static void* mphPartitionWorker(void* arg) {
+    MphBuild* b = ((MphWorker*)arg)->build;
+    uint64_t* grouped = NULL;
+    uint32_t *starts = NULL, *order = NULL;
+    uint64_t* taken = NULL;
+    size_t capacity = 0;
+    uint64_t index;
+    while (!atomic_load(&b->failed) && (index = atomic_fetch_add(&b->nextPartition, 1)) < b->partitionCount) {
+        const MphPartition* p = &b->partitions[index];
+        size_t needed = (p->tableSize > p->bucketCount ? p->tableSize : p->bucketCount) + (size_t)2;
+        if (needed > capacity) {
+            free(grouped);
+            free(starts);
+            free(order);
+            free(taken);
+            capacity = needed;
+            grouped = (uint64_t*)malloc(capacity * sizeof(uint64_t));
+            starts = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+            order = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+            taken = (uint64_t*)malloc((capacity + 63) / 64 * sizeof(uint64_t));
+        }
+        if (!mphBuildPartition(b, p, grouped, starts, order, taken)) {
+            atomic_store(&b->failed, true);
+        }
+    }
+    free(grouped);
+    free(starts);
+    free(order);
+    free(taken);
+    return NULL;
+}
+
+static void mphRunThreads(MphBuild* b, void* (*work)(void*)) {
+    pthread_t ids[b->threads];
+    MphWorker workers[b->threads];
+    for (int t = 0; t < b->threads; t++) {
+        workers[t] = (MphWorker){ b, t };
+        pthread_create(&ids[t], NULL, work, &workers[t]);
+    }
+    for (int t = 0; t < b->threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+}
+
+// bytes of an image with the header's section sizes, 0 if they overflow
+static uint64_t mphImageBytes(const PerfectHashHeader* h) {
+    uint64_t pilotBits, partitionBytes, dictionaryBytes, remapBytes, total;
+    if (__builtin_mul_overflow(h->bucketCount, (uint64_t)h->pilotBits, &pilotBits) ||
+        __builtin_mul_overflow(h->partitionCount, sizeof(MphPartition), &partitionBytes) ||
+        __builtin_mul_overflow(h->dictionarySize, sizeof(uint64_t), &dictionaryBytes) ||
+        h->remapCount > UINT64_MAX / 8 || pilotBits > UINT64_MAX - 128) {
+        return 0;
+    }
+    remapBytes = ((h->remapCount + 1) & ~1ULL) * sizeof(uint32_t);
+    uint64_t pilotBytes = ((pilotBits + 7) / 8 + 8 + 7) & ~7ULL;
+    if (__builtin_add_overflow(sizeof(PerfectHashHeader), partitionBytes, &total) ||
+        __builtin_add_overflow(total, dictionaryBytes, &total) ||
+        __builtin_add_overflow(total, remapBytes, &total) ||
+        __builtin_add_overflow(total, pilotBytes, &total)) {
+        return 0;
+    }
+    return total;
+}
+
+static uint64_t mphChecksum(const PerfectHashHeader* h) {
+    return hashBytes(h + 1, h->totalBytes - sizeof(PerfectHashHeader));
+}
+
+// every partition must tile the key, bucket and remap ranges in order, its
+// bucket scales and table size must keep lookups inside them, and its remap
+// entries must point inside its keys (the remap table is about 0.5% of n)
+static bool mphPartitionsValid(const PerfectHashHeader* h) {
+    const MphPartition* partitions = (const MphPartition*)(h + 1);
+    const uint32_t* remap = (const uint32_t*)((const uint64_t*)(partitions + h->partitionCount) + h->dictionarySize);
+    uint64_t keys = 0, buckets = 0, remaps = 0;
+    for (uint64_t i = 0; i < h->partitionCount; i++) {
+        const MphPartition* p = &partitions[i];
+        if (p->keyOffset != keys || p->bucketOffset != buckets || p->remapOffset != remaps ||
+            p->keyCount > h->keyCount - keys || p->bucketCount > h->bucketCount - buckets ||
+            p->tableSize <= p->keyCount || p->tableSize - p->keyCount > h->remapCount - remaps ||
+            p->bucketCount == 0 || p->denseBuckets >= p->bucketCount ||
+            mulHigh(MPH_DENSE_FRACTION - 1, p->denseScale) >= p->bucketCount ||
+            mulHigh(0 - MPH_DENSE_FRACTION - 1, p->sparseScale) >= p->bucketCount - p->denseBuckets) {
+            return false;
+        }
+        for (uint64_t r = remaps; r < remaps + p->tableSize - p->keyCount; r++) {
+            if (remap[r] >= p->keyCount) {
+                return false;
+            }
+        }
+        keys += p->keyCount;
+        buckets += p->bucketCount;
+        remaps += p->tableSize - p->keyCount;
+    }
+    return keys == h->keyCount && buckets == h->bucketCount && remaps == h->remapCount;
+}
+
+static PerfectHash* mphAttach(void* image, size_t mappedBytes) {
+    PerfectHash* ph = (PerfectHash*)calloc(1, sizeof(PerfectHash));
+    const PerfectHashHeader* h = (const PerfectHashHeader*)image;
+    ph->header = h;
+    ph->partitions = (const MphPartition*)(h + 1);
+    ph->dictionary = (const uint64_t*)(ph->partitions + h->partitionCount);
+    ph->remap = (const uint32_t*)(ph->dictionary + h->dictionarySize);
+    ph->pilots = (const uint8_t*)(ph->remap + ((h->remapCount + 1) & ~1ULL));
+    ph->seed = h->seed;
+    ph->partitionCount = h->partitionCount;
+    ph->pilotBits = h->pilotBits;
+    ph->pilotMask = (1ULL << h->pilotBits) - 1;
+    ph->dictionaryLast = h->dictionarySize - 1;
+    ph->image = image;
+    ph->mappedBytes = mappedBytes;
+    return ph;
+}
+
+// lay out partitions for a seed: key counts, bucket and remap offsets
+static bool mphPlan(MphBuild* b) {
+    memset(b->counts, 0, (size_t)b->threads * b->partitionCount * sizeof(uint64_t));
+    mphRunThreads(b, mphCountWorker);
+
+    uint64_t keyOffset = 0, bucketOffset = 0, remapOffset = 0;
+    for (uint64_t part = 0; part < b->partitionCount; part++) {
+        uint64_t n = 0;
+        for (int t = 0; t < b->threads; t++) {
+            uint64_t count = b->counts[(size_t)t * b->partitionCount + part];
+            b->counts[(size_t)t * b->partitionCount + part] = keyOffset + n;   // scatter cursor
+            n += count;
+        }
+        if (n > UINT32_MAX / 2) {
+            return false;
+        }
+        MphPartition* p = &b->partitions[part];
+        uint64_t log2n = n > 2 ? 64 - (uint64_t)__builtin_clzll(n) : 1;
+        uint64_t buckets = (uint64_t)(MPH_BUCKET_FACTOR * n / log2n) + 2;
+        uint64_t dense = (uint64_t)(MPH_DENSE_BUCKETS * buckets) + 1;
+        dense = dense >= buckets ? buckets - 1 : dense;
+
+        p->keyOffset = keyOffset;
+        p->keyCount = (uint32_t)n;
+        p->tableSize = (uint32_t)(n / MPH_ALPHA) + 1;
+        p->bucketOffset = bucketOffset;
+        p->remapOffset = remapOffset;
+        p->denseBuckets = (uint32_t)dense;
+        p->bucketCount = (uint32_t)buckets;
+        p->denseScale = (uint64_t)(((__uint128_t)dense << 64) / MPH_DENSE_FRACTION);
+        p->sparseScale = (uint64_t)(((__uint128_t)(buckets - dense) << 64) / (0 - MPH_DENSE_FRACTION));
+        keyOffset += n;
+        bucketOffset += buckets;
+        remapOffset += p->tableSize - n;
+    }
+    b->bucketCount = bucketOffset;
+    b->remapCount = remapOffset;
+    return true;
+}
+
+/**
+ * Build a minimal perfect hash over n distinct keys with `threads` workers.
+ * Returns NULL (after printing why) on duplicate keys or allocation failure.
+ */
+PerfectHash* buildPerfectHash(const uint64_t* keys, size_t n, int threads) {
+    MphBuild b;
+    memset(&b, 0, sizeof(b));
+    b.keys = keys;
+    b.keyCount = n;
+    b.threads = threads < 1 ? 1 : threads;
+    b.partitionCount = (n + MPH_PARTITION_KEYS - 1) / MPH_PARTITION_KEYS;
+    b.partitionCount = b.partitionCount ? b.partitionCount : 1;
+    b.counts = (uint64_t*)malloc((size_t)b.threads * b.partitionCount * sizeof(uint64_t));
+    b.hashes = (uint64_t*)malloc((n ? n : 1) * sizeof(uint64_t));
+    b.partitions = (MphPartition*)calloc(b.partitionCount, sizeof(MphPartition));
+    b.pilotHashes = (uint64_t*)malloc(MPH_CACHED_PILOTS * sizeof(uint64_t));
+    if (!b.counts || !b.hashes || !b.partitions || !b.pilotHashes) {
+        printf("Memory allocation failed!\n");
+        free(b.counts);
+        free(b.hashes);
+        free(b.partitions);
+        free(b.pilotHashes);
+        return NULL;
+    }
+
+    bool built = false;
+    for (int attempt = 0; attempt < MPH_MAX_SEEDS && !built; attempt++) {
+        b.seed = mphMix(0x2545f4914f6cdd1dULL + attempt);
+        if (!mphPlan(&b)) {
+            printf("Partitions too large for 32-bit offsets\n");
+            break;
+        }
+        free(b.pilots);
+        free(b.remap);
+        b.pilots = (uint32_t*)malloc(b.bucketCount * sizeof(uint32_t));
+        b.remap = (uint32_t*)malloc((b.remapCount + 1) * sizeof(uint32_t));
+        if (!b.pilots || !b.remap) {
+            printf("Memory allocation failed!\n");
+            break;
+        }
+
+        for (uint32_t pilot = 0; pilot < MPH_CACHED_PILOTS; pilot++) {
+            b.pilotHashes[pilot] = mphMix(pilot ^ b.seed);
+        }
+        mphRunThreads(&b, mphScatterWorker);
+        atomic_store(&b.nextPartition, 0);
+        atomic_store(&b.failed, false);
+        mphRunThreads(&b, mphPartitionWorker);
+        if (atomic_load(&b.duplicate)) {
+            printf("Key set contains duplicates; no perfect hash exists\n");
+            break;
+        }
+        built = !atomic_load(&b.failed);
+    }
+    free(b.hashes);
+    free(b.counts);
+    free(b.pilotHashes);
+    if (!built) {
+        free(b.partitions);
+        free(b.pilots);
+        free(b.remap);
+        return NULL;
+    }
+    uint64_t bucketCount = b.bucketCount;
+    uint64_t remapCount = b.remapCount;
+
+    // dictionary of distinct pilots, stored pre-hashed
+    uint32_t* slotOf = (uint32_t*)malloc(MPH_MAX_PILOT * sizeof(uint32_t));
+    memset(slotOf, 0xff, MPH_MAX_PILOT * sizeof(uint32_t));
+    uint64_t distinct = 0;
+    for (uint64_t k = 0; k < bucketCount; k++) {
+        if (slotOf[b.pilots[k]] == UINT32_MAX) {
+            slotOf[b.pilots[k]] = 0;
+            distinct++;
+        }
+    }
+    uint32_t pilotBits = 1;
+    while ((1ULL << pilotBits) < distinct) {
+        pilotBits++;
+    }
+
+    PerfectHashHeader layout = { .pilotBits = pilotBits, .partitionCount = b.partitionCount,
+                                 .dictionarySize = distinct, .bucketCount = bucketCount, .remapCount = remapCount };
+    size_t total = mphImageBytes(&layout);
+    uint8_t* image = (uint8_t*)calloc(1, total);
+    if (!image) {
+        printf("Memory allocation failed!\n");
+        free(slotOf);
+        free(b.partitions);
+        free(b.pilots);
+        free(b.remap);
+        return NULL;
+    }
+    PerfectHashHeader* h = (PerfectHashHeader*)image;
+    memcpy(h->magic, MPH_FILE_MAGIC, sizeof(h->magic));
+    h->formatVersion = MPH_FORMAT_VERSION;
+    h->hashVersion = MPH_HASH_VERSION;
+    h->endianTag = MPH_ENDIAN_TAG;
+    h->pilotBits = pilotBits;
+    h->seed = b.seed;
+    h->keyCount = n;
+    h->partitionCount = b.partitionCount;
+    h->dictionarySize = distinct;
+    h->bucketCount = bucketCount;
+    h->remapCount = remapCount;
+    h->totalBytes = total;
+
+    PerfectHash* ph = mphAttach(image, 0);
+    memcpy((void*)ph->partitions, b.partitions, b.partitionCount * sizeof(MphPartition));
+    memcpy((void*)ph->remap, b.remap, remapCount * sizeof(uint32_t));
+    uint64_t* dictionary = (uint64_t*)ph->dictionary;
+    uint32_t next = 0;
+    for (uint32_t pilot = 0; pilot < MPH_MAX_PILOT; pilot++) {
+        if (slotOf[pilot] == 0) {
+            slotOf[pilot] = next;
+            dictionary[next++] = mphMix(pilot ^ b.seed);
+        }
+    }
+    uint8_t* packed = (uint8_t*)ph->pilots;
+    for (uint64_t k = 0; k < bucketCount; k++) {
+        uint64_t bit = k * pilotBits, word;
+        memcpy(&word, packed + (bit >> 3), sizeof(word));
+        word |= (uint64_t)slotOf[b.pilots[k]] << (bit & 7);
+        memcpy(packed + (bit >> 3), &word, sizeof(word));
+    }
+    h->checksum = mphChecksum(h);
+    free(slotOf);
+    free(b.partitions);
+    free(b.pilots);
+    free(b.remap);
+    return ph;
+}
+
+double perfectHashBitsPerKey(const PerfectHash* ph) {
+    return ph->header->keyCount ? 8.0 * ph->header->totalBytes / ph->header->keyCount : 0;
+}
+
+// write to "<path>.tmp" and rename, so readers never map a half-written file
+bool savePerfectHash(const PerfectHash* ph, const char* path) {
+    char tempPath[4096];
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", path);
+    FILE* file = fopen(tempPath, "wb");
+    if (!file) {
+        printf("Cannot create %s\n", tempPath);
+        return false;
+    }
+    bool ok = fwrite(ph->image, 1, ph->header->totalBytes, file) == ph->header->totalBytes;
+    ok = fclose(file) == 0 && ok;
+    if (!ok || rename(tempPath, path) != 0) {
+        printf("Cannot write %s\n", path);
+        remove(tempPath);
+        return false;
+    }
+    return true;
+}
+
+// map a saved file read-only and use it in place; verifyChecksum reads the
+// whole image once, the other checks only touch the header, partitions and
+// remap table
+PerfectHash* mapPerfectHash(const char* path, bool verifyChecksum) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Cannot open %s\n", path);
+        return NULL;
+    }
+    struct stat info;
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(PerfectHashHeader)) {
+        mapping = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        printf("Cannot map %s\n", path);
+        return NULL;
+    }
+
+    const PerfectHashHeader* h = (const PerfectHashHeader*)mapping;
+    const char* problem = NULL;
+    if (memcmp(h->magic, MPH_FILE_MAGIC, sizeof(h->magic)) != 0) problem = "not a perfect hash file";
+    else if (h->formatVersion != MPH_FORMAT_VERSION) problem = "unsupported format version";
+    else if (h->hashVersion != MPH_HASH_VERSION) problem = "built with a different hash function";
+    else if (h->endianTag != MPH_ENDIAN_TAG) problem = "written with a different byte order";
+    else if (h->pilotBits == 0 || h->pilotBits > 32 || h->partitionCount == 0 ||
+             h->dictionarySize == 0 || h->dictionarySize > 1ULL << h->pilotBits) problem = "corrupt header";
+    else if (h->totalBytes != (uint64_t)info.st_size || mphImageBytes(h) != h->totalBytes) problem = "truncated or corrupt file";
+    else if (!mphPartitionsValid(h)) problem = "corrupt partition table";
+    else if (verifyChecksum && mphChecksum(h) != h->checksum) problem = "checksum mismatch";
+    if (problem) {
+        printf("%s: %s\n", path, problem);
+        munmap(mapping, info.st_size);
+        return NULL;
+    }
+    return mphAttach(mapping, info.st_size);
+}
+
+void freePerfectHash(PerfectHash* ph) {
+    if (!ph) {
+        return;
+    }
+    if (ph->mappedBytes) {
+        munmap(ph->image, ph->mappedBytes);
+    } else {
+        free(ph->image);
+    }
+    free(ph);
+}
+
+// --- StaticTable: read-only key/value table searched with a single probe ---
+
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+} StaticEntry;
+
+typedef struct {
+    PerfectHash* hash;
+    StaticEntry* entries;
+    size_t count;
+} StaticTable;
+
+// fill a table from a perfect hash already built over keys; the table takes
+// ownership of ph on success, the caller keeps it on failure
+StaticTable* staticTableFromHash(PerfectHash* ph, const uint64_t* keys, const uint64_t* values, size_t n) {
+    StaticTable* table = (StaticTable*)malloc(sizeof(StaticTable));
+    table->entries = (StaticEntry*)malloc((n ? n : 1) * sizeof(StaticEntry));
+    if (!table->entries) {
+        printf("Memory allocation failed!\n");
+        free(table);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) {
+        table->entries[perfectHashLookup(ph, keys[i])] = (StaticEntry){ keys[i], values[i] };
+    }
+    table->hash = ph;
+    table->count = n;
+    return table;
+}
+
+StaticTable* buildStaticTable(const uint64_t* keys, const uint64_t* values, size_t n, int threads) {
+    PerfectHash* ph = buildPerfectHash(keys, n, threads);
+    if (!ph) {
+        return NULL;
+    }
+    StaticTable* table = staticTableFromHash(ph, keys, values, n);
+    if (!table) {
+        freePerfectHash(ph);
+    }
+    return table;
+}
+
+static inline bool staticSearch(const StaticTable* table, uint64_t key, uint64_t* value) {
+    if (table->count == 0) {
+        return false;   // the one entry allocated for an empty table is never written
+    }
+    const StaticEntry* e = &table->entries[perfectHashLookup(table->hash, key)];
+    if (e->key != key) {
+        return false;
+    }
+    *value = e->value;
+    return true;
+}
+
+void freeStaticTable(StaticTable* table) {
+    if (!table) {
+        return;
+    }
+    freePerfectHash(table->hash);
+    free(table->entries);
+    free(table);
+}
+
+void demonstratePerfectHash(void) {
+    printf("\nStaticTable (minimal perfect hash):\n");
+    const char* names[] = {"Apple", "Banana", "Cherry", "Date"};
+    uint64_t keys[] = {1, 2, 12, 22};
+    uint64_t values[] = {0, 1, 2, 3};
+    StaticTable* table = buildStaticTable(keys, values, 4, 1);
+    if (!table) {
+        return;
+    }
+    for (int i = 0; i < 4; i++) {
+        printf("Key %llu -> slot %llu\n", (unsigned long long)keys[i],
+               (unsigned long long)perfectHashLookup(table->hash, keys[i]));
+    }
+    uint64_t value;
+    int probe[] = {2, 5};
+    for (int i = 0; i < 2; i++) {
+        if (staticSearch(table, probe[i], &value)) {
+            printf("Value for key %d: %s\n", probe[i], names[value]);
+        } else {
+            printf("Key %d not found.\n", probe[i]);
+        }
+    }
+    freeStaticTable(table);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: PerfectHash build and query
+// ---------------------------------------------------------------------------
+
+void benchmarkPerfectHash(size_t n) {
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t* keys = (uint64_t*)malloc(n * sizeof(uint64_t));
+    if (!keys || n == 0) {
+        free(keys);
+        printf("Memory allocation failed!\n");
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = mphMix(i * 0x9e3779b97f4a7c15ULL + 12345);    // distinct: mphMix is a bijection
+    }
+
+    printf("\nPerfectHash over %zu keys, %d build thread(s)\n", n, threads);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    PerfectHash* ph = buildPerfectHash(keys, n, threads);
+    double buildSeconds = elapsedSince(start);
+    if (!ph) {
+        free(keys);
+        return;
+    }
+    printf("Build: %.1f s (%.0f ns/key), %.2f bits/key (%llu distinct pilots, %u-bit indexes)\n",
+           buildSeconds, buildSeconds * 1e9 / n, perfectHashBitsPerKey(ph),
+           (unsigned long long)ph->header->dictionarySize, ph->pilotBits);
+
+    // every key must get its own slot
+    uint64_t* seen = (uint64_t*)calloc((n + 63) / 64, sizeof(uint64_t));
+    size_t collisions = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t slot = perfectHashLookup(ph, keys[i]);
+        collisions += slot >= n || (seen[slot >> 6] >> (slot & 63)) & 1;
+        if (slot < n) {
+            seen[slot >> 6] |= 1ULL << (slot & 63);
+        }
+    }
+    free(seen);
+    printf("Slots outside [0, n) or shared: %zu\n", collisions);
+
+    // random-order queries so every lookup misses the cache like a real dictionary
+    size_t queries = n < 10000000 ? n : 10000000;
+    uint64_t* order = (uint64_t*)malloc(queries * sizeof(uint64_t));
+    unsigned seed = 99;
+    for (size_t q = 0; q < queries; q++) {
+        order[q] = keys[(((uint64_t)rand_r(&seed) << 31) ^ rand_r(&seed)) % n];
+    }
+    uint64_t checksum = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t q = 0; q < queries; q++) {
+        checksum += perfectHashLookup(ph, order[q]);
+    }
+    double hashSeconds = elapsedSince(start);
+
+    const char* path = "/tmp/perfect_hash.bin";
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    bool saved = savePerfectHash(ph, path);
+    double saveSeconds = elapsedSince(start);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    PerfectHash* mapped = saved ? mapPerfectHash(path, true) : NULL;
+    double mapSeconds = elapsedSince(start);
+    uint64_t mappedChecksum = 0;
+    if (mapped) {
+        for (size_t q = 0; q < queries; q++) {
+            mappedChecksum += perfectHashLookup(mapped, order[q]);
+        }
+        printf("Save %.2f s, mmap load %.1f us, mapped lookups agree: %s\n", saveSeconds, mapSeconds * 1e6,
+               mappedChecksum == checksum ? "yes" : "NO");
+        uint64_t remapOffset = mapped->partitions[0].remapOffset;
+        long pilotsAt = (long)(mapped->pilots - (const uint8_t*)mapped->image);
+        freePerfectHash(mapped);
+
+        // Corrupt a saved file: the partition checks and the checksum must catch it
+        FILE* file = fopen(path, "r+b");
+        if (file) {
+            uint64_t badOffset = remapOffset ^ (1ULL << 40);
+            fseek(file, sizeof(PerfectHashHeader) + offsetof(MphPartition, remapOffset), SEEK_SET);
+            fwrite(&badOffset, sizeof(badOffset), 1, file);
+            fflush(file);
+            printf("Loading a bad partition table: ");
+            mapped = mapPerfectHash(path, false);
+            if (mapped) printf("loaded (corruption NOT detected)\n");
+            freePerfectHash(mapped);
+
+            fseek(file, sizeof(PerfectHashHeader) + offsetof(MphPartition, remapOffset), SEEK_SET);
+            fwrite(&remapOffset, sizeof(remapOffset), 1, file);
+            fseek(file, pilotsAt, SEEK_SET);
+            int byte = fgetc(file);
+            fseek(file, pilotsAt, SEEK_SET);
+            fputc(byte ^ 0x10, file);
+            fclose(file);
+            printf("Loading a file with a flipped pilot bit: ");
+            mapped = mapPerfectHash(path, true);
+            if (mapped) printf("loaded (corruption NOT detected)\n");
+            freePerfectHash(mapped);
+        }
+        remove(path);
+    }
+
+    // StaticTable over the same hash: slot lookup plus the single probe of the entry
+    uint64_t* values = (uint64_t*)malloc(n * sizeof(uint64_t));
+    if (!values) {
+        printf("Memory allocation failed!\n");
+        freePerfectHash(ph);
+        free(order);
+        free(keys);
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        values[i] = i;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    StaticTable* table = staticTableFromHash(ph, keys, values, n);
+    double fillSeconds = elapsedSince(start);
+    free(values);
+    if (!table) {
+        freePerfectHash(ph);
+    } else {
+        uint64_t value, found = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (size_t q = 0; q < queries; q++) {
+            found += staticSearch(table, order[q], &value);
+        }
+        double searchSeconds = elapsedSince(start);
+        size_t misses = 0;
+        for (uint64_t k = 0; k < 1000000; k++) {
+            misses += !staticSearch(table, k, &value);  // sequential ints are not in the set
+        }
+        printf("StaticTable fill: %.2f s\n", fillSeconds);
+        printf("Query: perfectHashLookup %.1f ns, staticSearch %.1f ns (%llu/%zu found, %zu/1000000 absent keys rejected)\n",
+               hashSeconds * 1e9 / queries, searchSeconds * 1e9 / queries, (unsigned long long)found, queries, misses);
+        freeStaticTable(table);
+    }
+    free(order);
+    free(keys);
+}
+
 int main() {
     // Initialize the hash table
     for (int i = 0; i < TABLE_SIZE; i++) {
@@ -111,5 +2178,30 @@ int main() {
     printf("Hash Table after deletion:\n");
     display();
 
+    // Same operations on the thread-safe map
+    printf("\nConcurrentMap:\n");
+    ConcurrentMap* map = createConcurrentMap(4, 4);
+    cmapPut(map, 1, "Apple");
+    cmapPut(map, 2, "Banana");
+    cmapPut(map, 12, "Cherry");
+    cmapPut(map, 22, "Date");
+    char found[CMAP_VALUE_LENGTH];
+    if (cmapGet(map, 2, found, sizeof(found))) {
+        printf("Value for key 2: %s\n", found);
+    }
+    cmapRemove(map, 12);
+    printf("Key 12 after removal: %s, size %zu\n", cmapGet(map, 12, found, sizeof(found)) ? found : "not found",
+           cmapSize(map));
+    freeConcurrentMap(map);
+
+    verifyConcurrentGrowth(8);
+    benchmarkConcurrentMap();
+
+    demonstrateStringMap();
+    benchmarkStringMap(1000000);
+
+    demonstratePerfectHash();
+    benchmarkPerfectHash(100000000);
+
     return 0;
-}
\ No newline at end of file
+}
@@ -1,7 +1,290 @@
 import java.util.Hashtable;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ThreadLocalRandom;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.LongAdder;
+import java.util.concurrent.locks.StampedLock;
 
 public class HashTableExample {
-    public static void main(String[] args) {
+
+    // Read-scalable replacement for Hashtable. Keys are split into segments by
+    // hash; each segment has its own StampedLock, so writers to different
+    // segments never contend, and readers take no lock at all: they read under
+    // an optimistic stamp and only fall back to the read lock if a writer got
+    // in between. Writers never relink existing nodes (new keys are prepended,
+    // removal copies the nodes in front, growth builds a new array), so an
+    // optimistic reader always walks a finite chain even when it races.
+    static final class StripedMap<K, V> {
+        private static final class Node<K, V> {
+            final int hash;
+            final K key;
+            V value;
+            final Node<K, V> next;
+
+            Node(int hash, K key, V value, Node<K, V> next) {
+                this.hash = hash;
+                this.key = key;
+                this.value = value;
+                this.next = next;
+            }
+        }
+
+        private static final class Segment<K, V> {
+            final StampedLock lock = new StampedLock();
+            Node<K, V>[] table;
+            int count;
+
+            @SuppressWarnings("unchecked")
+            Segment(int capacity) {
+                table = (Node<K, V>[]) new Node[capacity];
+            }
+        }
+
+        private final Segment<K, V>[] segments;
+        private final int segmentShift;
+
+        @SuppressWarnings("unchecked")
+        StripedMap(int expectedEntries, int segmentCount) {
+            int n = 2;
+            while (n < segmentCount) {
+                n <<= 1;
+            }
+            segments = (Segment<K, V>[]) new Segment[n];
+            segmentShift = 32 - Integer.numberOfTrailingZeros(n);
+
+            int perSegment = 16;
+            while (perSegment * 3 / 4 < expectedEntries / n) {
+                perSegment <<= 1;
+            }
+            for (int i = 0; i < n; i++) {
+                segments[i] = new Segment<>(perSegment);
+            }
+        }
+
+        // segment from the top bits, bucket from the bottom bits
+        private static int spread(Object key) {
+            int h = key.hashCode() * 0x9E3779B9;
+            return h ^ (h >>> 16);
+        }
+
+        private Segment<K, V> segmentFor(int hash) {
+            return segments[hash >>> segmentShift];
+        }
+
+        private static <K, V> V find(Node<K, V>[] table, int hash, Object key) {
+            for (Node<K, V> e = table[hash & (table.length - 1)]; e != null; e = e.next) {
+                if (e.hash == hash && e.key.equals(key)) {
+                    return e.value;
+                }
+            }
+            return null;
+        }
+
+        public V get(Object key) {
+            int hash = spread(key);
+            Segment<K, V> s = segmentFor(hash);
+            long stamp = s.lock.tryOptimisticRead();
+            if (stamp != 0) {
+                V value = find(s.table, hash, key);
+                if (s.lock.validate(stamp)) {
+                    return value;
+                }
+            }
+            stamp = s.lock.readLock();
+            try {
+                return find(s.table, hash, key);
+            } finally {
+                s.lock.unlockRead(stamp);
+            }
+        }
+
+        public V put(K key, V value) {
+            int hash = spread(key);
+            Segment<K, V> s = segmentFor(hash);
+            long stamp = s.lock.writeLock();
+            try {
+                Node<K, V>[] table = s.table;
+                int index = hash & (table.length - 1);
+                for (Node<K, V> e = table[index]; e != null; e = e.next) {
+                    if (e.hash == hash && e.key.equals(key)) {
+                        V old = e.value;
+                        e.value = value;
+                        return old;
+                    }
+                }
+                if (s.count + 1 > table.length * 3 / 4) {
+                    table = grow(s);
+                    index = hash & (table.length - 1);
+                }
+                table[index] = new Node<>(hash, key, value, table[index]);
+                s.count++;
+                return null;
+            } finally {
+                s.lock.unlockWrite(stamp);
+            }
+        }
+
+        public V remove(Object key) {
+            int hash = spread(key);
+            Segment<K, V> s = segmentFor(hash);
+            long stamp = s.lock.writeLock();
+            try {
+                Node<K, V>[] table = s.table;
+                int index = hash & (table.length - 1);
+                Node<K, V> head = table[index];
+                for (Node<K, V> e = head; e != null; e = e.next) {
+                    if (e.hash == hash && e.key.equals(key)) {
+                        Node<K, V> rest = e.next;
+                        for (Node<K, V> p = head; p != e; p = p.next) {
+                            rest = new Node<>(p.hash, p.key, p.value, rest);
+                        }
+                        table[index] = rest;
+                        s.count--;
+                        return e.value;
+                    }
+                }
+                return null;
+            } finally {
+                s.lock.unlockWrite(stamp);
+            }
+        }
+
+        // double the segment's array; the caller holds its write lock
+        @SuppressWarnings("unchecked")
+        private Node<K, V>[] grow(Segment<K, V> s) {
+            Node<K, V>[] old = s.table;
+            Node<K, V>[] table = (Node<K, V>[]) new Node[old.length * 2];
+            int mask = table.length - 1;
+            for (Node<K, V> head : old) {
+                for (Node<K, V> e = head; e != null; e = e.next) {
+                    int index = e.hash & mask;
+                    table[index] = new Node<>(e.hash, e.key, e.value, table[index]);
+                }
+            }
+            s.table = table;
+            return table;
+        }
+
+        public int size() {
+            int total = 0;
+            for (Segment<K, V> s : segments) {
+                long stamp = s.lock.readLock();
+                total += s.count;
+                s.lock.unlockRead(stamp);
+            }
+            return total;
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // Benchmark: Hashtable vs ConcurrentHashMap vs StripedMap
+    // ------------------------------------------------------------------
+
+    interface IntMap {
+        String get(Integer key);
+        void put(Integer key, String value);
+        void remove(Integer key);
+    }
+
+    static IntMap wrap(Map<Integer, String> map) {
+        return new IntMap() {
+            public String get(Integer key) { return map.get(key); }
+            public void put(Integer key, String value) { map.put(key, value); }
+            public void remove(Integer key) { map.remove(key); }
+        };
+    }
+
+    static IntMap wrap(StripedMap<Integer, String> map) {
+        return new IntMap() {
+            public String get(Integer key) { return map.get(key); }
+            public void put(Integer key, String value) { map.put(key, value); }
+            public void remove(Integer key) { map.remove(key); }
+        };
+    }
+
+    static final int KEY_SPACE = 1 << 17;
+    static final Integer[] KEYS = new Integer[KEY_SPACE];
+    static final String[] VALUES = new String[KEY_SPACE];
+
+    static IntMap createMap(String kind) {
+        switch (kind) {
+            case "Hashtable": return wrap(new Hashtable<>(KEY_SPACE));
+            case "ConcurrentHashMap": return wrap(new ConcurrentHashMap<>(KEY_SPACE));
+            default: return wrap(new StripedMap<>(KEY_SPACE, 256));
+        }
+    }
+
+    // million operations per second over a fixed duration, half the keys present
+    static double runBenchmark(String kind, int threads, int readPercent, long millis) throws InterruptedException {
+        IntMap map = createMap(kind);
+        for (int k = 0; k < KEY_SPACE; k += 2) {
+            map.put(KEYS[k], VALUES[k]);
+        }
+
+        LongAdder operations = new LongAdder();
+        AtomicBoolean stop = new AtomicBoolean();
+        Thread[] workers = new Thread[threads];
+        for (int t = 0; t < threads; t++) {
+            workers[t] = new Thread(() -> {
+                ThreadLocalRandom random = ThreadLocalRandom.current();
+                long ops = 0;
+                while (!stop.get()) {
+                    for (int batch = 0; batch < 256; batch++) {
+                        int k = random.nextInt(KEY_SPACE);
+                        int roll = random.nextInt(100);
+                        if (roll < readPercent) {
+                            map.get(KEYS[k]);
+                        } else if ((roll & 1) != 0) {
+                            map.put(KEYS[k], VALUES[k]);
+                        } else {
+                            map.remove(KEYS[k]);
+                        }
+                    }
+                    ops += 256;
+                }
+                operations.add(ops);
+            });
+        }
+        for (Thread worker : workers) {
+            worker.start();
+        }
+        Thread.sleep(millis);
+        stop.set(true);
+        for (Thread worker : workers) {
+            worker.join();
+        }
+        return operations.sum() / (millis / 1000.0) / 1e6;
+    }
+
+    static void benchmarkMaps() throws InterruptedException {
+        for (int k = 0; k < KEY_SPACE; k++) {
+            KEYS[k] = k;
+            VALUES[k] = "value-" + k;
+        }
+        String[] kinds = {"Hashtable", "ConcurrentHashMap", "StripedMap"};
+        int[] threadCounts = {1, 2, 4, 8, 16, 32, 64};
+        int[] mixes = {90, 50};
+
+        // warm up the JIT on every implementation first
+        for (String kind : kinds) {
+            runBenchmark(kind, 4, 90, 300);
+        }
+
+        System.out.println(KEY_SPACE + " keys (half present), " + Runtime.getRuntime().availableProcessors()
+                + " CPU(s); million operations per second");
+        System.out.printf("%-8s %-6s %-12s %-18s %-12s%n", "Threads", "Reads", kinds[0], kinds[1], kinds[2]);
+        for (int readPercent : mixes) {
+            for (int threads : threadCounts) {
+                System.out.printf("%-8d %-6d", threads, readPercent);
+                System.out.printf(" %-12.2f", runBenchmark(kinds[0], threads, readPercent, 500));
+                System.out.printf(" %-18.2f", runBenchmark(kinds[1], threads, readPercent, 500));
+                System.out.printf(" %-12.2f%n", runBenchmark(kinds[2], threads, readPercent, 500));
+            }
+        }
+    }
+
+    public static void main(String[] args) throws InterruptedException {
         // Create a Hashtable
         Hashtable<Integer, String> hashtable = new Hashtable<>();
 
@@ -31,5 +314,17 @@ public class HashTableExample {
         // Iterate through the Hashtable
         System.out.println("Iterating through the Hashtable:");
         hashtable.forEach((k, v) -> System.out.println("Key: " + k + ", Value: " + v));
+
+        // The same operations on the read-scalable map
+        StripedMap<Integer, String> striped = new StripedMap<>(4, 4);
+        striped.put(1, "Apple");
+        striped.put(2, "Banana");
+        striped.put(3, "Cherry");
+        striped.put(4, "Date");
+        striped.remove(3);
+        System.out.println("StripedMap: value for key 2: " + striped.get(2) + ", key 3: " + striped.get(3)
+                + ", size " + striped.size());
+
+        benchmarkMaps();
     }
-}
\ No newline at end of file
+}
@@ -3,6 +3,9 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
 
 // Function to create array
 int* createArray(int size) {
@@ -22,22 +25,22 @@ void traverseArray(int* arr, int size) {
 }
 
 // Insertion
+// (the array is exactly `size` long, so each call still reallocates;
+//  use DynArray below for repeated edits)
 int* insertElement(int* arr, int* size, int index, int value) {
     *size += 1; // Increase the array size by 1
     arr = realloc(arr, (*size) * sizeof(int)); //Reallocate memory to fit the new size
-   //Shift elements to the right from the end up to the insertion index
+    // Shift the tail right by one in a single block move
     // This creates space for the new element.
-    for (int i = *size - 1; i > index; i--)
-        arr[i] = arr[i - 1];
+    memmove(arr + index + 1, arr + index, (*size - 1 - index) * sizeof(int));
     arr[index] = value;
     return arr;
 }
 
 // Deletion
 int* deleteElement(int* arr, int* size, int index) {
-    //Shift elements left from the deletion index to overwrite the target
-    for (int i = index; i < *size - 1; i++)
-        arr[i] = arr[i + 1];
+    // Shift the tail left by one in a single block move to overwrite the target
+    memmove(arr + index, arr + index + 1, (*size - 1 - index) * sizeof(int));
     *size -= 1; // reduces the array size by 1
     arr = realloc(arr, (*size) * sizeof(int));//Reallocate memory to fit the new size
     return arr;
@@ -51,11 +54,468 @@ void updateElement(int* arr, int index, int newValue) {
 // Merge
 int* mergeArrays(int* a, int sizeA, int* b, int sizeB) {
     int* merged = malloc((sizeA + sizeB) * sizeof(int));
-    for (int i = 0; i < sizeA; i++) merged[i] = a[i];
-    for (int i = 0; i < sizeB; i++) merged[sizeA + i] = b[i];
+    memcpy(merged, a, sizeA * sizeof(int));          // copy a as one block
+    memcpy(merged + sizeA, b, sizeB * sizeof(int));  // then b right after it
     return merged;
 }
 
+// Merge in place: a and b are SORTED; b is merged into a, which is grown
+// (no new array). Filling from the back never overwrites an unread element
+// of a, because the write position stays at or ahead of a's read position.
+int* mergeArraysInPlace(int* a, int* sizeA, const int* b, int sizeB) {
+    a = realloc(a, (*sizeA + sizeB) * sizeof(int)); // grow a to hold both
+    int i = *sizeA - 1, j = sizeB - 1, k = *sizeA + sizeB - 1;
+    while (j >= 0) {
+        // take from b on ties so equal elements of a stay first (stable)
+        if (i >= 0 && a[i] > b[j]) a[k--] = a[i--];
+        else a[k--] = b[j--];
+    }
+    *sizeA += sizeB;
+    return a;
+}
+
+// Parallel merge of two SORTED arrays into out (merge path)
+// The output is cut into equal slices; a binary search finds where each
+// slice starts in a and b, so every thread merges its slice independently.
+typedef struct MergeSlice {
+    const int* a; int sizeA;
+    const int* b; int sizeB;
+    int* out;
+    int begin, end;    // output positions handled by this thread
+} MergeSlice;
+
+// Number of elements taken from a among the first `diagonal` outputs
+static int mergePathSplit(const int* a, int sizeA, const int* b, int sizeB, int diagonal) {
+    int low = diagonal > sizeB ? diagonal - sizeB : 0;
+    int high = diagonal < sizeA ? diagonal : sizeA;
+    while (low < high) {
+        int i = low + (high - low) / 2;     // take i from a, diagonal - i from b
+        if (a[i] <= b[diagonal - i - 1]) low = i + 1;
+        else high = i;
+    }
+    return low;
+}
+
+static void* mergeSliceWorker(void* arg) {
+    MergeSlice* s = (MergeSlice*)arg;
+    int i = mergePathSplit(s->a, s->sizeA, s->b, s->sizeB, s->begin);
+    int j = s->begin - i;
+    for (int k = s->begin; k < s->end; k++) {
+        // take from a on ties so the merge is stable
+        if (j >= s->sizeB || (i < s->sizeA && s->a[i] <= s->b[j])) s->out[k] = s->a[i++];
+        else s->out[k] = s->b[j++];
+    }
+    return NULL;
+}
+
+int* mergeSortedParallel(const int* a, int sizeA, const int* b, int sizeB, int threads) {
+    int total = sizeA + sizeB;
+    int* out = malloc((total > 0 ? total : 1) * sizeof(int));
+    if (threads < 1) threads = 1;
+    pthread_t* ids = malloc(threads * sizeof(pthread_t));
+    MergeSlice* slices = malloc(threads * sizeof(MergeSlice));
+    for (int t = 0; t < threads; t++) {
+        slices[t] = (MergeSlice){ a, sizeA, b, sizeB, out,
+                                  (int)((long long)total * t / threads),
+                                  (int)((long long)total * (t + 1) / threads) };
+        pthread_create(&ids[t], NULL, mergeSliceWorker, &slices[t]);
+    }
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    free(ids);
+    free(slices);
+    return out;
+}
+
+// 🔹 Dynamic Array Engine
+// One interface, three storage modes:
+//   ARRAY_FLAT   - contiguous, capacity doubles, edits shift with memmove
+//   ARRAY_GAP    - gap buffer: free space sits at the last edit position, so
+//                  edits near a moving cursor only move the distance moved
+//   ARRAY_PIECES - piece table: the original data is never moved; inserts go
+//                  to an append-only buffer and edits only split/add pieces.
+//                  Pieces are kept in chunks of up to 128, so an edit moves at
+//                  most one chunk's pieces no matter how large the array is.
+typedef enum { ARRAY_FLAT, ARRAY_GAP, ARRAY_PIECES } ArrayMode;
+
+#define PIECES_PER_CHUNK 128
+
+typedef struct Piece {
+    size_t start;      // offset in the source buffer
+    size_t length;
+    int fromAdded;     // 0 = original buffer, 1 = added buffer
+} Piece;
+
+typedef struct PieceChunk {
+    size_t length;     // total elements covered by this chunk's pieces
+    int count;
+    Piece pieces[PIECES_PER_CHUNK];
+} PieceChunk;
+
+typedef struct DynArray {
+    ArrayMode mode;
+    size_t size;                 // number of elements
+    // FLAT and GAP
+    int* data;
+    size_t capacity;
+    size_t gapStart, gapEnd;     // GAP: data[gapStart..gapEnd) is free
+    // PIECES
+    int* original;
+    int* added;
+    size_t addedSize, addedCapacity;
+    PieceChunk** chunks;
+    size_t chunkCount, chunkCapacity;
+    size_t cacheChunk, cacheStart;   // last chunk found and its first position
+} DynArray;
+
+// Grow a buffer geometrically so it holds at least `needed` elements
+static void* growBuffer(void* buffer, size_t* capacity, size_t needed, size_t elementSize) {
+    if (needed <= *capacity) return buffer;
+    size_t newCapacity = *capacity ? *capacity : 16;
+    while (newCapacity < needed) newCapacity *= 2;   // doubling: amortized O(1) per element
+    buffer = realloc(buffer, newCapacity * elementSize);
+    if (!buffer) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    *capacity = newCapacity;
+    return buffer;
+}
+
+// PIECES: insert an empty chunk at index c
+static PieceChunk* insertChunk(DynArray* arr, size_t c) {
+    arr->chunks = growBuffer(arr->chunks, &arr->chunkCapacity, arr->chunkCount + 1, sizeof(PieceChunk*));
+    memmove(arr->chunks + c + 1, arr->chunks + c, (arr->chunkCount - c) * sizeof(PieceChunk*));
+    PieceChunk* chunk = calloc(1, sizeof(PieceChunk));
+    arr->chunks[c] = chunk;
+    arr->chunkCount++;
+    return chunk;
+}
+
+// Create a dynamic array in the given mode, holding a copy of values[0..n)
+DynArray* createDynArray(ArrayMode mode, const int* values, size_t n) {
+    DynArray* arr = calloc(1, sizeof(DynArray));
+    arr->mode = mode;
+    arr->size = n;
+    if (mode == ARRAY_PIECES) {
+        arr->original = malloc((n ? n : 1) * sizeof(int));
+        memcpy(arr->original, values, n * sizeof(int));
+        PieceChunk* chunk = insertChunk(arr, 0);      // always at least one chunk
+        if (n > 0) {
+            chunk->pieces[chunk->count++] = (Piece){ 0, n, 0 };
+            chunk->length = n;
+        }
+    } else {
+        arr->data = growBuffer(NULL, &arr->capacity, n ? n : 16, sizeof(int));
+        memcpy(arr->data, values, n * sizeof(int));
+        arr->gapStart = n;                 // gap starts empty, at the end
+        arr->gapEnd = arr->capacity;
+    }
+    return arr;
+}
+
+void freeDynArray(DynArray* arr) {
+    for (size_t c = 0; c < arr->chunkCount; c++) free(arr->chunks[c]);
+    free(arr->chunks);
+    free(arr->data);
+    free(arr->original);
+    free(arr->added);
+    free(arr);
+}
+
+// GAP: move the gap so it starts at position pos
+static void moveGap(DynArray* arr, size_t pos) {
+    if (pos < arr->gapStart) {
+        size_t count = arr->gapStart - pos;    // elements jump from before to after the gap
+        memmove(arr->data + arr->gapEnd - count, arr->data + pos, count * sizeof(int));
+        arr->gapStart = pos;
+        arr->gapEnd -= count;
+    } else if (pos > arr->gapStart) {
+        size_t count = pos - arr->gapStart;    // elements jump from after to before the gap
+        memmove(arr->data + arr->gapStart, arr->data + arr->gapEnd, count * sizeof(int));
+        arr->gapStart = pos;
+        arr->gapEnd += count;
+    }
+}
+
+// GAP: make the gap at least n elements wide (capacity doubles)
+static void ensureGap(DynArray* arr, size_t n) {
+    if (arr->gapEnd - arr->gapStart >= n) return;
+    size_t tail = arr->capacity - arr->gapEnd;
+    size_t oldCapacity = arr->capacity;
+    arr->data = growBuffer(arr->data, &arr->capacity, arr->size + n, sizeof(int));
+    // keep the elements after the gap at the very end of the larger buffer
+    memmove(arr->data + arr->capacity - tail, arr->data + oldCapacity - tail, tail * sizeof(int));
+    arr->gapEnd = arr->capacity - tail;
+}
+
+// PIECES: index of the chunk containing position pos (the last chunk for
+// pos == size) and its first position in *chunkStart. Walks from the chunk
+// used last, so edits near each other don't rescan from the front.
+static size_t findChunk(DynArray* arr, size_t pos, size_t* chunkStart) {
+    size_t c = arr->cacheChunk, start = arr->cacheStart;
+    if (c >= arr->chunkCount) { c = 0; start = 0; }
+    while (start > pos) start -= arr->chunks[--c]->length;
+    while (c + 1 < arr->chunkCount && start + arr->chunks[c]->length <= pos) {
+        start += arr->chunks[c]->length;
+        c++;
+    }
+    arr->cacheChunk = c;
+    arr->cacheStart = start;
+    *chunkStart = start;
+    return c;
+}
+
+// PIECES: split a full chunk in half; the cache stays valid (chunk c keeps its start)
+static void splitChunk(DynArray* arr, size_t c) {
+    PieceChunk* left = arr->chunks[c];
+    PieceChunk* right = insertChunk(arr, c + 1);
+    int half = left->count / 2;
+    right->count = left->count - half;
+    memcpy(right->pieces, left->pieces + half, right->count * sizeof(Piece));
+    left->count = half;
+    right->length = 0;
+    for (int i = 0; i < right->count; i++) right->length += right->pieces[i].length;
+    left->length -= right->length;
+}
+
+// PIECES: make a piece boundary fall at pos; returns the chunk and (in *slot)
+// the index of the piece that starts at pos (== count when pos ends the chunk)
+static size_t splitAt(DynArray* arr, size_t pos, int* slot) {
+    size_t start;
+    size_t c = findChunk(arr, pos, &start);
+    PieceChunk* chunk = arr->chunks[c];
+    int i = 0;
+    while (i < chunk->count && start + chunk->pieces[i].length <= pos) {
+        start += chunk->pieces[i].length;
+        i++;
+    }
+    if (i == chunk->count || start == pos) {
+        *slot = i;
+        return c;
+    }
+    if (chunk->count == PIECES_PER_CHUNK) {
+        splitChunk(arr, c);
+        return splitAt(arr, pos, slot);
+    }
+    // cut piece i into [start, pos) and [pos, end)
+    memmove(chunk->pieces + i + 2, chunk->pieces + i + 1, (chunk->count - i - 1) * sizeof(Piece));
+    Piece whole = chunk->pieces[i];
+    size_t cut = pos - start;
+    chunk->pieces[i].length = cut;
+    chunk->pieces[i + 1] = (Piece){ whole.start + cut, whole.length - cut, whole.fromAdded };
+    chunk->count++;
+    *slot = i + 1;
+    return c;
+}
+
+// Bulk insert: values[0..n) go in before position pos (0..size)
+void dynInsertRange(DynArray* arr, size_t pos, const int* values, size_t n) {
+    if (n == 0) return;
+    if (pos > arr->size) pos = arr->size;
+    if (arr->mode == ARRAY_FLAT) {
+        arr->data = growBuffer(arr->data, &arr->capacity, arr->size + n, sizeof(int));
+        memmove(arr->data + pos + n, arr->data + pos, (arr->size - pos) * sizeof(int));
+        memcpy(arr->data + pos, values, n * sizeof(int));
+    } else if (arr->mode == ARRAY_GAP) {
+        ensureGap(arr, n);
+        moveGap(arr, pos);
+        memcpy(arr->data + arr->gapStart, values, n * sizeof(int));
+        arr->gapStart += n;
+    } else {
+        size_t addedAt = arr->addedSize;
+        arr->added = growBuffer(arr->added, &arr->addedCapacity, arr->addedSize + n, sizeof(int));
+        memcpy(arr->added + addedAt, values, n * sizeof(int));
+        arr->addedSize += n;
+
+        int i;
+        size_t c = splitAt(arr, pos, &i);
+        PieceChunk* chunk = arr->chunks[c];
+        Piece* before = i > 0 ? &chunk->pieces[i - 1] : NULL;
+        if (before && before->fromAdded && before->start + before->length == addedAt) {
+            before->length += n;         // typing after the previous insert extends it
+        } else {
+            if (chunk->count == PIECES_PER_CHUNK) {
+                splitChunk(arr, c);
+                c = splitAt(arr, pos, &i);
+                chunk = arr->chunks[c];
+            }
+            memmove(chunk->pieces + i + 1, chunk->pieces + i, (chunk->count - i) * sizeof(Piece));
+            chunk->pieces[i] = (Piece){ addedAt, n, 1 };
+            chunk->count++;
+        }
+        chunk->length += n;
+    }
+    arr->size += n;
+}
+
+// Bulk delete: remove n elements starting at position pos
+void dynDeleteRange(DynArray* arr, size_t pos, size_t n) {
+    if (pos >= arr->size) return;
+    if (n > arr->size - pos) n = arr->size - pos;
+    arr->size -= n;
+    if (arr->mode == ARRAY_FLAT) {
+        memmove(arr->data + pos, arr->data + pos + n, (arr->size - pos) * sizeof(int));
+    } else if (arr->mode == ARRAY_GAP) {
+        moveGap(arr, pos);
+        arr->gapEnd += n;                  // the deleted elements simply join the gap
+    } else {
+        while (n > 0) {
+            int i;
+            size_t c = splitAt(arr, pos, &i);
+            PieceChunk* chunk = arr->chunks[c];
+            if (i == chunk->count) {       // boundary ends this chunk: continue in the next
+                c++;
+                chunk = arr->chunks[c];
+                i = 0;
+                arr->cacheChunk = c;
+                arr->cacheStart = pos;
+            }
+            Piece* p = &chunk->pieces[i];
+            size_t take = p->length < n ? p->length : n;
+            if (take == p->length) {       // whole piece goes
+                memmove(chunk->pieces + i, chunk->pieces + i + 1, (chunk->count - i - 1) * sizeof(Piece));
+                chunk->count--;
+            } else {                       // trim the front of the piece
+                p->start += take;
+                p->length -= take;
+            }
+            chunk->length -= take;
+            n -= take;
+            if (chunk->count == 0 && arr->chunkCount > 1) {
+                free(chunk);
+                memmove(arr->chunks + c, arr->chunks + c + 1, (arr->chunkCount - c - 1) * sizeof(PieceChunk*));
+                arr->chunkCount--;
+                arr->cacheChunk = 0;
+                arr->cacheStart = 0;
+            }
+        }
+    }
+}
+
+// Read the element at position i
+int dynGet(DynArray* arr, size_t i) {
+    if (arr->mode == ARRAY_FLAT) return arr->data[i];
+    if (arr->mode == ARRAY_GAP) return i < arr->gapStart ? arr->data[i] : arr->data[i + arr->gapEnd - arr->gapStart];
+    size_t start;
+    PieceChunk* chunk = arr->chunks[findChunk(arr, i, &start)];
+    int k = 0;
+    while (start + chunk->pieces[k].length <= i) start += chunk->pieces[k++].length;
+    Piece* p = &chunk->pieces[k];
+    return (p->fromAdded ? arr->added : arr->original)[p->start + i - start];
+}
+
+// Copy all elements, in order, into out
+void dynToArray(DynArray* arr, int* out) {
+    if (arr->mode == ARRAY_FLAT) {
+        memcpy(out, arr->data, arr->size * sizeof(int));
+    } else if (arr->mode == ARRAY_GAP) {
+        memcpy(out, arr->data, arr->gapStart * sizeof(int));
+        memcpy(out + arr->gapStart, arr->data + arr->gapEnd, (arr->capacity - arr->gapEnd) * sizeof(int));
+    } else {
+        for (size_t c = 0; c < arr->chunkCount; c++) {
+            for (int i = 0; i < arr->chunks[c]->count; i++) {
+                Piece* p = &arr->chunks[c]->pieces[i];
+                memcpy(out, (p->fromAdded ? arr->added : arr->original) + p->start, p->length * sizeof(int));
+                out += p->length;
+            }
+        }
+    }
+}
+
+// Print a dynamic array like traverseArray does
+void traverseDynArray(DynArray* arr) {
+    printf("Array elements: ");
+    for (size_t i = 0; i < arr->size; i++)
+    printf("%d ", dynGet(arr, i));
+    printf("\n");
+}
+
+// Benchmark: edits near a moving cursor, then edits at random positions
+static double secondsSince(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static unsigned long long benchState = 88172645463325252ULL;
+static size_t benchRandom(size_t bound) {
+    benchState ^= benchState << 13;
+    benchState ^= benchState >> 7;
+    benchState ^= benchState << 17;
+    return (size_t)(benchState % bound);
+}
+
+// Apply `edits` inserts/deletes; the cursor drifts by at most `drift` per edit
+static double runEdits(ArrayMode mode, int legacy, const int* initial, size_t n,
+                       size_t edits, size_t drift, long long* checksum) {
+    benchState = 88172645463325252ULL;            // same edit sequence for every mode
+    DynArray* arr = legacy ? NULL : createDynArray(mode, initial, n);
+    int* plain = NULL;
+    int plainSize = (int)n;
+    if (legacy) {
+        plain = malloc(n * sizeof(int));
+        memcpy(plain, initial, n * sizeof(int));
+    }
+    size_t size = n, cursor = n / 2;
+    int chunk[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    clock_t start = clock();
+    for (size_t e = 0; e < edits; e++) {
+        size_t step = drift ? benchRandom(2 * drift + 1) : benchRandom(size + 1);
+        cursor = drift ? (cursor + step >= drift ? cursor + step - drift : 0) : step;
+        if (cursor > size) cursor = size;
+        if (e % 3 != 2) {
+            if (legacy) plain = insertElement(plain, &plainSize, (int)cursor, (int)e);
+            else dynInsertRange(arr, cursor, chunk, 1 + e % 8);
+            size += legacy ? 1 : 1 + e % 8;
+        } else if (cursor < size) {
+            if (legacy) plain = deleteElement(plain, &plainSize, (int)cursor);
+            else dynDeleteRange(arr, cursor, 4);
+            size -= legacy ? 1 : (size - cursor < 4 ? size - cursor : 4);
+        }
+    }
+    double seconds = secondsSince(start);
+
+    long long sum = 0;
+    int* out = malloc((size ? size : 1) * sizeof(int));
+    if (legacy) memcpy(out, plain, size * sizeof(int));
+    else dynToArray(arr, out);
+    for (size_t i = 0; i < size; i++) sum = sum * 31 + out[i];
+    *checksum = sum;
+    free(out);
+    free(plain);
+    if (arr) freeDynArray(arr);
+    return seconds;
+}
+
+void benchmarkDynArray(size_t n) {
+    int* initial = malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) initial[i] = (int)i;
+    const char* names[] = { "flat (memmove)", "gap buffer", "piece table" };
+    long long checksum[3], legacySum;
+
+    // Correctness: the same edit sequence must give the same array in every mode
+    size_t small = n < 100000 ? n : 100000;
+    int agree = 1;
+    for (int drift = 0; drift <= 64; drift += 64) {
+        for (int m = 0; m < 3; m++) runEdits((ArrayMode)m, 0, initial, small, 20000, drift, &checksum[m]);
+        agree &= checksum[0] == checksum[1] && checksum[1] == checksum[2];
+    }
+    printf("\nAll modes agree on %zu-element edit sequences: %s\n", small, agree ? "yes" : "NO");
+
+    // Timing on the full array; slow modes run fewer edits (reported per edit)
+    size_t cursorEdits[] = { 200, 200000, 200000 };
+    size_t randomEdits[] = { 200, 200, 200000 };
+    printf("Edits on %zu elements (microseconds per edit):\n", n);
+    printf("  %-30s %14s %14s\n", "", "cursor (+-64)", "random");
+    double legacy = runEdits(ARRAY_FLAT, 1, initial, n, 200, 64, &legacySum);
+    printf("  %-30s %14.2f %14s\n", "insertElement/deleteElement", legacy * 1e6 / 200, "-");
+    for (int m = 0; m < 3; m++) {
+        double cursor = runEdits((ArrayMode)m, 0, initial, n, cursorEdits[m], 64, &checksum[m]);
+        double random = runEdits((ArrayMode)m, 0, initial, n, randomEdits[m], 0, &checksum[m]);
+        printf("  %-30s %14.2f %14.2f\n", names[m], cursor * 1e6 / cursorEdits[m], random * 1e6 / randomEdits[m]);
+    }
+    free(initial);
+}
+
 // 🔹 Bubble Sort
 void bubbleSort(int* arr, int size) {
     for (int i = 0; i < size - 1; i++)
@@ -178,6 +638,32 @@ int main() {
 
     printf("Binary search for 20: index %d\n", binarySearch(merged, size + 3, 20));
 
+    // In-place merge of two sorted arrays: b is merged into arr without a new array
+    bubbleSort(arr, size);
+    arr = mergeArraysInPlace(arr, &size, b, 3);
+    traverseArray(arr, size);
+
+    // Parallel merge of two sorted arrays
+    int sortedA[] = {1, 4, 9, 16, 25};
+    int sortedB[] = {2, 3, 5, 7, 11, 13};
+    int* both = mergeSortedParallel(sortedA, 5, sortedB, 6, 3);
+    traverseArray(both, 11);
+    free(both);
+
+    // Dynamic array engine: the same edits in every mode
+    int start[] = {1, 2, 3, 4, 5};
+    int extra[] = {40, 41, 42};
+    for (int m = 0; m < 3; m++) {
+        DynArray* dyn = createDynArray((ArrayMode)m, start, 5);
+        dynInsertRange(dyn, 2, extra, 3);   // 1 2 40 41 42 3 4 5
+        dynDeleteRange(dyn, 4, 2);          // 1 2 40 41 4 5
+        dynInsertRange(dyn, 6, extra, 1);   // 1 2 40 41 4 5 40
+        traverseDynArray(dyn);
+        freeDynArray(dyn);
+    }
+
+    benchmarkDynArray(10000000);
+
     free(arr);
     free(merged);
     return 0;
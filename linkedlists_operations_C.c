@@ -1,7 +1,14 @@
-C Implementation
+// C Implementation
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // Define the ListNode structure
 typedef struct ListNode {
@@ -31,6 +38,18 @@ void insertEnd(ListNode** head, int val) {
     temp->next = newNode;
 }
 
+// Function to append after a known tail in O(1); returns the new tail
+// (insertEnd walks the whole list, so building n nodes with it is O(n^2))
+ListNode* appendNode(ListNode** head, ListNode* tail, int val) {
+    ListNode* newNode = createNode(val);
+    if (tail == NULL) {
+        *head = newNode;
+    } else {
+        tail->next = newNode;
+    }
+    return newNode;
+}
+
 // Function to delete a node by value
 void deleteNode(ListNode** head, int val) {
     ListNode* temp = *head;
@@ -74,6 +93,391 @@ int search(ListNode* head, int val) {
     return 0; // Not found
 }
 
+// Function to free every node
+void freeList(ListNode* head) {
+    while (head) {
+        ListNode* next = head->next;
+        free(head);
+        head = next;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Unrolled linked list
+// ---------------------------------------------------------------------------
+// Each block is one 64-byte cache line holding up to 12 ints, so a scan touches
+// one line per 12 values instead of one (malloc'd, scattered) node per value.
+// Blocks come from slabs of a pool and are recycled through a free list.
+
+#define BLOCK_VALUES 12
+#define SLAB_BLOCKS 4096
+
+typedef struct UnrolledBlock {
+    struct UnrolledBlock* next;
+    int count;
+    int reserved;              // keeps vals 16-byte aligned for SIMD loads
+    int vals[BLOCK_VALUES];
+} UnrolledBlock;
+
+_Static_assert(sizeof(UnrolledBlock) == 64, "a block must fill exactly one cache line");
+
+// Slab allocator for blocks; several lists may share one pool
+typedef struct BlockPool {
+    UnrolledBlock* freeList;
+    void** slabs;
+    size_t slabCount;
+    size_t slabCapacity;
+} BlockPool;
+
+typedef struct UnrolledList {
+    UnrolledBlock* head;
+    UnrolledBlock* tail;       // O(1) append
+    size_t size;
+    BlockPool* pool;
+} UnrolledList;
+
+// Function to create an empty block pool
+BlockPool* createBlockPool() {
+    BlockPool* pool = (BlockPool*)calloc(1, sizeof(BlockPool));
+    if (!pool) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    return pool;
+}
+
+// Function to take a block from the pool, carving a new slab when empty
+UnrolledBlock* allocBlock(BlockPool* pool) {
+    if (pool->freeList == NULL) {
+        UnrolledBlock* slab = (UnrolledBlock*)aligned_alloc(64, SLAB_BLOCKS * sizeof(UnrolledBlock));
+        if (!slab) {
+            printf("Memory allocation failed\n");
+            exit(1);
+        }
+        if (pool->slabCount == pool->slabCapacity) {
+            pool->slabCapacity = pool->slabCapacity ? pool->slabCapacity * 2 : 16;
+            pool->slabs = (void**)realloc(pool->slabs, pool->slabCapacity * sizeof(void*));
+        }
+        pool->slabs[pool->slabCount++] = slab;
+        for (int i = SLAB_BLOCKS - 1; i >= 0; i--) {
+            slab[i].next = pool->freeList;
+            pool->freeList = &slab[i];
+        }
+    }
+    UnrolledBlock* block = pool->freeList;
+    pool->freeList = block->next;
+    block->next = NULL;
+    block->count = 0;
+    return block;
+}
+
+// Function to return a block to the pool for reuse
+void releaseBlock(BlockPool* pool, UnrolledBlock* block) {
+    block->next = pool->freeList;
+    pool->freeList = block;
+}
+
+// Function to free the pool and every block it handed out
+void freeBlockPool(BlockPool* pool) {
+    for (size_t i = 0; i < pool->slabCount; i++) {
+        free(pool->slabs[i]);
+    }
+    free(pool->slabs);
+    free(pool);
+}
+
+// Function to create an empty unrolled list backed by a pool
+UnrolledList* createUnrolledList(BlockPool* pool) {
+    UnrolledList* list = (UnrolledList*)malloc(sizeof(UnrolledList));
+    if (!list) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    list->head = list->tail = NULL;
+    list->size = 0;
+    list->pool = pool;
+    return list;
+}
+
+// Function to return all blocks to the pool and free the list
+void freeUnrolledList(UnrolledList* list) {
+    UnrolledBlock* block = list->head;
+    while (block) {
+        UnrolledBlock* next = block->next;
+        releaseBlock(list->pool, block);
+        block = next;
+    }
+    free(list);
+}
+
+// Function to append one value in O(1)
+void unrolledAppend(UnrolledList* list, int val) {
+    if (list->tail == NULL || list->tail->count == BLOCK_VALUES) {
+        UnrolledBlock* block = allocBlock(list->pool);
+        if (list->tail) list->tail->next = block;
+        else list->head = block;
+        list->tail = block;
+    }
+    list->tail->vals[list->tail->count++] = val;
+    list->size++;
+}
+
+// Function to write values after `block` (filling it first), creating full
+// blocks as needed; returns the last block written
+static UnrolledBlock* fillBlocks(BlockPool* pool, UnrolledBlock* block, const int* values, size_t n) {
+    while (n > 0) {
+        if (block->count == BLOCK_VALUES) {
+            UnrolledBlock* fresh = allocBlock(pool);
+            fresh->next = block->next;
+            block->next = fresh;
+            block = fresh;
+        }
+        size_t room = BLOCK_VALUES - block->count;
+        size_t take = n < room ? n : room;
+        memcpy(block->vals + block->count, values, take * sizeof(int));
+        block->count += (int)take;
+        values += take;
+        n -= take;
+    }
+    return block;
+}
+
+// Function to insert n values so the first lands at `position` (0..size)
+void unrolledInsertRange(UnrolledList* list, size_t position, const int* values, size_t n) {
+    if (n == 0) return;
+    if (position > list->size) position = list->size;
+    if (list->head == NULL) {
+        list->head = list->tail = allocBlock(list->pool);
+    }
+
+    // Find the block holding `position`
+    UnrolledBlock* block = list->head;
+    size_t offset = position;
+    if (position == list->size) {
+        block = list->tail;
+        offset = block->count;
+    } else {
+        while (offset >= (size_t)block->count) {
+            offset -= block->count;
+            block = block->next;
+        }
+    }
+
+    // Split: keep [0, offset) in place, re-append the rest after the new values
+    int saved[BLOCK_VALUES];
+    int savedCount = block->count - (int)offset;
+    memcpy(saved, block->vals + offset, savedCount * sizeof(int));
+    block->count = (int)offset;
+
+    bool wasTail = block == list->tail;
+    UnrolledBlock* last = fillBlocks(list->pool, block, values, n);
+    last = fillBlocks(list->pool, last, saved, savedCount);
+    if (wasTail) list->tail = last;
+    list->size += n;
+}
+
+// Function to find the first slot in a block equal to val, or -1
+static int blockFind(const UnrolledBlock* block, int val) {
+#if defined(__SSE2__)
+    __m128i key = _mm_set1_epi32(val);
+    const __m128i* v = (const __m128i*)block->vals;
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_load_si128(v), key)))
+             | _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_load_si128(v + 1), key))) << 4
+             | _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_load_si128(v + 2), key))) << 8;
+    mask &= (1 << block->count) - 1;   // ignore unused slots
+    return mask ? __builtin_ctz(mask) : -1;
+#else
+    for (int i = 0; i < block->count; i++) {
+        if (block->vals[i] == val) return i;
+    }
+    return -1;
+#endif
+}
+
+// Function to search for a value; returns 1 if found
+int unrolledSearch(UnrolledList* list, int val) {
+    for (UnrolledBlock* block = list->head; block; block = block->next) {
+        if (blockFind(block, val) >= 0) return 1;
+    }
+    return 0;
+}
+
+// Function to delete the first occurrence of a value; returns 1 if deleted
+int unrolledDelete(UnrolledList* list, int val) {
+    UnrolledBlock* prev = NULL;
+    for (UnrolledBlock* block = list->head; block; prev = block, block = block->next) {
+        int slot = blockFind(block, val);
+        if (slot < 0) continue;
+
+        memmove(block->vals + slot, block->vals + slot + 1, (block->count - slot - 1) * sizeof(int));
+        block->count--;
+        list->size--;
+
+        UnrolledBlock* next = block->next;
+        if (block->count == 0) {
+            // Unlink the empty block
+            if (prev) prev->next = next;
+            else list->head = next;
+            if (list->tail == block) list->tail = prev;
+            releaseBlock(list->pool, block);
+        } else if (next && block->count + next->count <= BLOCK_VALUES / 2 + BLOCK_VALUES / 4) {
+            // Merge with a sparse neighbour so blocks stay reasonably full
+            memcpy(block->vals + block->count, next->vals, next->count * sizeof(int));
+            block->count += next->count;
+            block->next = next->next;
+            if (list->tail == next) list->tail = block;
+            releaseBlock(list->pool, next);
+        }
+        return 1;
+    }
+    return 0;
+}
+
+// Function to delete every value matching a predicate in one pass;
+// survivors are compacted into full blocks. Returns the number deleted.
+size_t unrolledDeleteIf(UnrolledList* list, int (*predicate)(int val, void* context), void* context) {
+    UnrolledBlock* write = list->head;
+    int writeCount = 0;
+    size_t removed = 0;
+
+    for (UnrolledBlock* read = list->head; read; read = read->next) {
+        for (int i = 0; i < read->count; i++) {
+            int v = read->vals[i];
+            if (predicate(v, context)) {
+                removed++;
+                continue;
+            }
+            if (writeCount == BLOCK_VALUES) {
+                write->count = writeCount;
+                write = write->next;   // never passes `read`: writes trail reads
+                writeCount = 0;
+            }
+            write->vals[writeCount++] = v;
+        }
+    }
+
+    if (list->head == NULL) return 0;
+    if (removed == list->size) {
+        write = NULL;               // everything deleted
+    } else {
+        write->count = writeCount;
+    }
+
+    // Release the blocks past the last one written
+    UnrolledBlock* rest = write ? write->next : list->head;
+    while (rest) {
+        UnrolledBlock* next = rest->next;
+        releaseBlock(list->pool, rest);
+        rest = next;
+    }
+    if (write) write->next = NULL;
+    else list->head = NULL;
+    list->tail = write;
+    list->size -= removed;
+    return removed;
+}
+
+// Function to print the unrolled list, one bracketed block at a time
+void printUnrolledList(UnrolledList* list) {
+    for (UnrolledBlock* block = list->head; block; block = block->next) {
+        printf("[");
+        for (int i = 0; i < block->count; i++) {
+            printf(i ? " %d" : "%d", block->vals[i]);
+        }
+        printf("] -> ");
+    }
+    printf("NULL\n");
+}
+
+static int isEven(int val, void* context) {
+    (void)context;
+    return val % 2 == 0;
+}
+
+static double secondsSince(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// Benchmark the singly-linked list against the unrolled list
+void benchmarkLists(size_t n) {
+    int* values = (int*)malloc(n * sizeof(int));
+    for (size_t i = 0; i < n; i++) values[i] = (int)i;
+    int searches = 10;
+    clock_t start;
+
+    printf("\nBenchmark with %zu elements\n", n);
+    printf("%-28s %12s %12s\n", "", "singly", "unrolled");
+
+    // Build (singly: appendNode with a tail, since insertEnd would be O(n^2))
+    start = clock();
+    ListNode* head = NULL;
+    ListNode* tail = NULL;
+    for (size_t i = 0; i < n; i++) tail = appendNode(&head, tail, values[i]);
+    double singlyBuild = secondsSince(start);
+
+    BlockPool* pool = createBlockPool();
+    start = clock();
+    UnrolledList* list = createUnrolledList(pool);
+    for (size_t i = 0; i < n; i++) unrolledAppend(list, values[i]);
+    double unrolledAppendTime = secondsSince(start);
+    freeUnrolledList(list);
+
+    start = clock();
+    list = createUnrolledList(pool);   // reuses the blocks released above
+    unrolledInsertRange(list, 0, values, n);
+    double unrolledBuild = secondsSince(start);
+    printf("%-28s %10.1fms %10.1fms\n", "build (append one by one)", singlyBuild * 1e3, unrolledAppendTime * 1e3);
+    printf("%-28s %12s %10.1fms\n", "build (insertRange)", "-", unrolledBuild * 1e3);
+
+    // Search for absent values: full scans
+    start = clock();
+    int found = 0;
+    for (int s = 0; s < searches; s++) found += search(head, -1 - s);
+    double singlySearch = secondsSince(start) / searches;
+    start = clock();
+    for (int s = 0; s < searches; s++) found += unrolledSearch(list, -1 - s);
+    double unrolledSearchTime = secondsSince(start) / searches;
+    printf("%-28s %10.1fms %10.1fms\n", "search (full scan)", singlySearch * 1e3, unrolledSearchTime * 1e3);
+
+    // Delete a value near the end
+    start = clock();
+    deleteNode(&head, (int)(n - 2));
+    double singlyDelete = secondsSince(start);
+    start = clock();
+    unrolledDelete(list, (int)(n - 2));
+    double unrolledDeleteTime = secondsSince(start);
+    printf("%-28s %10.1fms %10.1fms\n", "delete one (near end)", singlyDelete * 1e3, unrolledDeleteTime * 1e3);
+
+    // Delete all even values (singly: best single pass with a pointer-to-pointer)
+    start = clock();
+    size_t singlyRemoved = 0;
+    for (ListNode** link = &head; *link;) {
+        if ((*link)->val % 2 == 0) {
+            ListNode* dead = *link;
+            *link = dead->next;
+            free(dead);
+            singlyRemoved++;
+        } else {
+            link = &(*link)->next;
+        }
+    }
+    double singlyDeleteIf = secondsSince(start);
+    start = clock();
+    size_t unrolledRemoved = unrolledDeleteIf(list, isEven, NULL);
+    double unrolledDeleteIfTime = secondsSince(start);
+    printf("%-28s %10.1fms %10.1fms\n", "deleteIf (all even)", singlyDeleteIf * 1e3, unrolledDeleteIfTime * 1e3);
+
+    printf("%-28s %10.1fMB %10.1fMB\n", "node/block memory",
+           n * sizeof(ListNode) / 1e6, (n + BLOCK_VALUES - 1) / BLOCK_VALUES * sizeof(UnrolledBlock) / 1e6);
+    printf("Removed %zu / %zu, %zu left, found %d (expected 0)\n",
+           singlyRemoved, unrolledRemoved, list->size, found);
+
+    freeList(head);
+    freeUnrolledList(list);
+    freeBlockPool(pool);
+    free(values);
+}
+
 // Main function to demonstrate linked list operations
 int main() {
     ListNode* head = NULL;
@@ -97,5 +501,25 @@ int main() {
     deleteNode(&head, 1);
     deleteNode(&head, 3);
 
+    // Unrolled list: same operations plus the bulk API
+    BlockPool* pool = createBlockPool();
+    UnrolledList* list = createUnrolledList(pool);
+    int first[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14 };
+    unrolledInsertRange(list, 0, first, 14);
+    printUnrolledList(list);
+
+    int middle[] = { 100, 101, 102 };
+    unrolledInsertRange(list, 5, middle, 3);
+    printUnrolledList(list);
+
+    printf("Searching for 101: %s\n", unrolledSearch(list, 101) ? "Found" : "Not Found");
+    unrolledDelete(list, 101);
+    printf("Deleted %zu even values\n", unrolledDeleteIf(list, isEven, NULL));
+    printUnrolledList(list);
+    freeUnrolledList(list);
+    freeBlockPool(pool);
+
+    benchmarkLists(10000000);
+
     return 0;
 }
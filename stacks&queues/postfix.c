@@ -107,6 +107,7 @@ char* infixToPostfix(char* infix) {
     while (!isEmpty(stack)) {
         result[k++] = pop(stack);
     }
+    free(stack);
 
     result[k] = '\0';
     return result;
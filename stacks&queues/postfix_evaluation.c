@@ -3,89 +3,107 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
 
-typedef struct CharNode {
-    char data;
-    struct CharNode* next;
-} CharNode;
+// Expression compiler
+//
+//   infix text --tokenize--> tokens --shunting-yard--> postfix tokens
+//              --compile--> register bytecode --VM--> results over columns
+//
+// The tokenizer understands multi-digit and decimal numbers, named variables
+// and functions (sqrt, exp, log, sin, cos, abs, min, max, pow). The compiler
+// folds constant sub-expressions and turns x^k with a constant integer k into
+// exponentiation by squaring. The VM runs each instruction over a batch of
+// rows at a time, reading variables straight from the caller's column arrays.
+//
+// infixToPostfix and evaluatePostfix are thin wrappers over the same pipeline
+// and keep their original integer, single-line semantics.
+//
+// Compile with: gcc -O2 postfix_evaluation.c -o postfix_evaluation -lm
 
-typedef struct CharStack {
-    struct CharNode* head;
-    int size;
-} CharStack;
+#define MAX_TOKENS 1024
+#define MAX_REGISTERS 64
+#define MAX_CONSTANTS 0x3FFF
+#define BATCH_SIZE 256
 
-CharStack* createCharStack() {
-    CharStack* newStack = (CharStack*)malloc(sizeof(CharStack));
-    newStack->head = NULL;
-    newStack->size = 0;
-    return newStack;
-}
+// compile flags
+#define EXPR_INTEGER  1   // truncating division, x^k with k <= 0 is 1
+#define EXPR_LEGACY   2   // '^' left-associative like '*', no unary minus, letters ignored
+#define EXPR_QUIET    4   // don't print compile errors (the caller has a fallback)
 
-void pushChar(CharStack* s, char value) {
-    CharNode* newNode = (CharNode*)malloc(sizeof(CharNode));
-    newNode->data = value;
-    newNode->next = s->head;
-    s->head = newNode;
-    s->size++;
-}
+typedef enum {
+    TOK_NUMBER,
+    TOK_VARIABLE,
+    TOK_OPERATOR,
+    TOK_NEGATE,
+    TOK_FUNCTION,
+    TOK_LPAREN,
+    TOK_RPAREN,
+    TOK_COMMA
+} TokenType;
 
-char popChar(CharStack* s) {
-    if (s->size == 0) return '\0';
-    char popped = s->head->data;
-    CharNode* temp = s->head;
-    s->head = s->head->next;
-    free(temp);
-    s->size--;
-    return popped;
-}
+typedef struct Token {
+    TokenType type;
+    char op;            // operator character
+    int index;          // variable index or function id
+    double value;       // number value
+    int position;       // offset in the source text
+    int length;         // characters in the source text
+} Token;
 
-char peekChar(CharStack* s) {
-    if (s->size == 0) return '\0';
-    return s->head->data;
-}
+typedef enum {
+    OP_MOV, OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_IDIV,
+    OP_POW,             // a^b, any b
+    OP_POWI,            // a^imm by squaring
+    OP_IPOW,            // integer-mode a^b: b <= 0 gives 1
+    OP_NEG, OP_SQRT, OP_EXP, OP_LOG, OP_SIN, OP_COS, OP_ABS, OP_MIN, OP_MAX
+} Opcode;
 
-bool isEmptyChar(CharStack* s) {
-    return s->size == 0;
-}
+static const char* opcodeNames[] = {
+    "mov", "add", "sub", "mul", "div", "idiv", "pow", "powi", "ipow",
+    "neg", "sqrt", "exp", "log", "sin", "cos", "abs", "min", "max"
+};
 
-typedef struct IntNode {
-    int data;
-    struct IntNode* next;
-} IntNode;
+typedef struct FunctionInfo {
+    const char* name;
+    int arity;
+    Opcode op;
+} FunctionInfo;
 
-typedef struct IntStack {
-    struct IntNode* head;
-    int size;
-} IntStack;
+static const FunctionInfo functions[] = {
+    { "sqrt", 1, OP_SQRT }, { "exp", 1, OP_EXP }, { "log", 1, OP_LOG },
+    { "sin", 1, OP_SIN },   { "cos", 1, OP_COS }, { "abs", 1, OP_ABS },
+    { "min", 2, OP_MIN },   { "max", 2, OP_MAX }, { "pow", 2, OP_POW }
+};
+#define FUNCTION_COUNT ((int)(sizeof(functions) / sizeof(functions[0])))
 
-IntStack* createIntStack() {
-    IntStack* s = (IntStack*)malloc(sizeof(IntStack));
-    s->head = NULL;
-    s->size = 0;
-    return s;
-}
+// operands are 16 bits: a 2-bit kind and a 14-bit index
+#define OPERAND_REG 0
+#define OPERAND_CONST 1
+#define OPERAND_VAR 2
+#define MAKE_OPERAND(kind, index) ((uint16_t)(((kind) << 14) | (index)))
+#define OPERAND_KIND(o) ((o) >> 14)
+#define OPERAND_INDEX(o) ((o) & 0x3FFF)
 
-void pushInt(IntStack* s, int value) {
-    IntNode* newNode = (IntNode*)malloc(sizeof(IntNode));
-    newNode->data = value;
-    newNode->next = s->head;
-    s->head = newNode;
-    s->size++;
-}
+typedef struct Instruction {
+    uint8_t op;
+    uint8_t dst;        // destination register
+    uint16_t a;         // first operand
+    uint16_t b;         // second operand (binary ops)
+    int32_t imm;        // exponent for OP_POWI
+} Instruction;
 
-int popInt(IntStack* s) {
-    if (s->size == 0) return 0;
-    int popped = s->head->data;
-    IntNode* temp = s->head;
-    s->head = s->head->next;
-    free(temp);
-    s->size--;
-    return popped;
-}
-
-bool isEmptyInt(IntStack* s) {
-    return s->size == 0;
-}
+typedef struct CompiledExpression {
+    Instruction* code;
+    int length;
+    double* constants;
+    int constantCount;
+    int registerCount;  // result is always left in register 0
+    int variableCount;
+    int flags;
+} CompiledExpression;
 
 int precedence(char c) {
     switch (c) {
@@ -102,81 +120,657 @@ bool isOperator(char c) {
     return c == '+' || c == '-' || c == '*' || c == '/' || c == '^';
 }
 
-bool isOperand(char c) {
-    return isdigit(c);
+// precedence and associativity on the operator stack
+static int tokenPrecedence(const Token* t, int flags) {
+    if (t->type == TOK_NEGATE) return 3;
+    if (t->op == '^' && !(flags & EXPR_LEGACY)) return 4;
+    return precedence(t->op);
 }
 
-char* infixToPostfix(char* infix) {
-    CharStack* stack = createCharStack();
-    int len = strlen(infix);
-    char* result = (char*)malloc(len + 1);
-    int k = 0;
+static bool rightAssociative(const Token* t, int flags) {
+    return t->op == '^' && !(flags & EXPR_LEGACY);
+}
 
-    for (int i = 0; i < len; i++) {
-        char c = infix[i];
+// split infix text into tokens; returns the token count or -1 on error
+int tokenizeInfix(const char* text, int flags, const char* const* varNames, int varCount,
+                  Token* out, int maxTokens) {
+    int count = 0;
+    bool expectOperand = true;
+    const char* p = text;
 
-        if (isOperand(c)) {
-            result[k++] = c;
+    while (*p) {
+        if (count == maxTokens) {
+            printf("Expression error: more than %d tokens\n", maxTokens);
+            return -1;
         }
-        else if (c == '(') {
-            pushChar(stack, c);
+        Token* t = &out[count];
+        t->position = (int)(p - text);
+        char c = *p;
+
+        if (isspace((unsigned char)c)) {
+            p++;
+            continue;
         }
-        else if (c == ')') {
-            while (!isEmptyChar(stack) && peekChar(stack) != '(') {
-                result[k++] = popChar(stack);
+        if (isdigit((unsigned char)c) || (c == '.' && !(flags & EXPR_LEGACY))) {
+            char* end;
+            if (flags & EXPR_LEGACY) {
+                end = (char*)p;
+                while (isdigit((unsigned char)*end)) end++;
+                t->value = strtod(p, NULL);
+            } else {
+                t->value = strtod(p, &end);
+            }
+            t->type = TOK_NUMBER;
+            t->length = (int)(end - p);
+            p = end;
+            expectOperand = false;
+        }
+        else if (isalpha((unsigned char)c) || c == '_') {
+            const char* start = p;
+            while (isalnum((unsigned char)*p) || *p == '_') p++;
+            if (flags & EXPR_LEGACY) {
+                continue;  // the original parser skipped letters
+            }
+            int len = (int)(p - start);
+            const char* q = p;
+            while (isspace((unsigned char)*q)) q++;
+
+            t->index = -1;
+            if (*q == '(') {
+                for (int f = 0; f < FUNCTION_COUNT; f++) {
+                    if ((int)strlen(functions[f].name) == len &&
+                        strncmp(functions[f].name, start, len) == 0) {
+                        t->type = TOK_FUNCTION;
+                        t->index = f;
+                    }
+                }
+            } else {
+                for (int v = 0; v < varCount; v++) {
+                    if ((int)strlen(varNames[v]) == len && strncmp(varNames[v], start, len) == 0) {
+                        t->type = TOK_VARIABLE;
+                        t->index = v;
+                    }
+                }
+            }
+            if (t->index < 0) {
+                printf("Expression error: unknown name '%.*s' at position %d\n",
+                       len, start, t->position);
+                return -1;
             }
-            popChar(stack); // remove '('
+            t->length = len;
+            expectOperand = t->type == TOK_FUNCTION;
         }
         else if (isOperator(c)) {
-            while (!isEmptyChar(stack) && precedence(peekChar(stack)) >= precedence(c)) {
-                result[k++] = popChar(stack);
+            p++;
+            t->length = 1;
+            if (expectOperand && (c == '-' || c == '+') && !(flags & EXPR_LEGACY)) {
+                if (c == '+') continue;  // unary plus is a no-op
+                t->type = TOK_NEGATE;
+                t->op = '~';
+            } else {
+                t->type = TOK_OPERATOR;
+                t->op = c;
+            }
+            expectOperand = true;
+        }
+        else if (c == '(' || c == ')' || c == ',') {
+            p++;
+            t->length = 1;
+            t->type = c == '(' ? TOK_LPAREN : c == ')' ? TOK_RPAREN : TOK_COMMA;
+            expectOperand = c != ')';
+        }
+        else {
+            p++;
+            if (flags & EXPR_LEGACY) {
+                continue;  // the original parser skipped anything else
             }
-            pushChar(stack, c);
+            printf("Expression error: unexpected '%c' at position %d\n", c, t->position);
+            return -1;
         }
+        count++;
     }
+    return count;
+}
 
-    while (!isEmptyChar(stack)) {
-        result[k++] = popChar(stack);
+// shunting-yard: reorder infix tokens into postfix; returns the count or -1
+int tokensToPostfix(const Token* in, int n, int flags, Token* out) {
+    // every token is pushed at most once, so n entries always suffice
+    Token* stack = (Token*)malloc((n + 1) * sizeof(Token));
+    if (!stack) {
+        printf("Memory allocation failed!\n");
+        exit(1);
     }
+    int top = 0, k = 0;
 
-    result[k] = '\0';
-    return result;
+    for (int i = 0; i < n; i++) {
+        const Token* t = &in[i];
+        switch (t->type) {
+            case TOK_NUMBER:
+            case TOK_VARIABLE:
+                out[k++] = *t;
+                break;
+            case TOK_FUNCTION:
+            case TOK_NEGATE:
+            case TOK_LPAREN:
+                stack[top++] = *t;
+                break;
+            case TOK_COMMA:
+            case TOK_RPAREN:
+                while (top > 0 && stack[top - 1].type != TOK_LPAREN) {
+                    out[k++] = stack[--top];
+                }
+                if (top == 0) {
+                    if (flags & EXPR_LEGACY) break;
+                    printf("Expression error: unmatched '%c' at position %d\n",
+                           t->type == TOK_COMMA ? ',' : ')', t->position);
+                    free(stack);
+                    return -1;
+                }
+                if (t->type == TOK_RPAREN) {
+                    top--;  // remove '('
+                    if (top > 0 && stack[top - 1].type == TOK_FUNCTION) {
+                        out[k++] = stack[--top];
+                    }
+                }
+                break;
+            case TOK_OPERATOR: {
+                int prec = tokenPrecedence(t, flags);
+                while (top > 0 && (stack[top - 1].type == TOK_OPERATOR ||
+                                   stack[top - 1].type == TOK_NEGATE)) {
+                    int topPrec = tokenPrecedence(&stack[top - 1], flags);
+                    if (topPrec < prec || (topPrec == prec && rightAssociative(t, flags))) break;
+                    out[k++] = stack[--top];
+                }
+                stack[top++] = *t;
+                break;
+            }
+        }
+    }
+
+    while (top > 0) {
+        Token* t = &stack[--top];
+        if (t->type == TOK_LPAREN) {
+            if (flags & EXPR_LEGACY) continue;
+            printf("Expression error: unmatched '(' at position %d\n", t->position);
+            free(stack);
+            return -1;
+        }
+        out[k++] = *t;
+    }
+    free(stack);
+    return k;
 }
 
-int evaluatePostfix(char* postfix) {
-    IntStack* stack = createIntStack();
-    int len = strlen(postfix);
+// a^e for integer e by repeated squaring
+static double powInteger(double base, long long e) {
+    bool negative = e < 0;
+    unsigned long long n = negative ? 0ULL - (unsigned long long)e : (unsigned long long)e;
+    double result = 1.0;
+    while (n) {
+        if (n & 1) result *= base;
+        n >>= 1;
+        if (n) base *= base;
+    }
+    return negative ? 1.0 / result : result;
+}
 
-    for (int i = 0; i < len; i++) {
-        char c = postfix[i];
+static double powGeneral(double a, double b) {
+    if (b == floor(b) && fabs(b) <= 1024) {
+        return powInteger(a, (long long)b);
+    }
+    return pow(a, b);
+}
+
+// scalar semantics of every opcode; used for constant folding
+static double applyOp(Opcode op, double a, double b, int32_t imm) {
+    switch (op) {
+        case OP_MOV:  return a;
+        case OP_ADD:  return a + b;
+        case OP_SUB:  return a - b;
+        case OP_MUL:  return a * b;
+        case OP_DIV:  return a / b;
+        case OP_IDIV: return b == 0 ? 0 : trunc(a / b);
+        case OP_POW:  return powGeneral(a, b);
+        case OP_POWI: return powInteger(a, imm);
+        case OP_IPOW: return b <= 0 ? 1.0 : powInteger(a, (long long)b);
+        case OP_NEG:  return -a;
+        case OP_SQRT: return sqrt(a);
+        case OP_EXP:  return exp(a);
+        case OP_LOG:  return log(a);
+        case OP_SIN:  return sin(a);
+        case OP_COS:  return cos(a);
+        case OP_ABS:  return fabs(a);
+        case OP_MIN:  return a < b ? a : b;
+        case OP_MAX:  return a > b ? a : b;
+    }
+    return 0;
+}
+
+static Opcode binaryOpcode(char c, int flags) {
+    switch (c) {
+        case '+': return OP_ADD;
+        case '-': return OP_SUB;
+        case '*': return OP_MUL;
+        case '/': return (flags & EXPR_INTEGER) ? OP_IDIV : OP_DIV;
+        default:  return (flags & EXPR_INTEGER) ? OP_IPOW : OP_POW;
+    }
+}
+
+typedef struct StackEntry {
+    uint16_t operand;
+    bool isConstant;
+    double value;
+} StackEntry;
+
+typedef struct Compiler {
+    CompiledExpression* expr;
+    int codeCapacity;
+    int constantCapacity;
+    StackEntry* stack;  // one entry per postfix token at most
+    int depth;
+    int registerDepth;  // register entries on the stack; the next free register
+} Compiler;
 
-        if (isdigit(c)) {
-            // convert char digit to int value
-            pushInt(stack, c - '0');
+static uint16_t addConstant(Compiler* c, double value) {
+    CompiledExpression* e = c->expr;
+    for (int i = 0; i < e->constantCount; i++) {
+        if (e->constants[i] == value) return MAKE_OPERAND(OPERAND_CONST, i);
+    }
+    if (e->constantCount == c->constantCapacity) {
+        c->constantCapacity *= 2;
+        e->constants = (double*)realloc(e->constants, c->constantCapacity * sizeof(double));
+    }
+    e->constants[e->constantCount] = value;
+    return MAKE_OPERAND(OPERAND_CONST, e->constantCount++);
+}
+
+// Registers are used like a stack: register entries on the compile stack hold
+// r0, r1, ... from the bottom up, and constants and variables take none. So
+// the next result goes to register registerDepth.
+
+// emit dst = op(a, b) into the next free register; false if none is left
+static bool emit(Compiler* c, Opcode op, uint16_t a, uint16_t b, int32_t imm) {
+    CompiledExpression* e = c->expr;
+    int dst = c->registerDepth;
+    if (dst >= MAX_REGISTERS) {
+        return false;
+    }
+    if (e->length == c->codeCapacity) {
+        c->codeCapacity *= 2;
+        e->code = (Instruction*)realloc(e->code, c->codeCapacity * sizeof(Instruction));
+    }
+    e->code[e->length++] = (Instruction){ (uint8_t)op, (uint8_t)dst, a, b, imm };
+    if (dst + 1 > e->registerCount) e->registerCount = dst + 1;
+    c->stack[c->depth++] = (StackEntry){ MAKE_OPERAND(OPERAND_REG, dst), false, 0 };
+    c->registerDepth++;
+    return true;
+}
+
+static void pushEntry(Compiler* c, StackEntry s) {
+    c->stack[c->depth++] = s;
+    if (!s.isConstant && OPERAND_KIND(s.operand) == OPERAND_REG) c->registerDepth++;
+}
+
+static StackEntry popEntry(Compiler* c) {
+    StackEntry s = c->stack[--c->depth];
+    if (!s.isConstant && OPERAND_KIND(s.operand) == OPERAND_REG) c->registerDepth--;
+    return s;
+}
+
+static void pushConstant(Compiler* c, double value) {
+    c->stack[c->depth].operand = 0;   // materialized lazily by addConstant
+    c->stack[c->depth].isConstant = true;
+    c->stack[c->depth].value = value;
+    c->depth++;
+}
+
+static uint16_t operandOf(Compiler* c, StackEntry* s) {
+    return s->isConstant ? addConstant(c, s->value) : s->operand;
+}
+
+void freeCompiledExpression(CompiledExpression* e) {
+    if (e) {
+        free(e->code);
+        free(e->constants);
+        free(e);
+    }
+}
+
+static CompiledExpression* compileFailed(Compiler* c, int flags, const char* message, int position) {
+    if (!(flags & EXPR_QUIET)) {
+        if (position >= 0) {
+            printf("Expression error: %s near position %d\n", message, position);
+        } else {
+            printf("Expression error: %s\n", message);
         }
-        else if (isOperator(c)) {
-            int val2 = popInt(stack);
-            int val1 = popInt(stack);
-            int result;
-
-            switch (c) {
-                case '+': result = val1 + val2; break;
-                case '-': result = val1 - val2; break;
-                case '*': result = val1 * val2; break;
-                case '/': result = val1 / val2; break;
-                case '^': {
-                    result = 1;
-                    for (int j = 0; j < val2; j++) result *= val1;
+    }
+    freeCompiledExpression(c->expr);
+    free(c->stack);
+    free(c);
+    return NULL;
+}
+
+// compile postfix tokens to bytecode; returns NULL if the expression is malformed
+CompiledExpression* compilePostfixTokens(const Token* rpn, int n, int varCount, int flags) {
+    CompiledExpression* e = (CompiledExpression*)calloc(1, sizeof(CompiledExpression));
+    Compiler* c = (Compiler*)malloc(sizeof(Compiler));
+    StackEntry* stack = (StackEntry*)malloc((n + 1) * sizeof(StackEntry));
+    if (!e || !c || !stack) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    c->expr = e;
+    c->codeCapacity = 16;
+    c->constantCapacity = 8;
+    c->stack = stack;
+    c->depth = 0;
+    c->registerDepth = 0;
+    e->code = (Instruction*)malloc(c->codeCapacity * sizeof(Instruction));
+    e->constants = (double*)malloc(c->constantCapacity * sizeof(double));
+    e->variableCount = varCount;
+    e->flags = flags;
+
+    for (int i = 0; i < n; i++) {
+        const Token* t = &rpn[i];
+        if (e->constantCount >= MAX_CONSTANTS) {
+            return compileFailed(c, flags, "too many constants", -1);
+        }
+        if (t->type == TOK_NUMBER) {
+            pushConstant(c, t->value);
+            continue;
+        }
+        if (t->type == TOK_VARIABLE) {
+            c->stack[c->depth++] = (StackEntry){ MAKE_OPERAND(OPERAND_VAR, t->index), false, 0 };
+            continue;
+        }
+
+        Opcode op;
+        int arity;
+        if (t->type == TOK_NEGATE) {
+            op = OP_NEG;
+            arity = 1;
+        } else if (t->type == TOK_FUNCTION) {
+            op = functions[t->index].op;
+            arity = functions[t->index].arity;
+        } else {
+            op = binaryOpcode(t->op, flags);
+            arity = 2;
+        }
+        if (c->depth < arity) {
+            return compileFailed(c, flags, "missing operand", t->position);
+        }
+
+        StackEntry y = popEntry(c);
+        StackEntry x = arity == 2 ? popEntry(c) : y;
+        bool emitted = true;
+
+        // constant folding
+        if (x.isConstant && y.isConstant) {
+            pushConstant(c, applyOp(op, x.value, y.value, 0));
+            continue;
+        }
+        // x^k with constant integer k: squaring chain instead of pow()
+        if ((op == OP_POW || op == OP_IPOW) && y.isConstant && y.value == floor(y.value) &&
+            fabs(y.value) <= 1 << 30) {
+            int32_t k = (int32_t)y.value;
+            if (op == OP_IPOW && k <= 0) {
+                pushConstant(c, 1.0);
+            } else if (k == 1) {
+                pushEntry(c, x);
+            } else if (k == 2) {
+                uint16_t a = operandOf(c, &x);
+                emitted = emit(c, OP_MUL, a, a, 0);
+            } else {
+                emitted = emit(c, OP_POWI, operandOf(c, &x), 0, k);
+            }
+        } else {
+            uint16_t a = operandOf(c, &x);
+            uint16_t b = arity == 2 ? operandOf(c, &y) : 0;
+            emitted = emit(c, op, a, b, 0);
+        }
+        if (!emitted) {
+            return compileFailed(c, flags, "too many pending intermediate results", t->position);
+        }
+    }
+
+    if (c->depth != 1) {
+        return compileFailed(c, flags, c->depth == 0 ? "empty expression" : "missing operator", -1);
+    }
+    // leave the result in register 0 (the only register entry, if any, is r0)
+    if (c->stack[0].isConstant || OPERAND_KIND(c->stack[0].operand) != OPERAND_REG) {
+        StackEntry result = popEntry(c);
+        emit(c, OP_MOV, operandOf(c, &result), 0, 0);
+    }
+    free(c->stack);
+    free(c);
+    return e;
+}
+
+// compile infix text over the named variables; returns NULL on error
+CompiledExpression* compileExpression(const char* infix, const char* const* varNames, int varCount) {
+    Token* tokens = (Token*)malloc(2 * MAX_TOKENS * sizeof(Token));
+    if (!tokens) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    CompiledExpression* e = NULL;
+    int n = tokenizeInfix(infix, 0, varNames, varCount, tokens, MAX_TOKENS);
+    if (n >= 0) {
+        int m = tokensToPostfix(tokens, n, 0, tokens + MAX_TOKENS);
+        if (m >= 0) {
+            e = compilePostfixTokens(tokens + MAX_TOKENS, m, varCount, 0);
+        }
+    }
+    free(tokens);
+    return e;
+}
+
+// print the bytecode, one instruction per line
+void printCompiledExpression(const CompiledExpression* e, const char* const* varNames) {
+    for (int i = 0; i < e->length; i++) {
+        const Instruction* in = &e->code[i];
+        printf("  %-5s r%d", opcodeNames[in->op], in->dst);
+        int operands = in->op == OP_MOV || in->op == OP_POWI || in->op == OP_NEG ||
+                       (in->op >= OP_SQRT && in->op <= OP_ABS) ? 1 : 2;
+        for (int j = 0; j < operands; j++) {
+            uint16_t o = j == 0 ? in->a : in->b;
+            switch (OPERAND_KIND(o)) {
+                case OPERAND_REG:   printf(", r%d", OPERAND_INDEX(o)); break;
+                case OPERAND_CONST: printf(", %g", e->constants[OPERAND_INDEX(o)]); break;
+                default:            printf(", %s", varNames ? varNames[OPERAND_INDEX(o)] : "var"); break;
+            }
+        }
+        if (in->op == OP_POWI) printf(", %d", in->imm);
+        printf("\n");
+    }
+}
+
+// out[i] = expression evaluated at row i, with variable v read from columns[v][i]
+void evaluateColumns(const CompiledExpression* e, const double* const* columns,
+                     size_t rows, double* out) {
+    int scratchRegisters = e->registerCount - 1;
+    size_t scratchSize = (size_t)(scratchRegisters + e->constantCount + 1) * BATCH_SIZE;
+    double* scratch = (double*)malloc(scratchSize * sizeof(double));
+    if (!scratch) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    // constants are broadcast once so every kernel is a plain vector loop
+    double* constantVectors = scratch + (size_t)scratchRegisters * BATCH_SIZE;
+    for (int c = 0; c < e->constantCount; c++) {
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            constantVectors[c * BATCH_SIZE + i] = e->constants[c];
+        }
+    }
+    double* powBase = constantVectors + (size_t)e->constantCount * BATCH_SIZE;
+    double* registers[MAX_REGISTERS];
+    for (int r = 1; r < e->registerCount; r++) {
+        registers[r] = scratch + (size_t)(r - 1) * BATCH_SIZE;
+    }
+
+    for (size_t start = 0; start < rows; start += BATCH_SIZE) {
+        size_t n = rows - start < BATCH_SIZE ? rows - start : BATCH_SIZE;
+        registers[0] = out + start;  // the result register writes straight to out
+
+        for (int pc = 0; pc < e->length; pc++) {
+            const Instruction* in = &e->code[pc];
+            const double* ops[2];
+            for (int j = 0; j < 2; j++) {
+                uint16_t o = j == 0 ? in->a : in->b;
+                switch (OPERAND_KIND(o)) {
+                    case OPERAND_REG:   ops[j] = registers[OPERAND_INDEX(o)]; break;
+                    case OPERAND_CONST: ops[j] = constantVectors + OPERAND_INDEX(o) * BATCH_SIZE; break;
+                    default:            ops[j] = columns[OPERAND_INDEX(o)] + start; break;
+                }
+            }
+            const double* a = ops[0];
+            const double* b = ops[1];
+            double* d = registers[in->dst];
+
+            switch ((Opcode)in->op) {
+                case OP_MOV:  for (size_t i = 0; i < n; i++) d[i] = a[i]; break;
+                case OP_ADD:  for (size_t i = 0; i < n; i++) d[i] = a[i] + b[i]; break;
+                case OP_SUB:  for (size_t i = 0; i < n; i++) d[i] = a[i] - b[i]; break;
+                case OP_MUL:  for (size_t i = 0; i < n; i++) d[i] = a[i] * b[i]; break;
+                case OP_DIV:  for (size_t i = 0; i < n; i++) d[i] = a[i] / b[i]; break;
+                case OP_NEG:  for (size_t i = 0; i < n; i++) d[i] = -a[i]; break;
+                case OP_SQRT: for (size_t i = 0; i < n; i++) d[i] = sqrt(a[i]); break;
+                case OP_ABS:  for (size_t i = 0; i < n; i++) d[i] = fabs(a[i]); break;
+                case OP_MIN:  for (size_t i = 0; i < n; i++) d[i] = a[i] < b[i] ? a[i] : b[i]; break;
+                case OP_MAX:  for (size_t i = 0; i < n; i++) d[i] = a[i] > b[i] ? a[i] : b[i]; break;
+                case OP_POWI: {
+                    // the same exponent for every row, so square whole vectors
+                    unsigned int k = in->imm < 0 ? 0u - (unsigned int)in->imm : (unsigned int)in->imm;
+                    memcpy(powBase, a, n * sizeof(double));
+                    for (size_t i = 0; i < n; i++) d[i] = 1.0;
+                    while (k) {
+                        if (k & 1) for (size_t i = 0; i < n; i++) d[i] *= powBase[i];
+                        k >>= 1;
+                        if (k) for (size_t i = 0; i < n; i++) powBase[i] *= powBase[i];
+                    }
+                    if (in->imm < 0) for (size_t i = 0; i < n; i++) d[i] = 1.0 / d[i];
                     break;
                 }
-                default: result = 0;
+                default:
+                    for (size_t i = 0; i < n; i++) d[i] = applyOp((Opcode)in->op, a[i], b[i], in->imm);
+                    break;
             }
+        }
+    }
+    free(scratch);
+}
+
+// evaluate at a single point: values[v] is the value of variable v
+double evaluateCompiled(const CompiledExpression* e, const double* values) {
+    const double* columns[MAX_TOKENS];
+    for (int v = 0; v < e->variableCount; v++) {
+        columns[v] = &values[v];
+    }
+    double result;
+    evaluateColumns(e, columns, 1, &result);
+    return result;
+}
 
-            pushInt(stack, result);
+// convert infix to postfix text. Operands are digits; when every number is a
+// single digit the output has no separators (as before), otherwise tokens are
+// separated by spaces so multi-digit numbers survive the round trip.
+char* infixToPostfix(char* infix) {
+    int len = strlen(infix);
+    Token* tokens = (Token*)malloc(2 * (len + 1) * sizeof(Token));
+    if (!tokens) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    int n = tokenizeInfix(infix, EXPR_INTEGER | EXPR_LEGACY, NULL, 0, tokens, len + 1);
+    int m = tokensToPostfix(tokens, n, EXPR_INTEGER | EXPR_LEGACY, tokens + len + 1);
+    Token* rpn = tokens + len + 1;
+
+    bool spaced = false;
+    for (int i = 0; i < m; i++) {
+        if (rpn[i].type == TOK_NUMBER && rpn[i].length > 1) spaced = true;
+    }
+    char* result = (char*)malloc(2 * len + 1);
+    int k = 0;
+    for (int i = 0; i < m; i++) {
+        if (spaced && k > 0) result[k++] = ' ';
+        if (rpn[i].type == TOK_NUMBER) {
+            memcpy(result + k, infix + rpn[i].position, rpn[i].length);
+            k += rpn[i].length;
+        } else {
+            result[k++] = rpn[i].op;
         }
     }
+    result[k] = '\0';
+    free(tokens);
+    return result;
+}
 
-    return popInt(stack);
+// the original evaluator: integer semantics over a plain operand stack
+static double interpretPostfixTokens(const Token* rpn, int n) {
+    double* stack = (double*)malloc((n + 1) * sizeof(double));
+    if (!stack) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    int top = 0;
+    for (int i = 0; i < n; i++) {
+        if (rpn[i].type == TOK_NUMBER) {
+            stack[top++] = rpn[i].value;
+            continue;
+        }
+        double b = top > 0 ? stack[--top] : 0;
+        double a = top > 0 ? stack[--top] : 0;
+        stack[top++] = (int)applyOp(binaryOpcode(rpn[i].op, EXPR_INTEGER), a, b, 0);
+    }
+    double result = top > 0 ? stack[top - 1] : 0;
+    free(stack);
+    return result;
+}
+
+// evaluate postfix text with integer arithmetic. Without spaces every digit is
+// its own operand (as before); with spaces, whitespace separates tokens.
+int evaluatePostfix(char* postfix) {
+    int len = strlen(postfix);
+    Token* rpn = (Token*)malloc((len + 1) * sizeof(Token));
+    if (!rpn) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    bool spaced = strchr(postfix, ' ') != NULL;
+    int n = 0;
+    for (int i = 0; i < len; i++) {
+        char c = postfix[i];
+        if (isdigit((unsigned char)c)) {
+            int start = i;
+            double value = c - '0';
+            while (spaced && isdigit((unsigned char)postfix[i + 1])) {
+                value = value * 10 + (postfix[++i] - '0');
+            }
+            rpn[n++] = (Token){ TOK_NUMBER, 0, 0, value, start, i - start + 1 };
+        } else if (isOperator(c)) {
+            rpn[n++] = (Token){ TOK_OPERATOR, c, 0, 0, i, 1 };
+        }
+    }
+
+    // Malformed or oversized input compiles to nothing; the original stack
+    // interpreter still gives it an answer (empty pops read as 0, the result
+    // is whatever is on top), so run that instead.
+    CompiledExpression* e = compilePostfixTokens(rpn, n, 0, EXPR_INTEGER | EXPR_LEGACY | EXPR_QUIET);
+    int result;
+    if (e) {
+        result = (int)evaluateCompiled(e, NULL);
+        freeCompiledExpression(e);
+    } else {
+        result = (int)interpretPostfixTokens(rpn, n);
+    }
+    free(rpn);
+    return result;
+}
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
 }
 
 int main() {
@@ -190,5 +784,79 @@ int main() {
     printf("Result:  %d\n", result);
 
     free(postfix);
+
+    // multi-digit operands through the same wrappers
+    char infix2[] = "12+(34*2)^2-500/7";
+    postfix = infixToPostfix(infix2);
+    printf("\nInfix:   %s\n", infix2);
+    printf("Postfix: %s\n", postfix);
+    printf("Result:  %d\n", evaluatePostfix(postfix));
+    free(postfix);
+
+    // compile a formula over three columns
+    const char* vars[] = { "x", "y", "z" };
+    const char* formula = "3*x^2 + 2*x*y - sqrt(z)/(1+2^3) + max(x, y)^5";
+    CompiledExpression* e = compileExpression(formula, vars, 3);
+    printf("\nFormula: %s\n", formula);
+    printf("Bytecode (%d instructions, %d registers):\n", e->length, e->registerCount);
+    printCompiledExpression(e, vars);
+
+    double point[3] = { 1.5, -2.0, 16.0 };
+    printf("f(1.5, -2, 16) = %.6f\n", evaluateCompiled(e, point));
+
+    // batched evaluation over columnar input
+    size_t rows = 10000000;
+    double* x = (double*)malloc(rows * sizeof(double));
+    double* y = (double*)malloc(rows * sizeof(double));
+    double* z = (double*)malloc(rows * sizeof(double));
+    double* out = (double*)malloc(rows * sizeof(double));
+    for (size_t i = 0; i < rows; i++) {
+        x[i] = (double)(i % 1000) / 100.0;
+        y[i] = (double)(i % 37) - 18.0;
+        z[i] = (double)(i % 101);
+    }
+    const double* columns[3] = { x, y, z };
+
+    double start = nowSeconds();
+    evaluateColumns(e, columns, rows, out);
+    double vmTime = nowSeconds() - start;
+
+    start = nowSeconds();
+    double maxError = 0.0;
+    for (size_t i = 0; i < rows; i++) {
+        double m = x[i] > y[i] ? x[i] : y[i];
+        double expected = 3 * x[i] * x[i] + 2 * x[i] * y[i] - sqrt(z[i]) / 9.0 + m * m * m * m * m;
+        double err = fabs(expected - out[i]) / (fabs(expected) + 1.0);
+        if (err > maxError) maxError = err;
+    }
+    double nativeTime = nowSeconds() - start;
+
+    // baseline: re-parse and evaluate the text for every row
+    size_t reparsedRows = 100000;
+    start = nowSeconds();
+    for (size_t i = 0; i < reparsedRows; i++) {
+        CompiledExpression* once = compileExpression(formula, vars, 3);
+        double row[3] = { x[i], y[i], z[i] };
+        out[i] = evaluateCompiled(once, row);
+        freeCompiledExpression(once);
+    }
+    double reparseTime = nowSeconds() - start;
+
+    printf("\n%zu rows: VM %.1f ms (%.1f M rows/s), native C + check %.1f ms, max rel. error %.2e\n",
+           rows, vmTime * 1e3, rows / vmTime / 1e6, nativeTime * 1e3, maxError);
+    printf("Re-parsing per row: %.1f ms for %zu rows (%.2f M rows/s)\n",
+           reparseTime * 1e3, reparsedRows, reparsedRows / reparseTime / 1e6);
+
+    // malformed input is reported, not evaluated
+    printf("\n");
+    compileExpression("3 + * 4", vars, 3);
+    compileExpression("sqrt(x", vars, 3);
+    compileExpression("w * 2", vars, 3);
+
+    freeCompiledExpression(e);
+    free(x);
+    free(y);
+    free(z);
+    free(out);
     return 0;
 }
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+// See ringQueue.c for the generic, power-of-two and lock-free (SPSC/MPMC) variants.
+
 typedef struct Queue {
     int *arr;       // array to store queue elements
     int capacity;   // maximum size of queue
@@ -36,7 +38,7 @@ void enqueue(Queue* q, int value) {
         printf("Queue overflow!\n");
         return;
     }
-    q->rear = (q->rear + 1) % q->capacity; // circular increment
+    if (++q->rear == q->capacity) q->rear = 0; // circular increment without division
     q->arr[q->rear] = value;
     q->size++;
 }
@@ -48,7 +50,7 @@ int dequeue(Queue* q) {
         return -1; // sentinel value
     }
     int value = q->arr[q->front];
-    q->front = (q->front + 1) % q->capacity; // circular increment
+    if (++q->front == q->capacity) q->front = 0; // circular increment without division
     q->size--;
     return value;
 }
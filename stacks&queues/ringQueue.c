@@ -0,0 +1,735 @@
+// Ring-buffer queue family built on the circular array queue in queueArray.c.
+//
+//   RingQueue - single-threaded, any element type (elemSize bytes per slot)
+//   SpscQueue - one producer thread, one consumer thread, lock-free
+//   MpmcQueue - many producers, many consumers, lock-free (Vyukov bounded queue)
+//
+// All three round the capacity up to a power of two so the slot index is
+// (counter & mask) instead of a division, and keep head/tail as free-running
+// counters so "full" and "empty" never need a separate size field.
+// Every queue has batch enqueueN/dequeueN calls that move up to n elements
+// with a single index update.
+//
+// Compile with: gcc -O2 -pthread ringQueue.c -o ringQueue
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CACHE_LINE 64
+#define SPIN_BEFORE_YIELD 64
+
+// round n up to the next power of two (minimum 2)
+static size_t nextPowerOfTwo(size_t n) {
+    size_t p = 2;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+// allocate zeroed memory aligned to a cache line
+static void* allocAligned(size_t bytes) {
+    size_t rounded = (bytes + CACHE_LINE - 1) & ~(size_t)(CACHE_LINE - 1);
+    void* p = aligned_alloc(CACHE_LINE, rounded);
+    if (p) {
+        memset(p, 0, rounded);
+    }
+    return p;
+}
+
+// copy n elements into a ring starting at slot index, wrapping at most once
+static void copyIntoRing(unsigned char* ring, size_t mask, size_t elemSize,
+                         size_t index, const void* src, size_t n) {
+    size_t capacity = mask + 1;
+    size_t start = index & mask;
+    size_t first = capacity - start < n ? capacity - start : n;
+    memcpy(ring + start * elemSize, src, first * elemSize);
+    if (n > first) {
+        memcpy(ring, (const unsigned char*)src + first * elemSize, (n - first) * elemSize);
+    }
+}
+
+// copy n elements out of a ring starting at slot index, wrapping at most once
+static void copyFromRing(const unsigned char* ring, size_t mask, size_t elemSize,
+                         size_t index, void* dst, size_t n) {
+    size_t capacity = mask + 1;
+    size_t start = index & mask;
+    size_t first = capacity - start < n ? capacity - start : n;
+    memcpy(dst, ring + start * elemSize, first * elemSize);
+    if (n > first) {
+        memcpy((unsigned char*)dst + first * elemSize, ring, (n - first) * elemSize);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// RingQueue: single-threaded generic queue
+// ---------------------------------------------------------------------------
+
+typedef struct RingQueue {
+    unsigned char *buffer;  // capacity * elemSize bytes
+    size_t elemSize;        // size of one element in bytes
+    size_t mask;            // capacity - 1
+    size_t head;            // counter of the next element to dequeue
+    size_t tail;            // counter of the next free slot
+} RingQueue;
+
+// create a queue holding at least `capacity` elements of `elemSize` bytes
+RingQueue* createRingQueue(size_t capacity, size_t elemSize) {
+    RingQueue* q = (RingQueue*)malloc(sizeof(RingQueue));
+    if (!q) {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    capacity = nextPowerOfTwo(capacity);
+    q->buffer = (unsigned char*)malloc(capacity * elemSize);
+    if (!q->buffer) {
+        printf("Memory allocation failed!\n");
+        free(q);
+        return NULL;
+    }
+    q->elemSize = elemSize;
+    q->mask = capacity - 1;
+    q->head = q->tail = 0;
+    return q;
+}
+
+size_t ringSize(const RingQueue* q) {
+    return q->tail - q->head;
+}
+
+size_t ringCapacity(const RingQueue* q) {
+    return q->mask + 1;
+}
+
+bool ringIsEmpty(const RingQueue* q) {
+    return q->tail == q->head;
+}
+
+// add one element; returns false when the queue is full
+bool ringEnqueue(RingQueue* q, const void* elem) {
+    if (q->tail - q->head > q->mask) {
+        return false;
+    }
+    memcpy(q->buffer + (q->tail & q->mask) * q->elemSize, elem, q->elemSize);
+    q->tail++;
+    return true;
+}
+
+// remove one element into *out; returns false when the queue is empty
+bool ringDequeue(RingQueue* q, void* out) {
+    if (q->head == q->tail) {
+        return false;
+    }
+    memcpy(out, q->buffer + (q->head & q->mask) * q->elemSize, q->elemSize);
+    q->head++;
+    return true;
+}
+
+// copy the front element into *out without removing it
+bool ringPeek(const RingQueue* q, void* out) {
+    if (q->head == q->tail) {
+        return false;
+    }
+    memcpy(out, q->buffer + (q->head & q->mask) * q->elemSize, q->elemSize);
+    return true;
+}
+
+// add up to n elements from a contiguous array; returns how many were added
+size_t ringEnqueueN(RingQueue* q, const void* elems, size_t n) {
+    size_t space = (q->mask + 1) - (q->tail - q->head);
+    if (n > space) {
+        n = space;
+    }
+    copyIntoRing(q->buffer, q->mask, q->elemSize, q->tail, elems, n);
+    q->tail += n;
+    return n;
+}
+
+// remove up to n elements into a contiguous array; returns how many were removed
+size_t ringDequeueN(RingQueue* q, void* out, size_t n) {
+    size_t available = q->tail - q->head;
+    if (n > available) {
+        n = available;
+    }
+    copyFromRing(q->buffer, q->mask, q->elemSize, q->head, out, n);
+    q->head += n;
+    return n;
+}
+
+void freeRingQueue(RingQueue* q) {
+    if (q) {
+        free(q->buffer);
+        free(q);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// SpscQueue: single producer, single consumer
+// ---------------------------------------------------------------------------
+// The producer only writes tail and the consumer only writes head, so each
+// index lives on its own cache line. Each side also keeps a private cached
+// copy of the other side's index and only re-reads the shared one (an acquire
+// load) when the cached value says the queue is full/empty.
+
+typedef struct SpscQueue {
+    _Alignas(CACHE_LINE) _Atomic size_t head;  // written by consumer
+    size_t cachedTail;                         // consumer's last view of tail
+
+    _Alignas(CACHE_LINE) _Atomic size_t tail;  // written by producer
+    size_t cachedHead;                         // producer's last view of head
+
+    _Alignas(CACHE_LINE) size_t mask;          // read-only after creation
+    size_t elemSize;
+    unsigned char *buffer;
+} SpscQueue;
+
+SpscQueue* createSpscQueue(size_t capacity, size_t elemSize) {
+    SpscQueue* q = (SpscQueue*)allocAligned(sizeof(SpscQueue));
+    if (!q) {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    capacity = nextPowerOfTwo(capacity);
+    q->buffer = (unsigned char*)allocAligned(capacity * elemSize);
+    if (!q->buffer) {
+        printf("Memory allocation failed!\n");
+        free(q);
+        return NULL;
+    }
+    q->mask = capacity - 1;
+    q->elemSize = elemSize;
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+    return q;
+}
+
+// producer side: add one element; returns false when full
+bool spscEnqueue(SpscQueue* q, const void* elem) {
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    if (tail - q->cachedHead > q->mask) {
+        q->cachedHead = atomic_load_explicit(&q->head, memory_order_acquire);
+        if (tail - q->cachedHead > q->mask) {
+            return false;
+        }
+    }
+    memcpy(q->buffer + (tail & q->mask) * q->elemSize, elem, q->elemSize);
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+// consumer side: remove one element; returns false when empty
+bool spscDequeue(SpscQueue* q, void* out) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    if (head == q->cachedTail) {
+        q->cachedTail = atomic_load_explicit(&q->tail, memory_order_acquire);
+        if (head == q->cachedTail) {
+            return false;
+        }
+    }
+    memcpy(out, q->buffer + (head & q->mask) * q->elemSize, q->elemSize);
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return true;
+}
+
+// producer side: add up to n elements, publishing them with one store
+size_t spscEnqueueN(SpscQueue* q, const void* elems, size_t n) {
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    size_t capacity = q->mask + 1;
+    size_t space = capacity - (tail - q->cachedHead);
+    if (space < n) {
+        q->cachedHead = atomic_load_explicit(&q->head, memory_order_acquire);
+        space = capacity - (tail - q->cachedHead);
+        if (n > space) {
+            n = space;
+        }
+    }
+    if (n == 0) {
+        return 0;
+    }
+    copyIntoRing(q->buffer, q->mask, q->elemSize, tail, elems, n);
+    atomic_store_explicit(&q->tail, tail + n, memory_order_release);
+    return n;
+}
+
+// consumer side: remove up to n elements, releasing the slots with one store
+size_t spscDequeueN(SpscQueue* q, void* out, size_t n) {
+    size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t available = q->cachedTail - head;
+    if (available < n) {
+        q->cachedTail = atomic_load_explicit(&q->tail, memory_order_acquire);
+        available = q->cachedTail - head;
+        if (n > available) {
+            n = available;
+        }
+    }
+    if (n == 0) {
+        return 0;
+    }
+    copyFromRing(q->buffer, q->mask, q->elemSize, head, out, n);
+    atomic_store_explicit(&q->head, head + n, memory_order_release);
+    return n;
+}
+
+void freeSpscQueue(SpscQueue* q) {
+    if (q) {
+        free(q->buffer);
+        free(q);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// MpmcQueue: bounded multi-producer multi-consumer queue (Dmitry Vyukov)
+// ---------------------------------------------------------------------------
+// Every slot carries a sequence number. For the slot at counter pos:
+//   sequence == pos           -> empty, a producer may claim it
+//   sequence == pos + 1       -> full, a consumer may claim it
+//   sequence == pos + capacity-> emptied, ready for the next lap
+// Producers and consumers claim counters with a CAS on enqueuePos/dequeuePos,
+// then publish the slot with a release store of its sequence.
+
+typedef struct MpmcQueue {
+    _Alignas(CACHE_LINE) _Atomic size_t enqueuePos;
+    _Alignas(CACHE_LINE) _Atomic size_t dequeuePos;
+
+    _Alignas(CACHE_LINE) size_t mask;
+    size_t elemSize;
+    size_t cellSize;        // sequence number + element, rounded to 8 bytes
+    unsigned char *cells;
+} MpmcQueue;
+
+#define MPMC_CELL(q, pos) ((q)->cells + ((pos) & (q)->mask) * (q)->cellSize)
+#define MPMC_SEQ(cell) ((_Atomic size_t*)(cell))
+#define MPMC_DATA(cell) ((cell) + sizeof(size_t))
+
+MpmcQueue* createMpmcQueue(size_t capacity, size_t elemSize) {
+    MpmcQueue* q = (MpmcQueue*)allocAligned(sizeof(MpmcQueue));
+    if (!q) {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    capacity = nextPowerOfTwo(capacity);
+    q->mask = capacity - 1;
+    q->elemSize = elemSize;
+    q->cellSize = (sizeof(size_t) + elemSize + 7) & ~(size_t)7;
+    q->cells = (unsigned char*)allocAligned(capacity * q->cellSize);
+    if (!q->cells) {
+        printf("Memory allocation failed!\n");
+        free(q);
+        return NULL;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(MPMC_SEQ(q->cells + i * q->cellSize), i);
+    }
+    atomic_init(&q->enqueuePos, 0);
+    atomic_init(&q->dequeuePos, 0);
+    return q;
+}
+
+// add one element; returns false when full
+bool mpmcEnqueue(MpmcQueue* q, const void* elem) {
+    size_t pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+    unsigned char* cell;
+    for (;;) {
+        cell = MPMC_CELL(q, pos);
+        size_t seq = atomic_load_explicit(MPMC_SEQ(cell), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->enqueuePos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+        }
+    }
+    memcpy(MPMC_DATA(cell), elem, q->elemSize);
+    atomic_store_explicit(MPMC_SEQ(cell), pos + 1, memory_order_release);
+    return true;
+}
+
+// remove one element; returns false when empty
+bool mpmcDequeue(MpmcQueue* q, void* out) {
+    size_t pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+    unsigned char* cell;
+    for (;;) {
+        cell = MPMC_CELL(q, pos);
+        size_t seq = atomic_load_explicit(MPMC_SEQ(cell), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->dequeuePos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+        }
+    }
+    memcpy(out, MPMC_DATA(cell), q->elemSize);
+    atomic_store_explicit(MPMC_SEQ(cell), pos + q->mask + 1, memory_order_release);
+    return true;
+}
+
+// add up to n elements, claiming a run of consecutive slots with one CAS
+size_t mpmcEnqueueN(MpmcQueue* q, const void* elems, size_t n) {
+    if (n > q->mask + 1) {
+        n = q->mask + 1;
+    }
+    size_t pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+    size_t claimed;
+    for (;;) {
+        // count how many slots starting at pos are free for this lap
+        claimed = 0;
+        while (claimed < n) {
+            unsigned char* cell = MPMC_CELL(q, pos + claimed);
+            size_t seq = atomic_load_explicit(MPMC_SEQ(cell), memory_order_acquire);
+            if (seq != pos + claimed) {
+                break;
+            }
+            claimed++;
+        }
+        if (claimed == 0) {
+            unsigned char* cell = MPMC_CELL(q, pos);
+            size_t seq = atomic_load_explicit(MPMC_SEQ(cell), memory_order_acquire);
+            if ((intptr_t)seq - (intptr_t)pos < 0) {
+                return 0;  // full
+            }
+            pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+            continue;
+        }
+        if (atomic_compare_exchange_weak_explicit(&q->enqueuePos, &pos, pos + claimed,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            break;
+        }
+    }
+    const unsigned char* src = (const unsigned char*)elems;
+    for (size_t i = 0; i < claimed; i++) {
+        unsigned char* cell = MPMC_CELL(q, pos + i);
+        memcpy(MPMC_DATA(cell), src + i * q->elemSize, q->elemSize);
+        atomic_store_explicit(MPMC_SEQ(cell), pos + i + 1, memory_order_release);
+    }
+    return claimed;
+}
+
+// remove up to n elements, claiming a run of consecutive slots with one CAS
+size_t mpmcDequeueN(MpmcQueue* q, void* out, size_t n) {
+    if (n > q->mask + 1) {
+        n = q->mask + 1;
+    }
+    size_t pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+    size_t claimed;
+    for (;;) {
+        claimed = 0;
+        while (claimed < n) {
+            unsigned char* cell = MPMC_CELL(q, pos + claimed);
+            size_t seq = atomic_load_explicit(MPMC_SEQ(cell), memory_order_acquire);
+            if (seq != pos + claimed + 1) {
+                break;
+            }
+            claimed++;
+        }
+        if (claimed == 0) {
+            unsigned char* cell = MPMC_CELL(q, pos);
+            size_t seq = atomic_load_explicit(MPMC_SEQ(cell), memory_order_acquire);
+            if ((intptr_t)seq - (intptr_t)(pos + 1) < 0) {
+                return 0;  // empty
+            }
+            pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+            continue;
+        }
+        if (atomic_compare_exchange_weak_explicit(&q->dequeuePos, &pos, pos + claimed,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            break;
+        }
+    }
+    unsigned char* dst = (unsigned char*)out;
+    for (size_t i = 0; i < claimed; i++) {
+        unsigned char* cell = MPMC_CELL(q, pos + i);
+        memcpy(dst + i * q->elemSize, MPMC_DATA(cell), q->elemSize);
+        atomic_store_explicit(MPMC_SEQ(cell), pos + i + q->mask + 1, memory_order_release);
+    }
+    return claimed;
+}
+
+void freeMpmcQueue(MpmcQueue* q) {
+    if (q) {
+        free(q->cells);
+        free(q);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Benchmarks
+// ---------------------------------------------------------------------------
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// spin briefly, then give the core away (keeps single-core machines moving)
+static void backoff(unsigned* spins) {
+    if (++*spins >= SPIN_BEFORE_YIELD) {
+        *spins = 0;
+        sched_yield();
+    }
+}
+
+// pin the calling thread to core (index % number of online cores)
+static void pinToCore(int index) {
+#ifdef __linux__
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores <= 0) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(index % cores, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)index;
+#endif
+}
+
+typedef struct {
+    SpscQueue* ping;
+    SpscQueue* pong;
+    long rounds;
+} PingPongArgs;
+
+// echo every message from ping back on pong
+static void* pongThread(void* arg) {
+    PingPongArgs* a = (PingPongArgs*)arg;
+    pinToCore(1);
+    unsigned spins = 0;
+    for (long i = 0; i < a->rounds; i++) {
+        uint64_t msg;
+        while (!spscDequeue(a->ping, &msg)) backoff(&spins);
+        while (!spscEnqueue(a->pong, &msg)) backoff(&spins);
+    }
+    return NULL;
+}
+
+// round-trip latency: one message in flight between two threads
+void benchmarkPingPong(long rounds) {
+    PingPongArgs args = { createSpscQueue(16, sizeof(uint64_t)),
+                          createSpscQueue(16, sizeof(uint64_t)), rounds };
+    pthread_t t;
+    pthread_create(&t, NULL, pongThread, &args);
+    pinToCore(0);
+
+    unsigned spins = 0;
+    double start = nowSeconds();
+    for (long i = 0; i < rounds; i++) {
+        uint64_t msg = (uint64_t)i, reply;
+        while (!spscEnqueue(args.ping, &msg)) backoff(&spins);
+        while (!spscDequeue(args.pong, &reply)) backoff(&spins);
+    }
+    double elapsed = nowSeconds() - start;
+    pthread_join(t, NULL);
+
+    printf("SPSC ping-pong: %ld round trips, %.1f ns per round trip\n",
+           rounds, elapsed * 1e9 / rounds);
+    freeSpscQueue(args.ping);
+    freeSpscQueue(args.pong);
+}
+
+typedef struct {
+    SpscQueue* q;
+    long messages;
+    size_t batch;
+    uint64_t checksum;
+} SpscArgs;
+
+static void* spscProducer(void* arg) {
+    SpscArgs* a = (SpscArgs*)arg;
+    pinToCore(0);
+    uint64_t buf[256];
+    unsigned spins = 0;
+    long sent = 0;
+    while (sent < a->messages) {
+        if (a->batch == 1) {
+            uint64_t v = (uint64_t)sent;
+            if (spscEnqueue(a->q, &v)) sent++; else backoff(&spins);
+            continue;
+        }
+        size_t want = a->batch;
+        if ((long)want > a->messages - sent) want = (size_t)(a->messages - sent);
+        for (size_t i = 0; i < want; i++) buf[i] = (uint64_t)(sent + (long)i);
+        size_t done = 0;
+        while (done < want) {
+            size_t k = spscEnqueueN(a->q, buf + done, want - done);
+            if (k == 0) backoff(&spins);
+            done += k;
+        }
+        sent += (long)want;
+    }
+    return NULL;
+}
+
+static void* spscConsumer(void* arg) {
+    SpscArgs* a = (SpscArgs*)arg;
+    pinToCore(1);
+    uint64_t buf[256];
+    unsigned spins = 0;
+    long received = 0;
+    uint64_t sum = 0;
+    while (received < a->messages) {
+        if (a->batch == 1) {
+            uint64_t v;
+            if (spscDequeue(a->q, &v)) { sum += v; received++; } else backoff(&spins);
+            continue;
+        }
+        size_t k = spscDequeueN(a->q, buf, a->batch);
+        if (k == 0) { backoff(&spins); continue; }
+        for (size_t i = 0; i < k; i++) sum += buf[i];
+        received += (long)k;
+    }
+    a->checksum = sum;
+    return NULL;
+}
+
+// one producer and one consumer streaming uint64_t messages
+void benchmarkSpscThroughput(long messages, size_t batch) {
+    SpscArgs args = { createSpscQueue(4096, sizeof(uint64_t)), messages, batch, 0 };
+    pthread_t p, c;
+    double start = nowSeconds();
+    pthread_create(&c, NULL, spscConsumer, &args);
+    pthread_create(&p, NULL, spscProducer, &args);
+    pthread_join(p, NULL);
+    pthread_join(c, NULL);
+    double elapsed = nowSeconds() - start;
+
+    uint64_t expected = (uint64_t)messages * (uint64_t)(messages - 1) / 2;
+    printf("SPSC batch %-3zu: %6.1f M msgs/s  (checksum %s)\n", batch,
+           messages / elapsed / 1e6, args.checksum == expected ? "ok" : "MISMATCH");
+    freeSpscQueue(args.q);
+}
+
+typedef struct {
+    MpmcQueue* q;
+    int id;
+    long messages;          // per producer, or total for consumers to share
+    size_t batch;
+    _Atomic long* remaining;
+    uint64_t checksum;
+} MpmcArgs;
+
+static void* mpmcProducer(void* arg) {
+    MpmcArgs* a = (MpmcArgs*)arg;
+    pinToCore(a->id);
+    uint64_t buf[256];
+    unsigned spins = 0;
+    long sent = 0;
+    while (sent < a->messages) {
+        size_t want = a->batch;
+        if ((long)want > a->messages - sent) want = (size_t)(a->messages - sent);
+        for (size_t i = 0; i < want; i++) buf[i] = (uint64_t)(sent + (long)i);
+        size_t done = 0;
+        while (done < want) {
+            size_t k = want - done == 1 ? (mpmcEnqueue(a->q, buf + done) ? 1 : 0)
+                                        : mpmcEnqueueN(a->q, buf + done, want - done);
+            if (k == 0) backoff(&spins);
+            done += k;
+        }
+        sent += (long)want;
+    }
+    return NULL;
+}
+
+static void* mpmcConsumer(void* arg) {
+    MpmcArgs* a = (MpmcArgs*)arg;
+    pinToCore(a->id);
+    uint64_t buf[256];
+    unsigned spins = 0;
+    uint64_t sum = 0;
+    while (atomic_load_explicit(a->remaining, memory_order_relaxed) > 0) {
+        size_t k = a->batch == 1 ? (mpmcDequeue(a->q, buf) ? 1 : 0)
+                                 : mpmcDequeueN(a->q, buf, a->batch);
+        if (k == 0) { backoff(&spins); continue; }
+        for (size_t i = 0; i < k; i++) sum += buf[i];
+        atomic_fetch_sub_explicit(a->remaining, (long)k, memory_order_relaxed);
+    }
+    a->checksum = sum;
+    return NULL;
+}
+
+// several producers and consumers sharing one bounded queue
+void benchmarkMpmcThroughput(int producers, int consumers, long perProducer, size_t batch) {
+    MpmcQueue* q = createMpmcQueue(4096, sizeof(uint64_t));
+    _Atomic long remaining = (long)producers * perProducer;
+    int total = producers + consumers;
+    pthread_t* threads = (pthread_t*)malloc(total * sizeof(pthread_t));
+    MpmcArgs* args = (MpmcArgs*)malloc(total * sizeof(MpmcArgs));
+
+    double start = nowSeconds();
+    for (int i = 0; i < total; i++) {
+        args[i] = (MpmcArgs){ q, i, perProducer, batch, &remaining, 0 };
+        pthread_create(&threads[i], NULL, i < producers ? mpmcProducer : mpmcConsumer, &args[i]);
+    }
+    uint64_t sum = 0;
+    for (int i = 0; i < total; i++) {
+        pthread_join(threads[i], NULL);
+        sum += args[i].checksum;
+    }
+    double elapsed = nowSeconds() - start;
+
+    uint64_t expected = (uint64_t)producers * ((uint64_t)perProducer * (uint64_t)(perProducer - 1) / 2);
+    printf("MPMC %dP/%dC batch %-3zu: %6.1f M msgs/s  (checksum %s)\n", producers, consumers,
+           batch, producers * perProducer / elapsed / 1e6, sum == expected ? "ok" : "MISMATCH");
+    free(threads);
+    free(args);
+    freeMpmcQueue(q);
+}
+
+// ---------------------------------------------------------------------------
+
+typedef struct Order {
+    int id;
+    double amount;
+} Order;
+
+int main() {
+    // single-threaded generic queue with a struct element type
+    RingQueue* orders = createRingQueue(5, sizeof(Order));
+    printf("Capacity (rounded to power of two): %zu\n", ringCapacity(orders));
+
+    Order batch[3] = { {1, 9.5}, {2, 12.0}, {3, 3.25} };
+    printf("Enqueued in batch: %zu\n", ringEnqueueN(orders, batch, 3));
+    Order o = {4, 40.0};
+    ringEnqueue(orders, &o);
+    printf("Size: %zu\n", ringSize(orders));
+
+    ringPeek(orders, &o);
+    printf("Peek: order %d (%.2f)\n", o.id, o.amount);
+    while (ringDequeue(orders, &o)) {
+        printf("Dequeue: order %d (%.2f)\n", o.id, o.amount);
+    }
+    printf("isEmpty: %d\n\n", ringIsEmpty(orders));
+    freeRingQueue(orders);
+
+    printf("Online cores: %ld\n", sysconf(_SC_NPROCESSORS_ONLN));
+    benchmarkPingPong(100000);
+    benchmarkSpscThroughput(10000000, 1);
+    benchmarkSpscThroughput(10000000, 64);
+    benchmarkMpmcThroughput(2, 2, 2000000, 1);
+    benchmarkMpmcThroughput(2, 2, 2000000, 32);
+    return 0;
+}
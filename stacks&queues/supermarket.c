@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <string.h>
 
+// See supermarketSimulation.c for the discrete-event, many-lane version of this model.
 #define MAX_COUNTERS 3
 #define NAME_LEN 50
 
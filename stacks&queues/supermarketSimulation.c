@@ -0,0 +1,814 @@
+// Discrete-event simulation of the supermarket checkout model in supermarket.c,
+// scaled up for capacity planning (millions of customers, hundreds of lanes).
+//
+//   - Event list: calendar queue (Brown, 1988) with O(1) expected insert/remove
+//   - Arrivals and service times drawn from configurable distributions
+//   - Join-shortest-queue through a min-heap of lane lengths: O(log k) per customer
+//   - Customers are 32-bit interned IDs; names (when present) live in one arena
+//   - Independent replications run on parallel threads and are merged into a
+//     log-bucketed wait-time histogram for percentiles
+//
+// Compile with: gcc -O2 -pthread supermarketSimulation.c -o supermarketSimulation -lm
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CALENDAR_MIN_BUCKETS 8
+#define CALENDAR_SAMPLE 25
+#define HIST_SUB_BITS 6
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS ((64 - HIST_SUB_BITS) * HIST_SUB)
+#define HIST_TICKS_PER_UNIT 1000.0   // histogram resolution: 1/1000 time unit
+#define MAX_REPLICATIONS 64
+
+// ---------------------------------------------------------------------------
+// Random numbers and distributions
+// ---------------------------------------------------------------------------
+
+typedef struct Rng {
+    uint64_t state;
+} Rng;
+
+void rngSeed(Rng* rng, uint64_t seed) {
+    // splitmix64 so nearby seeds give unrelated streams
+    uint64_t z = seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    rng->state = (z ^ (z >> 31)) | 1;
+}
+
+// xorshift64*, uniform in (0, 1)
+double rngUniform(Rng* rng) {
+    uint64_t x = rng->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng->state = x;
+    return ((x * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0) + 0x1.0p-54;
+}
+
+double rngNormal(Rng* rng) {
+    double u = rngUniform(rng);
+    double v = rngUniform(rng);
+    return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+typedef enum {
+    DIST_DETERMINISTIC,
+    DIST_EXPONENTIAL,
+    DIST_ERLANG,        // sum of `shape` exponentials, cv = 1/sqrt(shape)
+    DIST_LOGNORMAL      // `shape` is the coefficient of variation
+} DistributionType;
+
+typedef struct Distribution {
+    DistributionType type;
+    double mean;
+    double shape;
+} Distribution;
+
+double sampleDistribution(const Distribution* d, Rng* rng) {
+    switch (d->type) {
+        case DIST_DETERMINISTIC:
+            return d->mean;
+        case DIST_EXPONENTIAL:
+            return -d->mean * log(rngUniform(rng));
+        case DIST_ERLANG: {
+            int k = d->shape < 1 ? 1 : (int)d->shape;
+            double product = 1.0;
+            for (int i = 0; i < k; i++) {
+                product *= rngUniform(rng);
+            }
+            return -(d->mean / k) * log(product);
+        }
+        case DIST_LOGNORMAL: {
+            double sigma2 = log(1.0 + d->shape * d->shape);
+            double mu = log(d->mean) - 0.5 * sigma2;
+            return exp(mu + sqrt(sigma2) * rngNormal(rng));
+        }
+    }
+    return d->mean;
+}
+
+const char* distributionName(DistributionType type) {
+    switch (type) {
+        case DIST_DETERMINISTIC: return "deterministic";
+        case DIST_EXPONENTIAL: return "exponential";
+        case DIST_ERLANG: return "erlang";
+        case DIST_LOGNORMAL: return "lognormal";
+    }
+    return "?";
+}
+
+// ---------------------------------------------------------------------------
+// Calendar queue event list
+// ---------------------------------------------------------------------------
+// Events hash into buckets by "day" = floor(time / width); each bucket is a
+// time-sorted list. Dequeue walks the buckets in day order, taking the head of
+// the current bucket if it belongs to the current day. The bucket count follows
+// the event count, and the width is re-estimated from the average spacing of
+// the earliest events on every resize.
+
+typedef enum {
+    EVENT_ARRIVAL,
+    EVENT_DEPARTURE
+} EventType;
+
+typedef struct Event {
+    double time;
+    int64_t day;            // floor(time / width) for the current calendar
+    EventType type;
+    int lane;
+    struct Event* next;
+} Event;
+
+typedef struct CalendarQueue {
+    Event** buckets;
+    size_t bucketCount;     // power of two
+    double width;
+    int64_t currentDay;
+    size_t size;
+    bool resizeEnabled;
+    Event* freeList;        // recycled event nodes
+} CalendarQueue;
+
+static void calendarInit(CalendarQueue* cq, size_t bucketCount, double width, double startTime) {
+    cq->buckets = (Event**)calloc(bucketCount, sizeof(Event*));
+    if (!cq->buckets) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    cq->bucketCount = bucketCount;
+    cq->width = width;
+    cq->currentDay = (int64_t)(startTime / width);
+    cq->size = 0;
+}
+
+CalendarQueue* createCalendarQueue(void) {
+    CalendarQueue* cq = (CalendarQueue*)malloc(sizeof(CalendarQueue));
+    if (!cq) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    calendarInit(cq, CALENDAR_MIN_BUCKETS, 1.0, 0.0);
+    cq->resizeEnabled = true;
+    cq->freeList = NULL;
+    return cq;
+}
+
+static void calendarInsert(CalendarQueue* cq, Event* e) {
+    e->day = (int64_t)(e->time / cq->width);
+    Event** link = &cq->buckets[(uint64_t)e->day & (cq->bucketCount - 1)];
+    while (*link && (*link)->time <= e->time) {
+        link = &(*link)->next;
+    }
+    e->next = *link;
+    *link = e;
+    cq->size++;
+}
+
+static Event* calendarRemoveMin(CalendarQueue* cq) {
+    if (cq->size == 0) {
+        return NULL;
+    }
+    size_t mask = cq->bucketCount - 1;
+    for (size_t scanned = 0; scanned < cq->bucketCount; scanned++) {
+        Event** bucket = &cq->buckets[(uint64_t)cq->currentDay & mask];
+        if (*bucket && (*bucket)->day <= cq->currentDay) {
+            Event* e = *bucket;
+            *bucket = e->next;
+            cq->size--;
+            return e;
+        }
+        cq->currentDay++;
+    }
+    // a whole year passed without an event: jump straight to the earliest one
+    Event* best = NULL;
+    for (size_t i = 0; i < cq->bucketCount; i++) {
+        Event* head = cq->buckets[i];
+        if (head && (!best || head->time < best->time)) {
+            best = head;
+        }
+    }
+    cq->currentDay = best->day;
+    return calendarRemoveMin(cq);
+}
+
+static void calendarResize(CalendarQueue* cq, size_t newBucketCount) {
+    // estimate the new width from the spacing of the earliest events
+    Event* sample[CALENDAR_SAMPLE];
+    int sampled = 0;
+    while (sampled < CALENDAR_SAMPLE && cq->size > 0) {
+        sample[sampled++] = calendarRemoveMin(cq);
+    }
+    double newWidth = cq->width;
+    if (sampled > 1) {
+        double span = sample[sampled - 1]->time - sample[0]->time;
+        double average = span / (sampled - 1);
+        // ignore large outlying gaps, as in Brown's original estimate
+        double total = 0.0;
+        int counted = 0;
+        for (int i = 1; i < sampled; i++) {
+            double gap = sample[i]->time - sample[i - 1]->time;
+            if (gap <= 2.0 * average) {
+                total += gap;
+                counted++;
+            }
+        }
+        if (counted > 0 && total > 0.0) {
+            newWidth = 3.0 * total / counted;
+        }
+    }
+
+    // collect every remaining event and rebuild the bucket array
+    Event* all = NULL;
+    for (size_t i = 0; i < cq->bucketCount; i++) {
+        Event* e = cq->buckets[i];
+        while (e) {
+            Event* next = e->next;
+            e->next = all;
+            all = e;
+            e = next;
+        }
+    }
+    double startTime = sampled > 0 ? sample[0]->time : cq->currentDay * cq->width;
+    free(cq->buckets);
+    calendarInit(cq, newBucketCount, newWidth, startTime);
+    for (int i = 0; i < sampled; i++) {
+        calendarInsert(cq, sample[i]);
+    }
+    while (all) {
+        Event* next = all->next;
+        calendarInsert(cq, all);
+        all = next;
+    }
+}
+
+// schedule an event; the calendar grows when it averages over two events per bucket
+void scheduleEvent(CalendarQueue* cq, double time, EventType type, int lane) {
+    Event* e = cq->freeList;
+    if (e) {
+        cq->freeList = e->next;
+    } else {
+        e = (Event*)malloc(sizeof(Event));
+        if (!e) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+    }
+    e->time = time;
+    e->type = type;
+    e->lane = lane;
+    calendarInsert(cq, e);
+    if (cq->resizeEnabled && cq->size > 2 * cq->bucketCount) {
+        cq->resizeEnabled = false;
+        calendarResize(cq, cq->bucketCount * 2);
+        cq->resizeEnabled = true;
+    }
+}
+
+// take the earliest event into *out; returns false when no events remain
+bool nextEvent(CalendarQueue* cq, Event* out) {
+    Event* e = calendarRemoveMin(cq);
+    if (!e) {
+        return false;
+    }
+    *out = *e;
+    e->next = cq->freeList;
+    cq->freeList = e;
+    if (cq->resizeEnabled && cq->bucketCount > CALENDAR_MIN_BUCKETS &&
+        cq->size < cq->bucketCount / 2) {
+        cq->resizeEnabled = false;
+        calendarResize(cq, cq->bucketCount / 2);
+        cq->resizeEnabled = true;
+    }
+    return true;
+}
+
+void freeCalendarQueue(CalendarQueue* cq) {
+    for (size_t i = 0; i < cq->bucketCount; i++) {
+        Event* e = cq->buckets[i];
+        while (e) {
+            Event* next = e->next;
+            free(e);
+            e = next;
+        }
+    }
+    while (cq->freeList) {
+        Event* next = cq->freeList->next;
+        free(cq->freeList);
+        cq->freeList = next;
+    }
+    free(cq->buckets);
+    free(cq);
+}
+
+// ---------------------------------------------------------------------------
+// Interned customer names
+// ---------------------------------------------------------------------------
+// Each distinct name gets a dense uint32_t ID; names are stored once in a
+// growing character arena and looked up through an open-addressing table.
+
+typedef struct NameTable {
+    char* arena;
+    size_t arenaUsed;
+    size_t arenaCapacity;
+    size_t* offsets;        // offsets[id] = start of name id in the arena
+    uint32_t count;
+    uint32_t offsetCapacity;
+    uint32_t* slots;        // id + 1, or 0 for empty
+    size_t slotMask;
+} NameTable;
+
+static uint64_t hashName(const char* s) {
+    uint64_t h = 1469598103934665603ULL;   // FNV-1a
+    while (*s) {
+        h ^= (unsigned char)*s++;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+NameTable* createNameTable(void) {
+    NameTable* t = (NameTable*)calloc(1, sizeof(NameTable));
+    if (!t) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    t->arenaCapacity = 256;
+    t->arena = (char*)malloc(t->arenaCapacity);
+    t->offsetCapacity = 16;
+    t->offsets = (size_t*)malloc(t->offsetCapacity * sizeof(size_t));
+    t->slotMask = 31;
+    t->slots = (uint32_t*)calloc(t->slotMask + 1, sizeof(uint32_t));
+    if (!t->arena || !t->offsets || !t->slots) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    return t;
+}
+
+const char* nameOf(const NameTable* t, uint32_t id) {
+    return id < t->count ? t->arena + t->offsets[id] : NULL;
+}
+
+static void growNameSlots(NameTable* t) {
+    size_t newMask = t->slotMask * 2 + 1;
+    uint32_t* slots = (uint32_t*)calloc(newMask + 1, sizeof(uint32_t));
+    if (!slots) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (uint32_t id = 0; id < t->count; id++) {
+        size_t i = hashName(nameOf(t, id)) & newMask;
+        while (slots[i]) {
+            i = (i + 1) & newMask;
+        }
+        slots[i] = id + 1;
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->slotMask = newMask;
+}
+
+// return the ID of `name`, adding it to the table the first time it is seen
+uint32_t internName(NameTable* t, const char* name) {
+    size_t i = hashName(name) & t->slotMask;
+    while (t->slots[i]) {
+        uint32_t id = t->slots[i] - 1;
+        if (strcmp(nameOf(t, id), name) == 0) {
+            return id;
+        }
+        i = (i + 1) & t->slotMask;
+    }
+
+    size_t len = strlen(name) + 1;
+    while (t->arenaUsed + len > t->arenaCapacity) {
+        t->arenaCapacity *= 2;
+        t->arena = (char*)realloc(t->arena, t->arenaCapacity);
+    }
+    if (t->count == t->offsetCapacity) {
+        t->offsetCapacity *= 2;
+        t->offsets = (size_t*)realloc(t->offsets, t->offsetCapacity * sizeof(size_t));
+    }
+    if (!t->arena || !t->offsets) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    memcpy(t->arena + t->arenaUsed, name, len);
+    t->offsets[t->count] = t->arenaUsed;
+    t->arenaUsed += len;
+    t->slots[i] = t->count + 1;
+    uint32_t id = t->count++;
+    if ((size_t)t->count * 2 > t->slotMask) {
+        growNameSlots(t);
+    }
+    return id;
+}
+
+void freeNameTable(NameTable* t) {
+    if (t) {
+        free(t->arena);
+        free(t->offsets);
+        free(t->slots);
+        free(t);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Checkout lanes and the join-shortest-queue heap
+// ---------------------------------------------------------------------------
+
+typedef struct Customer {
+    uint32_t id;
+    double arrivalTime;
+} Customer;
+
+// FIFO of waiting customers (head is the one in service), growable ring
+typedef struct Lane {
+    Customer* ring;
+    uint32_t mask;
+    uint32_t head;
+    uint32_t length;        // customers in line, including the one in service
+    double busyTime;
+    uint64_t served;
+} Lane;
+
+static void lanePush(Lane* lane, Customer c) {
+    if (lane->length > lane->mask) {
+        uint32_t capacity = (lane->mask + 1) * 2;
+        Customer* ring = (Customer*)malloc(capacity * sizeof(Customer));
+        if (!ring) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        for (uint32_t i = 0; i < lane->length; i++) {
+            ring[i] = lane->ring[(lane->head + i) & lane->mask];
+        }
+        free(lane->ring);
+        lane->ring = ring;
+        lane->mask = capacity - 1;
+        lane->head = 0;
+    }
+    lane->ring[(lane->head + lane->length) & lane->mask] = c;
+    lane->length++;
+}
+
+static Customer lanePop(Lane* lane) {
+    Customer c = lane->ring[lane->head];
+    lane->head = (lane->head + 1) & lane->mask;
+    lane->length--;
+    return c;
+}
+
+// min-heap of lane indices ordered by (length, index); position[] tracks
+// where each lane sits so a length change re-heapifies in O(log k)
+typedef struct LaneHeap {
+    int* heap;
+    int* position;
+    const Lane* lanes;
+    int count;
+} LaneHeap;
+
+static bool laneLess(const LaneHeap* h, int a, int b) {
+    uint32_t la = h->lanes[a].length, lb = h->lanes[b].length;
+    return la < lb || (la == lb && a < b);
+}
+
+static void heapSwap(LaneHeap* h, int i, int j) {
+    int a = h->heap[i], b = h->heap[j];
+    h->heap[i] = b;
+    h->heap[j] = a;
+    h->position[b] = i;
+    h->position[a] = j;
+}
+
+// lane got shorter: move it towards the root
+static void laneHeapDecrease(LaneHeap* h, int lane) {
+    int i = h->position[lane];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!laneLess(h, h->heap[i], h->heap[parent])) break;
+        heapSwap(h, i, parent);
+        i = parent;
+    }
+}
+
+// lane got longer: move it towards the leaves
+static void laneHeapIncrease(LaneHeap* h, int lane) {
+    int i = h->position[lane];
+    for (;;) {
+        int left = 2 * i + 1, right = left + 1, smallest = i;
+        if (left < h->count && laneLess(h, h->heap[left], h->heap[smallest])) smallest = left;
+        if (right < h->count && laneLess(h, h->heap[right], h->heap[smallest])) smallest = right;
+        if (smallest == i) break;
+        heapSwap(h, i, smallest);
+        i = smallest;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Wait-time histogram (log-linear buckets, ~1.6% relative error)
+// ---------------------------------------------------------------------------
+
+typedef struct WaitHistogram {
+    uint64_t counts[HIST_BUCKETS];
+    uint64_t total;
+    double sum;
+    double max;
+} WaitHistogram;
+
+static int histogramIndex(uint64_t ticks) {
+    if (ticks < 2 * HIST_SUB) {
+        return (int)ticks;
+    }
+    int shift = 63 - __builtin_clzll(ticks) - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB + (int)((ticks >> shift) - HIST_SUB);
+}
+
+static double histogramValue(int index) {
+    if (index < 2 * HIST_SUB) {
+        return index / HIST_TICKS_PER_UNIT;
+    }
+    int shift = index / HIST_SUB - 1;
+    uint64_t low = (uint64_t)(index % HIST_SUB + HIST_SUB) << shift;
+    return (low + ((uint64_t)1 << shift) / 2.0) / HIST_TICKS_PER_UNIT;
+}
+
+void histogramRecord(WaitHistogram* h, double wait) {
+    double scaled = wait * HIST_TICKS_PER_UNIT;
+    uint64_t ticks = scaled < 1.8e19 ? (uint64_t)scaled : UINT64_MAX >> 1;
+    h->counts[histogramIndex(ticks)]++;
+    h->total++;
+    h->sum += wait;
+    if (wait > h->max) h->max = wait;
+}
+
+void histogramMerge(WaitHistogram* into, const WaitHistogram* from) {
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        into->counts[i] += from->counts[i];
+    }
+    into->total += from->total;
+    into->sum += from->sum;
+    if (from->max > into->max) into->max = from->max;
+}
+
+double histogramPercentile(const WaitHistogram* h, double p) {
+    if (h->total == 0) return 0.0;
+    uint64_t rank = (uint64_t)ceil(p / 100.0 * h->total);
+    if (rank == 0) rank = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += h->counts[i];
+        if (seen >= rank) {
+            double v = histogramValue(i);
+            return v < h->max ? v : h->max;
+        }
+    }
+    return h->max;
+}
+
+// ---------------------------------------------------------------------------
+// Simulation
+// ---------------------------------------------------------------------------
+
+typedef struct SimConfig {
+    int lanes;
+    uint64_t customers;         // arrivals to generate
+    Distribution interarrival;
+    Distribution service;
+    uint64_t seed;
+} SimConfig;
+
+typedef struct SimResult {
+    WaitHistogram waits;
+    double endTime;
+    double utilization;
+    uint32_t maxLaneLength;
+    uint64_t events;
+} SimResult;
+
+// optional per-customer trace for small, named scenarios
+typedef void (*SimTrace)(double time, EventType type, uint32_t customer, int lane, void* user);
+
+// run one replication; `arrivalIds` (if non-NULL) supplies the customer IDs in order
+void runSimulation(const SimConfig* cfg, const uint32_t* arrivalIds,
+                   SimTrace trace, void* user, SimResult* result) {
+    Rng rng;
+    rngSeed(&rng, cfg->seed);
+    memset(result, 0, sizeof(*result));
+
+    Lane* lanes = (Lane*)calloc(cfg->lanes, sizeof(Lane));
+    LaneHeap heap = { (int*)malloc(cfg->lanes * sizeof(int)),
+                      (int*)malloc(cfg->lanes * sizeof(int)), lanes, cfg->lanes };
+    if (!lanes || !heap.heap || !heap.position) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (int i = 0; i < cfg->lanes; i++) {
+        lanes[i].mask = 15;
+        lanes[i].ring = (Customer*)malloc(16 * sizeof(Customer));
+        heap.heap[i] = heap.position[i] = i;
+    }
+
+    CalendarQueue* events = createCalendarQueue();
+    uint64_t arrived = 0;
+    if (cfg->customers > 0) {
+        scheduleEvent(events, sampleDistribution(&cfg->interarrival, &rng), EVENT_ARRIVAL, -1);
+    }
+
+    Event e;
+    while (nextEvent(events, &e)) {
+        result->events++;
+        double now = e.time;
+        if (e.type == EVENT_ARRIVAL) {
+            uint32_t id = arrivalIds ? arrivalIds[arrived] : (uint32_t)arrived;
+            arrived++;
+            if (arrived < cfg->customers) {
+                scheduleEvent(events, now + sampleDistribution(&cfg->interarrival, &rng),
+                              EVENT_ARRIVAL, -1);
+            }
+
+            int idx = heap.heap[0];                 // join the shortest queue
+            Lane* lane = &lanes[idx];
+            lanePush(lane, (Customer){ id, now });
+            laneHeapIncrease(&heap, idx);
+            if (lane->length > result->maxLaneLength) result->maxLaneLength = lane->length;
+            if (trace) trace(now, EVENT_ARRIVAL, id, idx, user);
+
+            if (lane->length == 1) {                // idle lane: serve immediately
+                double service = sampleDistribution(&cfg->service, &rng);
+                lane->busyTime += service;
+                histogramRecord(&result->waits, 0.0);
+                scheduleEvent(events, now + service, EVENT_DEPARTURE, idx);
+            }
+        } else {
+            Lane* lane = &lanes[e.lane];
+            Customer done = lanePop(lane);
+            lane->served++;
+            laneHeapDecrease(&heap, e.lane);
+            if (trace) trace(now, EVENT_DEPARTURE, done.id, e.lane, user);
+
+            if (lane->length > 0) {                 // next customer starts service
+                Customer next = lane->ring[lane->head];
+                double service = sampleDistribution(&cfg->service, &rng);
+                lane->busyTime += service;
+                histogramRecord(&result->waits, now - next.arrivalTime);
+                scheduleEvent(events, now + service, EVENT_DEPARTURE, e.lane);
+            }
+        }
+        result->endTime = now;
+    }
+
+    double busy = 0.0;
+    for (int i = 0; i < cfg->lanes; i++) {
+        busy += lanes[i].busyTime;
+        free(lanes[i].ring);
+    }
+    result->utilization = result->endTime > 0 ? busy / (cfg->lanes * result->endTime) : 0.0;
+
+    freeCalendarQueue(events);
+    free(heap.heap);
+    free(heap.position);
+    free(lanes);
+}
+
+// ---------------------------------------------------------------------------
+// Parallel independent replications
+// ---------------------------------------------------------------------------
+
+typedef struct ReplicationJob {
+    const SimConfig* cfg;
+    SimResult* results;
+    int replications;
+    int threadId;
+    int threadCount;
+} ReplicationJob;
+
+static void* replicationWorker(void* arg) {
+    ReplicationJob* job = (ReplicationJob*)arg;
+    for (int r = job->threadId; r < job->replications; r += job->threadCount) {
+        SimConfig cfg = *job->cfg;
+        cfg.seed = job->cfg->seed + (uint64_t)r;
+        runSimulation(&cfg, NULL, NULL, NULL, &job->results[r]);
+    }
+    return NULL;
+}
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// run `replications` independent seeds on up to `threads` threads and report
+// the pooled wait-time percentiles plus a 95% interval on the mean wait
+void runReplications(const SimConfig* cfg, int replications, int threads) {
+    if (replications > MAX_REPLICATIONS) replications = MAX_REPLICATIONS;
+    if (threads > replications) threads = replications;
+    if (threads < 1) threads = 1;
+
+    SimResult* results = (SimResult*)malloc(replications * sizeof(SimResult));
+    pthread_t* tids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    ReplicationJob* jobs = (ReplicationJob*)malloc(threads * sizeof(ReplicationJob));
+    WaitHistogram* pooled = (WaitHistogram*)calloc(1, sizeof(WaitHistogram));
+    if (!results || !tids || !jobs || !pooled) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    double start = nowSeconds();
+    for (int t = 0; t < threads; t++) {
+        jobs[t] = (ReplicationJob){ cfg, results, replications, t, threads };
+        pthread_create(&tids[t], NULL, replicationWorker, &jobs[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    double elapsed = nowSeconds() - start;
+
+    double meanSum = 0.0, meanSq = 0.0, utilization = 0.0;
+    uint64_t events = 0;
+    uint32_t maxLength = 0;
+    for (int r = 0; r < replications; r++) {
+        double mean = results[r].waits.sum / results[r].waits.total;
+        meanSum += mean;
+        meanSq += mean * mean;
+        utilization += results[r].utilization;
+        events += results[r].events;
+        if (results[r].maxLaneLength > maxLength) maxLength = results[r].maxLaneLength;
+        histogramMerge(pooled, &results[r].waits);
+    }
+    double grandMean = meanSum / replications;
+    double variance = replications > 1
+        ? (meanSq - replications * grandMean * grandMean) / (replications - 1) : 0.0;
+    double halfWidth = 1.96 * sqrt(variance > 0 ? variance : 0) / sqrt((double)replications);
+
+    printf("%d lanes, %d x %llu customers, interarrival %s(%.4f), service %s(%.2f)\n",
+           cfg->lanes, replications, (unsigned long long)cfg->customers,
+           distributionName(cfg->interarrival.type), cfg->interarrival.mean,
+           distributionName(cfg->service.type), cfg->service.mean);
+    printf("  utilization %.3f, longest line %u\n", utilization / replications, maxLength);
+    printf("  mean wait %.4f +/- %.4f (95%%)\n", grandMean, halfWidth);
+    printf("  wait p50 %.4f  p90 %.4f  p99 %.4f  p99.9 %.4f  max %.4f\n",
+           histogramPercentile(pooled, 50), histogramPercentile(pooled, 90),
+           histogramPercentile(pooled, 99), histogramPercentile(pooled, 99.9), pooled->max);
+    printf("  %llu events in %.2f s on %d threads (%.1f M events/s)\n\n",
+           (unsigned long long)events, elapsed, threads, events / elapsed / 1e6);
+
+    free(results);
+    free(tids);
+    free(jobs);
+    free(pooled);
+}
+
+// ---------------------------------------------------------------------------
+
+static void printTrace(double time, EventType type, uint32_t customer, int lane, void* user) {
+    const NameTable* names = (const NameTable*)user;
+    if (type == EVENT_ARRIVAL) {
+        printf("t=%4.1f  %s joined Counter %d\n", time, nameOf(names, customer), lane + 1);
+    } else {
+        printf("t=%4.1f  %s is processed at Counter %d\n", time, nameOf(names, customer), lane + 1);
+    }
+}
+
+int main() {
+    // the supermarket.c scenario, replayed through the event engine
+    NameTable* names = createNameTable();
+    const char* people[] = { "Alice", "Bob", "Charlie", "David", "Eve" };
+    uint32_t ids[5];
+    for (int i = 0; i < 5; i++) {
+        ids[i] = internName(names, people[i]);
+    }
+    printf("Interned \"Charlie\" again -> id %u\n", internName(names, "Charlie"));
+
+    SimConfig small = { 3, 5, { DIST_DETERMINISTIC, 1.0, 0 }, { DIST_DETERMINISTIC, 4.0, 0 }, 1 };
+    SimResult smallResult;
+    runSimulation(&small, ids, printTrace, names, &smallResult);
+    printf("Mean wait: %.2f\n\n", smallResult.waits.sum / smallResult.waits.total);
+    freeNameTable(names);
+
+    // capacity planning: hundreds of lanes at high load
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = cores > 0 ? (int)cores : 1;
+
+    SimConfig m200 = { 200, 500000, { DIST_EXPONENTIAL, 3.0 / (200 * 0.95), 0 },
+                       { DIST_EXPONENTIAL, 3.0, 0 }, 42 };
+    runReplications(&m200, 8, threads);
+
+    SimConfig lognormal = m200;
+    lognormal.service = (Distribution){ DIST_LOGNORMAL, 3.0, 1.5 };
+    runReplications(&lognormal, 8, threads);
+
+    SimConfig erlang = { 500, 500000, { DIST_ERLANG, 3.0 / (500 * 0.98), 2 },
+                         { DIST_ERLANG, 3.0, 4 }, 7 };
+    runReplications(&erlang, 8, threads);
+    return 0;
+}
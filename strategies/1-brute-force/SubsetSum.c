@@ -1,15 +1,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
 
 /**
  * Brute Force Strategy: Subset Sum Problem
  * Core Idea: Check all possible subsets to find one that sums to target
  * Time Complexity: O(2^n) where n is the number of elements
  * Space Complexity: O(2^n) for storing all subsets
+ *
+ * Subsets are 64-bit masks. The Gray-code scanner updates the running sum
+ * with one add or subtract per subset and splits the mask space across
+ * threads (compile with -pthread); matches go to a callback or buffer.
  */
 
-#define MAX_SIZE 20
+#define MAX_SIZE 40
 
 /**
  * Print a subset represented by a bitmask
@@ -17,11 +24,11 @@
  * @param n Size of array
  * @param mask Bitmask representing the subset
  */
-void printSubset(int arr[], int n, int mask) {
+void printSubset(int arr[], int n, uint64_t mask) {
     printf("[");
     bool first = true;
     for (int i = 0; i < n; i++) {
-        if ((mask & (1 << i)) != 0) {
+        if ((mask & (1ULL << i)) != 0) {
             if (!first) printf(", ");
             printf("%d", arr[i]);
             first = false;
@@ -37,42 +44,278 @@ void printSubset(int arr[], int n, int mask) {
  * @param mask Bitmask representing the subset
  * @return Sum of elements in the subset
  */
-int calculateSubsetSum(int arr[], int n, int mask) {
-    int sum = 0;
+long long calculateSubsetSum(int arr[], int n, uint64_t mask) {
+    long long sum = 0;
     for (int i = 0; i < n; i++) {
-        if ((mask & (1 << i)) != 0) {
+        if ((mask & (1ULL << i)) != 0) {
             sum += arr[i];
         }
     }
     return sum;
 }
 
+/* ======================================================================
+ * Gray-code enumeration
+ * Visiting masks in Gray-code order g(k) = k ^ (k >> 1) changes exactly one
+ * element between consecutive subsets, so the running sum needs a single
+ * add or subtract per step instead of an O(n) recomputation.
+ * ====================================================================== */
+
+#define GRAY_LANES 8           // independent sub-ranges advanced in lockstep
+#define GRAY_MAX_LANE_BITS 20  // at most 2^20 subsets per lane per block
+
+/**
+ * Called for every matching subset; return false to stop the scan
+ */
+typedef bool (*SubsetMatchCallback)(uint64_t mask, void* context);
+
+/**
+ * Compact match sink: stores up to capacity masks, counts all matches
+ */
+typedef struct {
+    uint64_t* masks;
+    size_t capacity;
+    size_t stored;
+    long long total;
+} SubsetMatchBuffer;
+
+bool bufferMatch(uint64_t mask, void* context) {
+    SubsetMatchBuffer* buffer = (SubsetMatchBuffer*)context;
+    if (buffer->stored < buffer->capacity) {
+        buffer->masks[buffer->stored++] = mask;
+    }
+    buffer->total++;
+    return true;
+}
+
+static int lowestSetBit(uint64_t x) {
+    int bit = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        bit++;
+    }
+    return bit;
+}
+
+static long long maskSum(const int arr[], int n, uint64_t mask) {
+    long long sum = 0;
+    for (int i = 0; i < n; i++) {
+        if (mask & (1ULL << i)) sum += arr[i];
+    }
+    return sum;
+}
+
+/**
+ * Scan Gray-code indices [first, first + count) with one update per step
+ * @return Number of matches reported (stops early if the callback says so)
+ */
+long long scanSubsetsGray(const int arr[], int n, long long target, uint64_t first,
+                          uint64_t count, SubsetMatchCallback onMatch, void* context) {
+    if (count == 0) return 0;
+    uint64_t mask = first ^ (first >> 1);
+    long long sum = maskSum(arr, n, mask);
+    long long matches = 0;
+    
+    for (uint64_t k = first;; k++) {
+        if (sum == target) {
+            matches++;
+            if (!onMatch(mask, context)) break;
+        }
+        if (k + 1 == first + count) break;
+        
+        int bit = lowestSetBit(k + 1);
+        mask ^= 1ULL << bit;
+        sum += (mask >> bit) & 1 ? arr[bit] : -arr[bit];
+    }
+    return matches;
+}
+
+/**
+ * Scan GRAY_LANES adjacent aligned blocks of 2^laneBits indices in lockstep.
+ * Because every lane starts on a multiple of the block size, all lanes flip
+ * the same element at each step; only the sign differs per lane, so the
+ * update loop is branch-free and vectorizes across lanes.
+ */
+static long long scanSubsetsGrayLanes(const int arr[], int n, long long target, uint64_t base,
+                                      int laneBits, SubsetMatchCallback onMatch, void* context) {
+    uint64_t laneSize = 1ULL << laneBits;
+    uint64_t masks[GRAY_LANES];
+    long long sums[GRAY_LANES];
+    long long matches = 0;
+    
+    for (int j = 0; j < GRAY_LANES; j++) {
+        uint64_t k = base + j * laneSize;
+        masks[j] = k ^ (k >> 1);
+        sums[j] = maskSum(arr, n, masks[j]);
+    }
+    
+    for (uint64_t t = 0;; t++) {
+        int hit = 0;
+        for (int j = 0; j < GRAY_LANES; j++) hit |= sums[j] == target;
+        
+        if (hit) {
+            for (int j = 0; j < GRAY_LANES; j++) {
+                if (sums[j] == target) {
+                    matches++;
+                    if (!onMatch(masks[j], context)) return -matches - 1;
+                }
+            }
+        }
+        if (t + 1 == laneSize) break;
+        
+        int bit = lowestSetBit(t + 1);
+        uint64_t flip = 1ULL << bit;
+        long long value = arr[bit];
+        for (int j = 0; j < GRAY_LANES; j++) {
+            masks[j] ^= flip;
+            long long sign = (long long)((masks[j] >> bit) & 1) * 2 - 1;
+            sums[j] += sign * value;
+        }
+    }
+    return matches;
+}
+
+typedef struct {
+    const int* arr;
+    int n;
+    long long target;
+    uint64_t firstBlock;
+    uint64_t blockCount;
+    int laneBits;
+    SubsetMatchCallback onMatch;
+    void* context;
+    long long matches;
+} GrayWorker;
+
+static void* grayWorkerRun(void* arg) {
+    GrayWorker* worker = (GrayWorker*)arg;
+    uint64_t blockSize = (uint64_t)GRAY_LANES << worker->laneBits;
+    worker->matches = 0;
+    
+    for (uint64_t b = 0; b < worker->blockCount; b++) {
+        uint64_t base = (worker->firstBlock + b) * blockSize;
+        long long found = scanSubsetsGrayLanes(worker->arr, worker->n, worker->target, base,
+                                               worker->laneBits, worker->onMatch, worker->context);
+        if (found < 0) {
+            worker->matches += -found - 1;
+            break;
+        }
+        worker->matches += found;
+    }
+    return NULL;
+}
+
+/**
+ * Enumerate all 2^n subsets (n <= MAX_SIZE) across numThreads threads.
+ * The mask space is cut into aligned blocks of GRAY_LANES lanes; thread t
+ * owns a contiguous run of blocks and reports to contexts[t], so callbacks
+ * need no locking. Matches arrive in Gray-code order within each lane.
+ * @return Total number of matching subsets reported
+ */
+long long parallelFindSubsetsWithSum(const int arr[], int n, long long target, int numThreads,
+                                     SubsetMatchCallback onMatch, void* const contexts[]) {
+    if (n < 0 || n > MAX_SIZE || numThreads < 1) return 0;
+    uint64_t totalSubsets = 1ULL << n;
+    
+    // Too small to split into lanes: plain Gray-code scan
+    if (n < 3) {
+        return scanSubsetsGray(arr, n, target, 0, totalSubsets, onMatch, contexts[0]);
+    }
+    
+    int laneBits = n - 3 < GRAY_MAX_LANE_BITS ? n - 3 : GRAY_MAX_LANE_BITS;
+    uint64_t blocks = totalSubsets / ((uint64_t)GRAY_LANES << laneBits);
+    if ((uint64_t)numThreads > blocks) numThreads = (int)blocks;
+    
+    GrayWorker* workers = (GrayWorker*)malloc(numThreads * sizeof(GrayWorker));
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    
+    for (int t = 0; t < numThreads; t++) {
+        uint64_t begin = blocks * t / numThreads;
+        uint64_t end = blocks * (t + 1) / numThreads;
+        workers[t] = (GrayWorker){arr, n, target, begin, end - begin, laneBits,
+                                  onMatch, contexts[t], 0};
+        pthread_create(&threads[t], NULL, grayWorkerRun, &workers[t]);
+    }
+    
+    long long matches = 0;
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+        matches += workers[t].matches;
+    }
+    
+    free(workers);
+    free(threads);
+    return matches;
+}
+
+/**
+ * Collect matching masks into one buffer using per-thread buffers
+ * @param out Buffer with masks/capacity set; stored and total are filled in
+ */
+void collectSubsetsWithSum(const int arr[], int n, long long target, int numThreads,
+                           SubsetMatchBuffer* out) {
+    if (numThreads < 1) numThreads = 1;
+    SubsetMatchBuffer* buffers = (SubsetMatchBuffer*)calloc(numThreads, sizeof(SubsetMatchBuffer));
+    void** contexts = (void**)calloc(numThreads, sizeof(void*));
+    
+    for (int t = 0; t < numThreads; t++) {
+        buffers[t].masks = (uint64_t*)malloc((out->capacity ? out->capacity : 1) * sizeof(uint64_t));
+        buffers[t].capacity = out->capacity;
+        contexts[t] = &buffers[t];
+    }
+    
+    parallelFindSubsetsWithSum(arr, n, target, numThreads, bufferMatch, contexts);
+    
+    out->stored = 0;
+    out->total = 0;
+    for (int t = 0; t < numThreads; t++) {
+        for (size_t i = 0; i < buffers[t].stored && out->stored < out->capacity; i++) {
+            out->masks[out->stored++] = buffers[t].masks[i];
+        }
+        out->total += buffers[t].total;
+        free(buffers[t].masks);
+    }
+    
+    free(buffers);
+    free(contexts);
+}
+
+static bool stopAtFirstMatch(uint64_t mask, void* context) {
+    (void)mask;
+    *(bool*)context = true;
+    return false;
+}
+
 /**
  * Find all subsets that sum to the target value using brute force
+ * Matches are collected by the Gray-code scanner and printed afterwards,
+ * so the enumeration loop itself never touches stdout.
  * @param arr Input array
  * @param n Size of array
  * @param target Target sum
  * @return Number of solutions found
  */
 int findSubsetsWithSum(int arr[], int n, int target) {
-    int solutionCount = 0;
-    int totalSubsets = 1 << n; // 2^n subsets
+    SubsetMatchBuffer buffer;
+    buffer.capacity = 64;
+    buffer.masks = (uint64_t*)malloc(buffer.capacity * sizeof(uint64_t));
+    buffer.stored = 0;
+    buffer.total = 0;
     
-    printf("All subsets that sum to %d:\n", target);
+    scanSubsetsGray(arr, n, target, 0, 1ULL << n, bufferMatch, &buffer);
     
-    // Generate all possible subsets using bit manipulation
-    for (int mask = 0; mask < totalSubsets; mask++) {
-        int sum = calculateSubsetSum(arr, n, mask);
-        
-        // If subset sum equals target, print it
-        if (sum == target) {
-            printf("Solution %d: ", ++solutionCount);
-            printSubset(arr, n, mask);
-            printf(" (sum = %d)\n", sum);
-        }
+    printf("All subsets that sum to %d:\n", target);
+    for (size_t i = 0; i < buffer.stored; i++) {
+        printf("Solution %zu: ", i + 1);
+        printSubset(arr, n, buffer.masks[i]);
+        printf(" (sum = %d)\n", target);
+    }
+    if ((long long)buffer.stored < buffer.total) {
+        printf("... and %lld more\n", buffer.total - (long long)buffer.stored);
     }
     
-    return solutionCount;
+    free(buffer.masks);
+    return (int)buffer.total;
 }
 
 /**
@@ -83,32 +326,25 @@ int findSubsetsWithSum(int arr[], int n, int target) {
  * @return true if such subset exists, false otherwise
  */
 bool hasSubsetWithSum(int arr[], int n, int target) {
-    int totalSubsets = 1 << n;
-    
-    for (int mask = 0; mask < totalSubsets; mask++) {
-        int sum = calculateSubsetSum(arr, n, mask);
-        if (sum == target) {
-            return true;
-        }
-    }
-    
-    return false;
+    bool found = false;
+    scanSubsetsGray(arr, n, target, 0, 1ULL << n, stopAtFirstMatch, &found);
+    return found;
 }
 
 /**
- * Find the first subset that sums to target
+ * Find the first subset (smallest mask) that sums to target
  * @param arr Input array
  * @param n Size of array
  * @param target Target sum
  * @return Bitmask of first solution, or -1 if no solution
  */
-int findFirstSubsetWithSum(int arr[], int n, int target) {
-    int totalSubsets = 1 << n;
+long long findFirstSubsetWithSum(int arr[], int n, int target) {
+    uint64_t totalSubsets = 1ULL << n;
     
-    for (int mask = 0; mask < totalSubsets; mask++) {
-        int sum = calculateSubsetSum(arr, n, mask);
+    for (uint64_t mask = 0; mask < totalSubsets; mask++) {
+        long long sum = calculateSubsetSum(arr, n, mask);
         if (sum == target) {
-            return mask;
+            return (long long)mask;
         }
     }
     
@@ -163,7 +399,7 @@ int main() {
     printArray(arr3, n3);
     printf("\nTarget sum: %d\n", target3);
     
-    int firstSolution3 = findFirstSubsetWithSum(arr3, n3, target3);
+    long long firstSolution3 = findFirstSubsetWithSum(arr3, n3, target3);
     if (firstSolution3 != -1) {
         printf("First solution: ");
         printSubset(arr3, n3, firstSolution3);
@@ -194,7 +430,7 @@ int main() {
     printArray(arr5, n5);
     printf("\nTarget sum: %d\n", target5);
     
-    int firstSolution5 = findFirstSubsetWithSum(arr5, n5, target5);
+    long long firstSolution5 = findFirstSubsetWithSum(arr5, n5, target5);
     if (firstSolution5 != -1) {
         printf("First solution: ");
         printSubset(arr5, n5, firstSolution5);
@@ -202,6 +438,42 @@ int main() {
     } else {
         printf("No solution found\n");
     }
+    printf("\n");
+    
+    // Test Case 6: Validation run on 28 elements, nothing printed per match
+    int arr6[28];
+    int n6 = 28;
+    for (int i = 0; i < n6; i++) {
+        arr6[i] = 1 + (i * 7919) % 97;
+    }
+    int target6 = 700;
+    printf("Test Case 6: Gray-code scan of 2^%d subsets\n", n6);
+    printf("Array: ");
+    printArray(arr6, n6);
+    printf("\nTarget sum: %d\n", target6);
+    
+    SubsetMatchBuffer buffer6;
+    buffer6.capacity = 4;
+    buffer6.masks = (uint64_t*)malloc(buffer6.capacity * sizeof(uint64_t));
+    
+    int threadCounts[] = {1, 4};
+    for (int c = 0; c < 2; c++) {
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        collectSubsetsWithSum(arr6, n6, target6, threadCounts[c], &buffer6);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double ms = (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6;
+        printf("%d thread(s): %lld matching subsets (Time: %.1f ms)\n",
+               threadCounts[c], buffer6.total, ms);
+    }
+    
+    printf("First stored matches:\n");
+    for (size_t i = 0; i < buffer6.stored; i++) {
+        printf("  ");
+        printSubset(arr6, n6, buffer6.masks[i]);
+        printf(" (sum = %lld)\n", calculateSubsetSum(arr6, n6, buffer6.masks[i]));
+    }
+    free(buffer6.masks);
     
     return 0;
 }
\ No newline at end of file
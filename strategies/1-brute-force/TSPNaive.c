@@ -2,15 +2,24 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
 
 /**
  * Brute Force Strategy: Traveling Salesman Problem (TSP) - Naive Approach
  * Core Idea: Try all possible permutations of cities to find the shortest route
  * Time Complexity: O(n!) where n is the number of cities
  * Space Complexity: O(n) for recursion stack
+ *
+ * The brute force carries the partial route cost and prunes any prefix that
+ * is already no shorter than the best tour; a threaded variant splits the
+ * search on the first two cities. Held-Karp DP solves up to MAX_CITIES
+ * exactly in O(2^n * n^2) time. Compile with -pthread.
  */
 
-#define MAX_CITIES 10
+#define MAX_CITIES 25
 
 /**
  * Calculate the total distance for a given route
@@ -35,21 +44,29 @@ int calculateRouteDistance(int graph[][MAX_CITIES], int route[], int n) {
 
 /**
  * Generate all permutations and find minimum distance
+ * The cost of the partial route is carried down the recursion, and any
+ * prefix that already costs at least *minDistance is abandoned.
  * @param graph Distance matrix
  * @param route Current route being built
  * @param visited Array to track visited cities
  * @param n Number of cities
  * @param level Current level in recursion
+ * @param currentDistance Distance of route[0..level-1]
  * @param minDistance Pointer to minimum distance found so far
  * @param bestRoute Array to store the best route
  */
 void tspBruteForce(int graph[][MAX_CITIES], int route[], int visited[], 
-                   int n, int level, int* minDistance, int bestRoute[]) {
-    // Base case: all cities visited
+                   int n, int level, int currentDistance, int* minDistance, int bestRoute[]) {
+    // Prune: this prefix cannot lead to a shorter tour
+    if (currentDistance >= *minDistance) {
+        return;
+    }
+    
+    // Base case: all cities visited, close the tour
     if (level == n) {
-        int currentDistance = calculateRouteDistance(graph, route, n);
-        if (currentDistance < *minDistance) {
-            *minDistance = currentDistance;
+        int totalDistance = currentDistance + graph[route[n - 1]][route[0]];
+        if (totalDistance < *minDistance) {
+            *minDistance = totalDistance;
             // Copy current route to best route
             for (int i = 0; i < n; i++) {
                 bestRoute[i] = route[i];
@@ -59,13 +76,15 @@ void tspBruteForce(int graph[][MAX_CITIES], int route[], int visited[],
     }
     
     // Try all unvisited cities at current level
+    int last = route[level - 1];
     for (int i = 0; i < n; i++) {
         if (!visited[i]) {
             visited[i] = 1;
             route[level] = i;
             
             // Recurse to next level
-            tspBruteForce(graph, route, visited, n, level + 1, minDistance, bestRoute);
+            tspBruteForce(graph, route, visited, n, level + 1,
+                          currentDistance + graph[last][i], minDistance, bestRoute);
             
             // Backtrack
             visited[i] = 0;
@@ -95,11 +114,294 @@ int solveTSP(int graph[][MAX_CITIES], int n, int bestRoute[]) {
     route[0] = 0;
     
     // Find optimal route
-    tspBruteForce(graph, route, visited, n, 1, &minDistance, bestRoute);
+    tspBruteForce(graph, route, visited, n, 1, 0, &minDistance, bestRoute);
     
     return minDistance;
 }
 
+/* ======================================================================
+ * Parallel brute force
+ * Route prefixes 0 -> a -> b (the first two choices after the fixed start)
+ * become independent tasks handed out through an atomic counter. All
+ * threads prune against one shared best distance.
+ * ====================================================================== */
+
+typedef struct {
+    int (*graph)[MAX_CITIES];
+    int n;
+    int taskCount;
+    atomic_int nextTask;
+    atomic_int bestDistance;
+    pthread_mutex_t lock;
+    int bestRoute[MAX_CITIES];
+} TSPSharedSearch;
+
+static void tspSharedBranch(TSPSharedSearch* search, int route[], int visited[],
+                            int level, int currentDistance) {
+    int n = search->n;
+    int bound = atomic_load_explicit(&search->bestDistance, memory_order_relaxed);
+    if (currentDistance >= bound) return;
+    
+    if (level == n) {
+        int total = currentDistance + search->graph[route[n - 1]][route[0]];
+        if (total < atomic_load_explicit(&search->bestDistance, memory_order_relaxed)) {
+            pthread_mutex_lock(&search->lock);
+            if (total < atomic_load(&search->bestDistance)) {
+                atomic_store(&search->bestDistance, total);
+                memcpy(search->bestRoute, route, n * sizeof(int));
+            }
+            pthread_mutex_unlock(&search->lock);
+        }
+        return;
+    }
+    
+    int last = route[level - 1];
+    for (int i = 1; i < n; i++) {
+        if (!visited[i]) {
+            visited[i] = 1;
+            route[level] = i;
+            tspSharedBranch(search, route, visited, level + 1,
+                            currentDistance + search->graph[last][i]);
+            visited[i] = 0;
+        }
+    }
+}
+
+static void* tspSearchWorker(void* arg) {
+    TSPSharedSearch* search = (TSPSharedSearch*)arg;
+    int n = search->n;
+    int route[MAX_CITIES];
+    int visited[MAX_CITIES];
+    
+    while (1) {
+        int task = atomic_fetch_add(&search->nextTask, 1);
+        if (task >= search->taskCount) break;
+        
+        // Task -> (second city a, third city b) with a != b, both != 0
+        int a = 1 + task / (n - 2);
+        int b = 1 + task % (n - 2);
+        if (b >= a) b++;
+        
+        memset(visited, 0, n * sizeof(int));
+        visited[0] = visited[a] = visited[b] = 1;
+        route[0] = 0;
+        route[1] = a;
+        route[2] = b;
+        tspSharedBranch(search, route, visited, 3, search->graph[0][a] + search->graph[a][b]);
+    }
+    return NULL;
+}
+
+/**
+ * Solve TSP by pruned brute force across numThreads threads
+ * @return Minimum distance for the shortest route
+ */
+int solveTSPParallel(int graph[][MAX_CITIES], int n, int bestRoute[], int numThreads) {
+    if (n <= 3 || numThreads < 1) {
+        return solveTSP(graph, n, bestRoute);
+    }
+    
+    TSPSharedSearch search;
+    search.graph = graph;
+    search.n = n;
+    search.taskCount = (n - 1) * (n - 2);
+    atomic_init(&search.nextTask, 0);
+    atomic_init(&search.bestDistance, INT_MAX);
+    pthread_mutex_init(&search.lock, NULL);
+    
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    for (int t = 0; t < numThreads; t++) {
+        pthread_create(&threads[t], NULL, tspSearchWorker, &search);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&search.lock);
+    
+    memcpy(bestRoute, search.bestRoute, n * sizeof(int));
+    return atomic_load(&search.bestDistance);
+}
+
+/* ======================================================================
+ * Held-Karp dynamic programming: O(2^n * n^2) time
+ * cost(S, j) = shortest path from city 0 through every city of S ending
+ * at j in S. Subsets of cities 1..n-1 are stored layer by layer (by size),
+ * and each subset keeps one slot per member city only, so the table holds
+ * (n-1) * 2^(n-2) entries. Subsets in one layer depend only on the
+ * previous layer, so a layer is split across threads.
+ * ====================================================================== */
+
+typedef struct {
+    int (*graph)[MAX_CITIES];
+    int bits;              // n - 1: cities 1..n-1 map to mask bits 0..n-2
+    uint32_t* masks;       // all subsets, ordered by size
+    uint32_t* layerStart;  // first index in masks of each subset size
+    uint32_t* offset;      // subset -> first slot in cost/parent
+    int* cost;
+    uint8_t* parent;       // previous city (mask bit), 0xFF for "from city 0"
+} HeldKarpTable;
+
+static int popcount32(uint32_t x) {
+    int count = 0;
+    while (x) {
+        x &= x - 1;
+        count++;
+    }
+    return count;
+}
+
+static void heldKarpLayerRange(HeldKarpTable* table, uint32_t begin, uint32_t end) {
+    for (uint32_t index = begin; index < end; index++) {
+        uint32_t mask = table->masks[index];
+        uint32_t slot = table->offset[mask];
+        
+        for (int j = 0; j < table->bits; j++) {
+            if (!(mask & (1u << j))) continue;
+            uint32_t previous = mask ^ (1u << j);
+            
+            int best = INT_MAX;
+            uint8_t from = 0xFF;
+            if (previous == 0) {
+                best = table->graph[0][j + 1];
+            } else {
+                // Slots of the previous subset are read in order
+                uint32_t previousSlot = table->offset[previous];
+                for (int i = 0; i < table->bits; i++) {
+                    if (!(previous & (1u << i))) continue;
+                    int candidate = table->cost[previousSlot++] + table->graph[i + 1][j + 1];
+                    if (candidate < best) {
+                        best = candidate;
+                        from = (uint8_t)i;
+                    }
+                }
+            }
+            table->cost[slot] = best;
+            table->parent[slot] = from;
+            slot++;
+        }
+    }
+}
+
+typedef struct {
+    HeldKarpTable* table;
+    uint32_t begin;
+    uint32_t end;
+} HeldKarpWorker;
+
+static void* heldKarpWorkerRun(void* arg) {
+    HeldKarpWorker* worker = (HeldKarpWorker*)arg;
+    heldKarpLayerRange(worker->table, worker->begin, worker->end);
+    return NULL;
+}
+
+/**
+ * Solve TSP exactly with Held-Karp (n <= MAX_CITIES)
+ * Memory is about 5 bytes per (subset, end city) pair plus 8 bytes per
+ * subset: roughly 1.1 GB at n = 25.
+ * @return Minimum tour length, or -1 if the tables could not be allocated
+ */
+int solveTSPHeldKarp(int graph[][MAX_CITIES], int n, int bestRoute[], int numThreads) {
+    if (n <= 3) {
+        return solveTSP(graph, n, bestRoute);
+    }
+    if (numThreads < 1) numThreads = 1;
+    
+    HeldKarpTable table;
+    table.graph = graph;
+    table.bits = n - 1;
+    uint32_t subsetCount = 1u << table.bits;
+    size_t slotCount = (size_t)table.bits << (table.bits - 1);
+    
+    table.masks = (uint32_t*)malloc(subsetCount * sizeof(uint32_t));
+    table.layerStart = (uint32_t*)calloc(table.bits + 2, sizeof(uint32_t));
+    table.offset = (uint32_t*)malloc(subsetCount * sizeof(uint32_t));
+    table.cost = (int*)malloc(slotCount * sizeof(int));
+    table.parent = (uint8_t*)malloc(slotCount);
+    
+    int result = -1;
+    if (!table.masks || !table.offset || !table.cost || !table.parent) goto cleanup;
+    
+    // Counting sort of subsets by size, then slot offsets in that order
+    for (uint32_t mask = 0; mask < subsetCount; mask++) {
+        table.layerStart[popcount32(mask) + 1]++;
+    }
+    for (int k = 1; k <= table.bits + 1; k++) {
+        table.layerStart[k] += table.layerStart[k - 1];
+    }
+    {
+        uint32_t* fill = (uint32_t*)malloc((table.bits + 1) * sizeof(uint32_t));
+        memcpy(fill, table.layerStart, (table.bits + 1) * sizeof(uint32_t));
+        for (uint32_t mask = 0; mask < subsetCount; mask++) {
+            table.masks[fill[popcount32(mask)]++] = mask;
+        }
+        free(fill);
+    }
+    
+    uint32_t nextSlot = 0;
+    for (uint32_t index = 0; index < subsetCount; index++) {
+        uint32_t mask = table.masks[index];
+        table.offset[mask] = nextSlot;
+        nextSlot += popcount32(mask);
+    }
+    
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    HeldKarpWorker* workers = (HeldKarpWorker*)malloc(numThreads * sizeof(HeldKarpWorker));
+    
+    for (int k = 1; k <= table.bits; k++) {
+        uint32_t begin = table.layerStart[k];
+        uint32_t end = table.layerStart[k + 1];
+        uint32_t size = end - begin;
+        
+        // Small layers are not worth a thread
+        int layerThreads = size < 4096 ? 1 : numThreads;
+        for (int t = 0; t < layerThreads; t++) {
+            workers[t].table = &table;
+            workers[t].begin = begin + (uint32_t)((uint64_t)size * t / layerThreads);
+            workers[t].end = begin + (uint32_t)((uint64_t)size * (t + 1) / layerThreads);
+            if (layerThreads == 1) heldKarpWorkerRun(&workers[t]);
+            else pthread_create(&threads[t], NULL, heldKarpWorkerRun, &workers[t]);
+        }
+        if (layerThreads > 1) {
+            for (int t = 0; t < layerThreads; t++) pthread_join(threads[t], NULL);
+        }
+    }
+    free(threads);
+    free(workers);
+    
+    // Close the tour back to city 0 and walk the parent table
+    uint32_t full = subsetCount - 1;
+    uint32_t slot = table.offset[full];
+    int bestEnd = 0;
+    result = INT_MAX;
+    for (int j = 0; j < table.bits; j++) {
+        int total = table.cost[slot + j] + graph[j + 1][0];
+        if (total < result) {
+            result = total;
+            bestEnd = j;
+        }
+    }
+    
+    bestRoute[0] = 0;
+    uint32_t mask = full;
+    int city = bestEnd;
+    for (int position = n - 1; position >= 1; position--) {
+        bestRoute[position] = city + 1;
+        uint32_t rank = popcount32(mask & ((1u << city) - 1));
+        uint8_t from = table.parent[table.offset[mask] + rank];
+        mask ^= 1u << city;
+        city = from;
+    }
+    
+cleanup:
+    free(table.masks);
+    free(table.layerStart);
+    free(table.offset);
+    free(table.cost);
+    free(table.parent);
+    return result;
+}
+
 /**
  * Helper function to print route
  */
@@ -193,6 +495,61 @@ int main() {
     int minDistance4 = solveTSP(graph4, n4, bestRoute4);
     printf("Minimum distance: %d\n", minDistance4);
     printRoute(bestRoute4, n4);
+    printf("\n");
+    
+    // Test Case 5: Brute force variants and Held-Karp agree
+    int n5 = 12;
+    static int graph5[MAX_CITIES][MAX_CITIES];
+    unsigned int seed = 2024;
+    int x[MAX_CITIES], y[MAX_CITIES];
+    for (int i = 0; i < MAX_CITIES; i++) {
+        seed = seed * 1103515245u + 12345u;
+        x[i] = (seed >> 16) % 1000;
+        seed = seed * 1103515245u + 12345u;
+        y[i] = (seed >> 16) % 1000;
+    }
+    for (int i = 0; i < MAX_CITIES; i++) {
+        for (int j = 0; j < MAX_CITIES; j++) {
+            graph5[i][j] = abs(x[i] - x[j]) + abs(y[i] - y[j]);
+        }
+    }
+    
+    printf("Test Case 5: %d random cities (Manhattan distances)\n", n5);
+    int route5[MAX_CITIES];
+    struct timespec start, end;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int bruteDistance = solveTSP(graph5, n5, route5);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("Pruned brute force:  %d (Time: %.1f ms)\n", bruteDistance,
+           (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6);
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int parallelDistance = solveTSPParallel(graph5, n5, route5, 4);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("Parallel (4 threads): %d (Time: %.1f ms)\n", parallelDistance,
+           (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6);
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int heldKarpDistance = solveTSPHeldKarp(graph5, n5, route5, 4);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("Held-Karp:           %d (Time: %.1f ms)\n", heldKarpDistance,
+           (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6);
+    printRoute(route5, n5);
+    printf("Route check: %d\n\n", calculateRouteDistance(graph5, route5, n5));
+    
+    // Test Case 6: Held-Karp beyond brute-force reach
+    int n6 = 20;
+    printf("Test Case 6: Held-Karp on %d cities\n", n6);
+    int route6[MAX_CITIES];
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int distance6 = solveTSPHeldKarp(graph5, n6, route6, 4);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("Minimum distance: %d (Time: %.1f ms, %zu DP entries)\n", distance6,
+           (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6,
+           (size_t)(n6 - 1) << (n6 - 2));
+    printRoute(route6, n6);
+    printf("Route check: %d\n", calculateRouteDistance(graph5, route6, n6));
     
     return 0;
 }
\ No newline at end of file
@@ -1,22 +1,34 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <limits.h>
+#include <string.h>
 #include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 /**
  * Divide and Conquer Strategy: Maximum Subarray Sum (Kadane's Algorithm using D&C)
  * Core Idea: Divide array into halves and find max sum in left, right, or crossing middle
  * Time Complexity: O(n log n) using divide and conquer, O(n) with Kadane's algorithm
  * Space Complexity: O(log n) for recursion stack
+ *
+ * Also: parallel Kadane over a (total, best prefix, best suffix, best) monoid
+ * with 64-bit sums and an AVX2 inner loop, a 2D maximum-sum rectangle and a
+ * streaming mode that reads the input from a file chunk by chunk.
+ * Compile with: gcc -O2 -mavx2 -pthread MaximumSubarray.c (without -mavx2
+ * the scalar kernel is used)
  */
 
 /**
  * Structure to store subarray information
  */
 typedef struct {
-    int maxSum;
-    int startIndex;
-    int endIndex;
+    long long maxSum;      // 64-bit: long traces overflow an int sum
+    long long startIndex;
+    long long endIndex;
 } SubarrayResult;
 
 /**
@@ -29,8 +41,8 @@ typedef struct {
  */
 SubarrayResult maxCrossingSubarray(int arr[], int low, int mid, int high) {
     // Find max sum for left half ending at mid
-    int leftSum = INT_MIN;
-    int sum = 0;
+    long long leftSum = LLONG_MIN;
+    long long sum = 0;
     int maxLeft = mid;
     
     for (int i = mid; i >= low; i--) {
@@ -42,7 +54,7 @@ SubarrayResult maxCrossingSubarray(int arr[], int low, int mid, int high) {
     }
     
     // Find max sum for right half starting at mid+1
-    int rightSum = INT_MIN;
+    long long rightSum = LLONG_MIN;
     sum = 0;
     int maxRight = mid + 1;
     
@@ -125,8 +137,8 @@ SubarrayResult maxSubarrayKadane(int arr[], int n) {
         return emptyResult;
     }
     
-    int maxSum = arr[0];
-    int currentSum = arr[0];
+    long long maxSum = arr[0];
+    long long currentSum = arr[0];
     int start = 0, end = 0, tempStart = 0;
     
     for (int i = 1; i < n; i++) {
@@ -153,6 +165,425 @@ SubarrayResult maxSubarrayKadane(int arr[], int n) {
     return result;
 }
 
+/**
+ * Summary of a contiguous range, the associative monoid behind parallel Kadane.
+ * Two adjacent ranges combine in O(1), so any split of the input - across
+ * threads, SIMD lanes or file chunks - gives the same answer as one pass.
+ * All indices are absolute positions in the full input.
+ */
+typedef struct {
+    long long length;                  // 0 = empty range (identity element)
+    long long total;                   // sum of the whole range
+    long long prefix, prefixEnd;       // best sum of range[start..prefixEnd]
+    long long suffix, suffixStart;     // best sum of range[suffixStart..end]
+    long long best, bestStart, bestEnd;
+} SubarraySummary;
+
+/**
+ * Combine the summaries of two adjacent ranges (a comes right before b)
+ */
+SubarraySummary combineSummaries(SubarraySummary a, SubarraySummary b) {
+    if (a.length == 0) return b;
+    if (b.length == 0) return a;
+
+    SubarraySummary r;
+    r.length = a.length + b.length;
+    r.total = a.total + b.total;
+
+    // Prefix: stays in a, or covers all of a and a prefix of b
+    r.prefix = a.prefix;
+    r.prefixEnd = a.prefixEnd;
+    if (a.total + b.prefix > r.prefix) {
+        r.prefix = a.total + b.prefix;
+        r.prefixEnd = b.prefixEnd;
+    }
+
+    // Suffix: stays in b, or a suffix of a plus all of b
+    r.suffix = b.suffix;
+    r.suffixStart = b.suffixStart;
+    if (a.suffix + b.total > r.suffix) {
+        r.suffix = a.suffix + b.total;
+        r.suffixStart = a.suffixStart;
+    }
+
+    // Best: inside a, inside b, or crossing the boundary
+    r.best = a.best;
+    r.bestStart = a.bestStart;
+    r.bestEnd = a.bestEnd;
+    if (b.best > r.best) {
+        r.best = b.best;
+        r.bestStart = b.bestStart;
+        r.bestEnd = b.bestEnd;
+    }
+    if (a.suffix + b.prefix > r.best) {
+        r.best = a.suffix + b.prefix;
+        r.bestStart = a.suffixStart;
+        r.bestEnd = b.prefixEnd;
+    }
+    return r;
+}
+
+/**
+ * Running state of one Kadane scan in prefix-sum form. total - minPrefix is
+ * Kadane's running sum (best sum ending here): the smallest earlier prefix
+ * marks where the current run starts, and a new run starts exactly when the
+ * running sum would go negative. minPrefix also gives the best suffix.
+ */
+typedef struct {
+    long long best, bestStart, bestEnd;
+    long long total;
+    long long prefix, prefixEnd;
+    long long minPrefix, minIndex;
+} KadaneLane;
+
+static void initLane(KadaneLane* s) {
+    s->best = LLONG_MIN;
+    s->bestStart = s->bestEnd = -1;
+    s->total = 0;
+    s->prefix = LLONG_MIN;
+    s->prefixEnd = -1;
+    s->minPrefix = LLONG_MAX;          // the first element always becomes the first run
+    s->minIndex = -1;
+}
+
+/**
+ * Feed element x (at absolute position i) into a scan
+ */
+static inline void kadaneStep(KadaneLane* s, long long x, long long i) {
+    if (s->total < s->minPrefix) {     // sum of everything before i
+        s->minPrefix = s->total;
+        s->minIndex = i;
+    }
+    s->total += x;
+    long long cur = s->total - s->minPrefix;
+    if (cur > s->best) {
+        s->best = cur;
+        s->bestStart = s->minIndex;
+        s->bestEnd = i;
+    }
+    if (s->total > s->prefix) {
+        s->prefix = s->total;
+        s->prefixEnd = i;
+    }
+}
+
+static SubarraySummary laneSummary(const KadaneLane* s, long long length) {
+    SubarraySummary r = { 0 };
+    if (length == 0) return r;
+    r.length = length;
+    r.total = s->total;
+    r.prefix = s->prefix;
+    r.prefixEnd = s->prefixEnd;
+    r.suffix = s->total - s->minPrefix;
+    r.suffixStart = s->minIndex;
+    r.best = s->best;
+    r.bestStart = s->bestStart;
+    r.bestEnd = s->bestEnd;
+    return r;
+}
+
+#if defined(__AVX2__)
+/**
+ * Four Kadane scans side by side, one per 64-bit lane
+ */
+typedef struct {
+    __m256i best, bestStart, bestEnd;
+    __m256i total, prefix, prefixEnd, minPrefix, minIndex;
+} KadaneLanes4;
+
+static inline __m256i select64(__m256i mask, __m256i ifTrue, __m256i ifFalse) {
+    // blendv_pd reads only each lane's sign bit, which is all a 64-bit compare mask needs
+    return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(ifFalse),
+                                                _mm256_castsi256_pd(ifTrue),
+                                                _mm256_castsi256_pd(mask)));
+}
+
+// Branch-free kadaneStep for four independent scans
+static inline void kadaneStep4(KadaneLanes4* s, __m256i x, __m256i i) {
+    __m256i lower = _mm256_cmpgt_epi64(s->minPrefix, s->total);
+    s->minPrefix = select64(lower, s->total, s->minPrefix);
+    s->minIndex = select64(lower, i, s->minIndex);
+
+    s->total = _mm256_add_epi64(s->total, x);
+    __m256i cur = _mm256_sub_epi64(s->total, s->minPrefix);
+    __m256i better = _mm256_cmpgt_epi64(cur, s->best);
+    s->best = select64(better, cur, s->best);
+    s->bestStart = select64(better, s->minIndex, s->bestStart);
+    s->bestEnd = select64(better, i, s->bestEnd);
+
+    __m256i higher = _mm256_cmpgt_epi64(s->total, s->prefix);
+    s->prefix = select64(higher, s->total, s->prefix);
+    s->prefixEnd = select64(higher, i, s->prefixEnd);
+}
+
+static void extractLane(const KadaneLanes4* v, int lane, KadaneLane* s) {
+    long long tmp[4];
+#define EXTRACT(field) (_mm256_storeu_si256((__m256i*)tmp, v->field), s->field = tmp[lane])
+    EXTRACT(best); EXTRACT(bestStart); EXTRACT(bestEnd); EXTRACT(total);
+    EXTRACT(prefix); EXTRACT(prefixEnd); EXTRACT(minPrefix); EXTRACT(minIndex);
+#undef EXTRACT
+}
+#endif
+
+/**
+ * Summarize arr[0..n) (exactly one of ints/longs is non-NULL); offset is the
+ * absolute index of element 0. With AVX2 the range is cut into four quarters
+ * scanned in lockstep: every 4 steps load 4 values from each quarter and
+ * transpose, so each vector holds one element of each quarter.
+ */
+SubarraySummary summarizeRange(const int* ints, const long long* longs, size_t n, long long offset) {
+    SubarraySummary result = { 0 };
+    size_t done = 0;
+    KadaneLane tail;
+    initLane(&tail);
+
+#if defined(__AVX2__)
+    size_t quarter = (n / 4) & ~(size_t)3;       // multiple of 4 for the transposes
+    if (quarter >= 64) {
+        KadaneLanes4 v;
+        v.best = v.prefix = _mm256_set1_epi64x(LLONG_MIN);
+        v.bestStart = v.bestEnd = v.prefixEnd = v.minIndex = _mm256_set1_epi64x(-1);
+        v.total = _mm256_setzero_si256();
+        v.minPrefix = _mm256_set1_epi64x(LLONG_MAX);
+
+        long long q = (long long)quarter;
+        __m256i index = _mm256_setr_epi64x(offset, offset + q, offset + 2 * q, offset + 3 * q);
+        const __m256i one = _mm256_set1_epi64x(1);
+        __m256i rows[4];
+
+        for (size_t i = 0; i < quarter; i += 4) {
+            if (ints) {
+                __m128 r0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(ints + i)));
+                __m128 r1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(ints + quarter + i)));
+                __m128 r2 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(ints + 2 * quarter + i)));
+                __m128 r3 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(ints + 3 * quarter + i)));
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                rows[0] = _mm256_cvtepi32_epi64(_mm_castps_si128(r0));
+                rows[1] = _mm256_cvtepi32_epi64(_mm_castps_si128(r1));
+                rows[2] = _mm256_cvtepi32_epi64(_mm_castps_si128(r2));
+                rows[3] = _mm256_cvtepi32_epi64(_mm_castps_si128(r3));
+            } else {
+                __m256i r0 = _mm256_loadu_si256((const __m256i*)(longs + i));
+                __m256i r1 = _mm256_loadu_si256((const __m256i*)(longs + quarter + i));
+                __m256i r2 = _mm256_loadu_si256((const __m256i*)(longs + 2 * quarter + i));
+                __m256i r3 = _mm256_loadu_si256((const __m256i*)(longs + 3 * quarter + i));
+                __m256i t0 = _mm256_unpacklo_epi64(r0, r1), t1 = _mm256_unpackhi_epi64(r0, r1);
+                __m256i t2 = _mm256_unpacklo_epi64(r2, r3), t3 = _mm256_unpackhi_epi64(r2, r3);
+                rows[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+                rows[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+                rows[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+                rows[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+            }
+            kadaneStep4(&v, rows[0], index);
+            index = _mm256_add_epi64(index, one);
+            kadaneStep4(&v, rows[1], index);
+            index = _mm256_add_epi64(index, one);
+            kadaneStep4(&v, rows[2], index);
+            index = _mm256_add_epi64(index, one);
+            kadaneStep4(&v, rows[3], index);
+            index = _mm256_add_epi64(index, one);
+        }
+
+        // Quarters 0..2 are finished; quarter 3 keeps scanning the leftover tail
+        for (int lane = 0; lane < 3; lane++) {
+            KadaneLane s;
+            extractLane(&v, lane, &s);
+            result = combineSummaries(result, laneSummary(&s, q));
+        }
+        extractLane(&v, 3, &tail);
+        done = 4 * quarter;
+    }
+#endif
+
+    for (size_t i = done; i < n; i++) {
+        kadaneStep(&tail, ints ? ints[i] : longs[i], offset + (long long)i);
+    }
+    long long tailLength = (long long)(n - done) + (done ? (long long)(done / 4) : 0);
+    return combineSummaries(result, laneSummary(&tail, tailLength));
+}
+
+static SubarrayResult summaryToResult(SubarraySummary s) {
+    SubarrayResult result = { 0, -1, -1 };
+    if (s.length == 0) return result;
+    result.maxSum = s.best;
+    result.startIndex = s.bestStart;
+    result.endIndex = s.bestEnd;
+    return result;
+}
+
+/**
+ * Thread work for the parallel reduction
+ */
+typedef struct {
+    const int* arr;
+    size_t n;
+    long long offset;
+    SubarraySummary summary;
+} SummaryTask;
+
+static void* summaryWorker(void* arg) {
+    SummaryTask* task = (SummaryTask*)arg;
+    task->summary = summarizeRange(task->arr, NULL, task->n, task->offset);
+    return NULL;
+}
+
+/**
+ * Summarize arr[0..n) with numThreads threads: each summarizes one slice,
+ * then the slice summaries are combined left to right
+ */
+SubarraySummary summarizeParallel(const int* arr, size_t n, long long offset, int numThreads) {
+    if (numThreads < 1) numThreads = 1;
+    if ((size_t)numThreads > n / 4096 + 1) numThreads = (int)(n / 4096 + 1);   // tiny inputs: not worth a thread
+    if (numThreads == 1) return summarizeRange(arr, NULL, n, offset);
+
+    pthread_t* threads = malloc(numThreads * sizeof(pthread_t));
+    SummaryTask* tasks = malloc(numThreads * sizeof(SummaryTask));
+    size_t slice = n / numThreads;
+    for (int t = 0; t < numThreads; t++) {
+        size_t begin = t * slice;
+        tasks[t].arr = arr + begin;
+        tasks[t].n = (t == numThreads - 1) ? n - begin : slice;
+        tasks[t].offset = offset + (long long)begin;
+        pthread_create(&threads[t], NULL, summaryWorker, &tasks[t]);
+    }
+    SubarraySummary result = { 0 };
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+        result = combineSummaries(result, tasks[t].summary);
+    }
+    free(threads);
+    free(tasks);
+    return result;
+}
+
+/**
+ * Maximum subarray with parallel Kadane (64-bit sums, SIMD inner loop)
+ * Time Complexity: O(n / threads + threads)
+ */
+SubarrayResult maxSubarrayParallel(const int* arr, size_t n, int numThreads) {
+    if (arr == NULL || n == 0) {
+        SubarrayResult emptyResult = {0, -1, -1};
+        return emptyResult;
+    }
+    return summaryToResult(summarizeParallel(arr, n, 0, numThreads));
+}
+
+/**
+ * Streaming maximum subarray over a file of raw native-endian 32-bit ints.
+ * Only one chunk is in memory at a time; each chunk is summarized in
+ * parallel and folded into the running summary, so the result and indices
+ * match maxSubarrayParallel on the whole file.
+ */
+SubarrayResult maxSubarrayStream(FILE* file, size_t chunkElements, int numThreads) {
+    SubarrayResult emptyResult = {0, -1, -1};
+    if (file == NULL || chunkElements == 0) return emptyResult;
+
+    int* chunk = malloc(chunkElements * sizeof(int));
+    if (!chunk) {
+        printf("Memory allocation failed\n");
+        return emptyResult;
+    }
+    SubarraySummary running = { 0 };
+    long long offset = 0;
+    size_t got;
+    while ((got = fread(chunk, sizeof(int), chunkElements, file)) > 0) {
+        running = combineSummaries(running, summarizeParallel(chunk, got, offset, numThreads));
+        offset += (long long)got;
+    }
+    free(chunk);
+    return summaryToResult(running);
+}
+
+/**
+ * Structure to store a maximum-sum rectangle (inclusive bounds)
+ */
+typedef struct {
+    long long maxSum;
+    long long top, left, bottom, right;
+} SubmatrixResult;
+
+typedef struct {
+    const int* matrix;          // rows x cols, row-major, rows <= cols
+    size_t rows, cols;
+    int firstTop, stride;       // this thread handles tops firstTop, firstTop + stride, ...
+    SubmatrixResult best;
+} SubmatrixTask;
+
+static void* submatrixWorker(void* arg) {
+    SubmatrixTask* task = (SubmatrixTask*)arg;
+    long long* columnSums = malloc(task->cols * sizeof(long long));
+    task->best.maxSum = LLONG_MIN;
+
+    for (size_t top = task->firstTop; top < task->rows; top += task->stride) {
+        memset(columnSums, 0, task->cols * sizeof(long long));
+        for (size_t bottom = top; bottom < task->rows; bottom++) {
+            // columnSums[c] = sum of matrix[top..bottom][c]; best rectangle with
+            // these rows is then the 1D maximum subarray of columnSums
+            const int* row = task->matrix + bottom * task->cols;
+            for (size_t c = 0; c < task->cols; c++) columnSums[c] += row[c];
+
+            SubarraySummary s = summarizeRange(NULL, columnSums, task->cols, 0);
+            if (s.best > task->best.maxSum) {
+                task->best.maxSum = s.best;
+                task->best.top = (long long)top;
+                task->best.bottom = (long long)bottom;
+                task->best.left = s.bestStart;
+                task->best.right = s.bestEnd;
+            }
+        }
+    }
+    free(columnSums);
+    return NULL;
+}
+
+/**
+ * Maximum-sum rectangle of a rows x cols row-major matrix, built on the 1D
+ * kernel: fix the top and bottom rows, collapse the band into column sums,
+ * run Kadane across them. The shorter side is used for the row pair, so the
+ * cost is O(min^2 * max). Top rows are dealt round-robin to threads, which
+ * balances the shrinking amount of work per top.
+ */
+SubmatrixResult maxSubmatrix(const int* matrix, size_t rows, size_t cols, int numThreads) {
+    SubmatrixResult result = { 0, -1, -1, -1, -1 };
+    if (matrix == NULL || rows == 0 || cols == 0) return result;
+
+    int* transposed = NULL;
+    int swapped = rows > cols;
+    if (swapped) {
+        transposed = malloc(rows * cols * sizeof(int));
+        for (size_t r = 0; r < rows; r++)
+            for (size_t c = 0; c < cols; c++) transposed[c * rows + r] = matrix[r * cols + c];
+        matrix = transposed;
+        size_t t = rows; rows = cols; cols = t;
+    }
+
+    if (numThreads < 1) numThreads = 1;
+    if ((size_t)numThreads > rows) numThreads = (int)rows;
+    pthread_t* threads = malloc(numThreads * sizeof(pthread_t));
+    SubmatrixTask* tasks = malloc(numThreads * sizeof(SubmatrixTask));
+    for (int t = 0; t < numThreads; t++) {
+        tasks[t] = (SubmatrixTask){ matrix, rows, cols, t, numThreads, { 0, -1, -1, -1, -1 } };
+        pthread_create(&threads[t], NULL, submatrixWorker, &tasks[t]);
+    }
+    result.maxSum = LLONG_MIN;
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+        SubmatrixResult b = tasks[t].best;
+        if (b.maxSum > result.maxSum ||
+            (b.maxSum == result.maxSum && b.top < result.top)) result = b;   // deterministic on ties
+    }
+    free(threads);
+    free(tasks);
+    free(transposed);
+
+    if (swapped) {
+        long long t;
+        t = result.top; result.top = result.left; result.left = t;
+        t = result.bottom; result.bottom = result.right; result.right = t;
+    }
+    return result;
+}
+
 /**
  * Helper function to print array
  */
@@ -168,14 +599,14 @@ void printArray(int arr[], int n) {
 /**
  * Helper function to print subarray
  */
-void printSubarray(int arr[], int start, int end) {
+void printSubarray(int arr[], long long start, long long end) {
     if (start == -1 || end == -1) {
         printf("[]");
         return;
     }
     
     printf("[");
-    for (int i = start; i <= end; i++) {
+    for (long long i = start; i <= end; i++) {
         printf("%d", arr[i]);
         if (i < end) printf(", ");
     }
@@ -186,10 +617,10 @@ void printSubarray(int arr[], int start, int end) {
  * Helper function to print result
  */
 void printResult(SubarrayResult result) {
-    printf("Sum: %d, Indices: [%d, %d]", result.maxSum, result.startIndex, result.endIndex);
+    printf("Sum: %lld, Indices: [%lld, %lld]", result.maxSum, result.startIndex, result.endIndex);
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     printf("=== Maximum Subarray Sum - Divide and Conquer ===\n");
     
     // Test Case 1: Mixed positive and negative numbers
@@ -295,6 +726,119 @@ int main() {
     printf("\nTime: %ld microseconds\n", (end2 - start2) * 1000000 / CLOCKS_PER_SEC);
     
     printf("Results match: %s\n", (resultDC.maxSum == resultK.maxSum) ? "Yes" : "No");
+
+    int numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (numThreads < 1) numThreads = 1;
+
+    // Test Case 6: Parallel Kadane must agree with the sequential scan on every split
+    printf("\nTest Case 6: Parallel Kadane vs sequential\n");
+    srand(42);
+    int splitsAgree = 1;
+    for (int trial = 0; trial < 200; trial++) {
+        int n = 1 + rand() % 3000;
+        int* arr = malloc(n * sizeof(int));
+        for (int i = 0; i < n; i++) arr[i] = rand() % 201 - 100 - (trial % 3 == 0 ? 50 : 0);
+        SubarrayResult expected = maxSubarrayKadane(arr, n);
+        for (int threads = 1; threads <= 8; threads *= 2) {
+            SubarraySummary s = { 0 };
+            size_t slice = n / threads + 1;   // fold slices by hand so small inputs split too
+            for (size_t begin = 0; begin < (size_t)n; begin += slice) {
+                size_t len = begin + slice <= (size_t)n ? slice : n - begin;
+                s = combineSummaries(s, summarizeRange(arr + begin, NULL, len, (long long)begin));
+            }
+            long long check = 0;
+            for (long long i = s.bestStart; i <= s.bestEnd; i++) check += arr[i];
+            if (s.best != expected.maxSum || check != s.best) splitsAgree = 0;
+        }
+        free(arr);
+    }
+    printf("200 random arrays, 1-8 splits: %s\n", splitsAgree ? "all match" : "MISMATCH");
+
+    // Test Case 7: 2D maximum-sum rectangle vs brute force
+    printf("\nTest Case 7: Maximum-sum rectangle\n");
+    int grid[] = {
+         1,  2, -1, -4, -20,
+        -8, -3,  4,  2,   1,
+         3,  8, 10,  1,   3,
+        -4, -1,  1,  7,  -6
+    };
+    SubmatrixResult rect = maxSubmatrix(grid, 4, 5, numThreads);
+    printf("4x5 grid: Sum: %lld, Rows: [%lld, %lld], Columns: [%lld, %lld]\n",
+           rect.maxSum, rect.top, rect.bottom, rect.left, rect.right);
+
+    int rectsAgree = 1;
+    for (int trial = 0; trial < 20; trial++) {
+        size_t rows = 1 + rand() % 30, cols = 1 + rand() % 30;
+        int* m = malloc(rows * cols * sizeof(int));
+        for (size_t i = 0; i < rows * cols; i++) m[i] = rand() % 41 - 22;
+        long long best = LLONG_MIN;
+        for (size_t r1 = 0; r1 < rows; r1++)
+            for (size_t r2 = r1; r2 < rows; r2++)
+                for (size_t c1 = 0; c1 < cols; c1++)
+                    for (size_t c2 = c1; c2 < cols; c2++) {
+                        long long sum = 0;
+                        for (size_t r = r1; r <= r2; r++)
+                            for (size_t c = c1; c <= c2; c++) sum += m[r * cols + c];
+                        if (sum > best) best = sum;
+                    }
+        SubmatrixResult got = maxSubmatrix(m, rows, cols, numThreads);
+        long long check = 0;
+        for (long long r = got.top; r <= got.bottom; r++)
+            for (long long c = got.left; c <= got.right; c++) check += m[r * cols + c];
+        if (got.maxSum != best || check != best) rectsAgree = 0;
+        free(m);
+    }
+    printf("20 random matrices vs brute force: %s\n", rectsAgree ? "all match" : "MISMATCH");
+
+    // Test Case 8: Large trace - 64-bit sums, SIMD + threads, streaming from a file
+    size_t bigN = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000000;
+    printf("\nTest Case 8: %zu samples, %d thread(s)\n", bigN, numThreads);
+    int* trace = malloc(bigN * sizeof(int));
+    if (!trace) {
+        printf("Memory allocation failed\n");
+        return 1;
+    }
+    unsigned int seed = 7;
+    for (size_t i = 0; i < bigN; i++) {
+        seed = seed * 1103515245u + 12345u;
+        trace[i] = (int)((seed >> 8) % 1100) - 600 + 600 * (i > bigN / 4 && i < bigN / 2);  // drifts positive mid-trace
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    SubarrayResult seq = maxSubarrayKadane(trace, (int)bigN);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double seqSeconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    SubarrayResult par = maxSubarrayParallel(trace, bigN, numThreads);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double parSeconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    printf("Sequential Kadane: ");
+    printResult(seq);
+    printf("\n  %.3f s (%.2f ns/sample)\n", seqSeconds, seqSeconds * 1e9 / bigN);
+    printf("Parallel Kadane:   ");
+    printResult(par);
+    printf("\n  %.3f s (%.2f ns/sample)\n", parSeconds, parSeconds * 1e9 / bigN);
+    printf("Sum exceeds int range: %s\n", seq.maxSum > INT_MAX ? "Yes" : "No");
+
+    FILE* file = tmpfile();
+    if (file) {
+        fwrite(trace, sizeof(int), bigN, file);
+        rewind(file);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        SubarrayResult streamed = maxSubarrayStream(file, 1 << 22, numThreads);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        fclose(file);
+        printf("Streamed (4M-sample chunks): ");
+        printResult(streamed);
+        printf("\n  %.3f s\n", (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9);
+        printf("All results match: %s\n",
+               (seq.maxSum == par.maxSum && par.maxSum == streamed.maxSum &&
+                par.startIndex == streamed.startIndex && par.endIndex == streamed.endIndex) ? "Yes" : "No");
+    }
+    free(trace);
     
     return 0;
 }
\ No newline at end of file
@@ -1,11 +1,19 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
 
 /**
  * Greedy Strategy: Activity Selection Problem
  * Core Idea: Always choose the activity that finishes earliest (and doesn't conflict)
  * Time Complexity: O(n log n) due to sorting by finish time
  * Space Complexity: O(1) excluding input
+ *
+ * Also: a structure-of-arrays engine with radix sort, weighted interval
+ * scheduling (DP + binary search), k-room interval partitioning with a
+ * min-heap, and an O(1)-state streaming mode.
  */
 
 /**
@@ -24,7 +32,8 @@ typedef struct {
 int compareByFinishTime(const void* a, const void* b) {
     Activity* actA = (Activity*)a;
     Activity* actB = (Activity*)b;
-    return actA->finish - actB->finish;
+    // Compare instead of subtracting: finish - finish overflows for far-apart times
+    return (actA->finish > actB->finish) - (actA->finish < actB->finish);
 }
 
 /**
@@ -254,7 +263,442 @@ void compareStrategies(Activity activities[], int n) {
     free(shortestSelected);
 }
 
-int main() {
+/**
+ * Activities in structure-of-arrays layout. Sorting and the scans below only
+ * touch the columns they need, instead of moving whole structs (names
+ * included) through every swap.
+ */
+typedef struct {
+    int* start;
+    int* finish;
+    int* weight;
+    uint32_t* id;      // original position of each row
+    size_t n;
+} ActivityTable;
+
+ActivityTable* createActivityTable(size_t n) {
+    ActivityTable* table = (ActivityTable*)malloc(sizeof(ActivityTable));
+    if (!table) return NULL;
+    table->n = n;
+    table->start = (int*)malloc(n * sizeof(int));
+    table->finish = (int*)malloc(n * sizeof(int));
+    table->weight = (int*)malloc(n * sizeof(int));
+    table->id = (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (!table->start || !table->finish || !table->weight || !table->id) {
+        printf("Memory allocation failed\n");
+        free(table->start);
+        free(table->finish);
+        free(table->weight);
+        free(table->id);
+        free(table);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) table->id[i] = (uint32_t)i;
+    return table;
+}
+
+void freeActivityTable(ActivityTable* table) {
+    if (!table) return;
+    free(table->start);
+    free(table->finish);
+    free(table->weight);
+    free(table->id);
+    free(table);
+}
+
+// Gather column[order[i]] into column[i], using scratch space of n words
+static void permuteColumn(uint32_t* column, const uint64_t* order, size_t n, uint32_t* scratch) {
+    for (size_t i = 0; i < n; i++) scratch[i] = column[(uint32_t)order[i]];
+    memcpy(column, scratch, n * sizeof(uint32_t));
+}
+
+/**
+ * Stable LSD radix sort of all rows by one key column (start or finish).
+ * Each row becomes a (key, row) pair sorted 11 bits per pass (3 passes for
+ * 32-bit keys); a pass is skipped when every key has the same digit there.
+ * The key column is written back from the sorted pairs, the other columns
+ * are gathered into the new order.
+ * Time Complexity: O(n) per pass
+ * @return 1 on success, 0 if scratch memory could not be allocated
+ */
+#define RADIX_BITS 11
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+
+int radixSortActivities(ActivityTable* table, int* keyColumn) {
+    size_t n = table->n;
+    uint64_t* pairs = (uint64_t*)malloc(n * sizeof(uint64_t));
+    uint64_t* buffer = (uint64_t*)malloc(n * sizeof(uint64_t));
+    size_t (*counts)[RADIX_BUCKETS] = calloc(3, sizeof(*counts));
+    if (!pairs || !buffer || !counts) {
+        printf("Memory allocation failed\n");
+        free(pairs);
+        free(buffer);
+        free(counts);
+        return 0;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t key = (uint32_t)keyColumn[i] ^ 0x80000000u;   // signed order as unsigned
+        pairs[i] = ((uint64_t)key << 32) | i;
+        counts[0][key & (RADIX_BUCKETS - 1)]++;
+        counts[1][(key >> RADIX_BITS) & (RADIX_BUCKETS - 1)]++;
+        counts[2][key >> (2 * RADIX_BITS)]++;
+    }
+
+    for (int pass = 0; pass < 3; pass++) {
+        int shift = 32 + RADIX_BITS * pass;
+        if (n == 0 || counts[pass][(pairs[0] >> shift) & (RADIX_BUCKETS - 1)] == n) continue;   // digit constant
+
+        size_t sum = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {    // counts become start offsets
+            size_t c = counts[pass][b];
+            counts[pass][b] = sum;
+            sum += c;
+        }
+        for (size_t i = 0; i < n; i++) buffer[counts[pass][(pairs[i] >> shift) & (RADIX_BUCKETS - 1)]++] = pairs[i];
+        uint64_t* t = pairs; pairs = buffer; buffer = t;
+    }
+
+    uint32_t* scratch = (uint32_t*)buffer;
+    int* columns[3] = { table->start, table->finish, table->weight };
+    for (int c = 0; c < 3; c++) {
+        if (columns[c] != keyColumn) permuteColumn((uint32_t*)columns[c], pairs, n, scratch);
+    }
+    permuteColumn(table->id, pairs, n, scratch);
+    for (size_t i = 0; i < n; i++) keyColumn[i] = (int)((uint32_t)(pairs[i] >> 32) ^ 0x80000000u);
+    free(pairs);
+    free(buffer);
+    free(counts);
+    return 1;
+}
+
+/**
+ * Unweighted selection on a table already sorted by finish time
+ * @param selected Optional per-row output (1 = chosen)
+ * @return Number of selected activities
+ */
+size_t selectActivitiesSorted(const ActivityTable* table, unsigned char* selected) {
+    size_t count = 0;
+    int lastFinish = INT_MIN;
+    for (size_t i = 0; i < table->n; i++) {
+        int take = table->start[i] >= lastFinish;
+        if (take) {
+            lastFinish = table->finish[i];
+            count++;
+        }
+        if (selected) selected[i] = (unsigned char)take;
+    }
+    return count;
+}
+
+/**
+ * Number of rows among finish[0..n) with finish <= time (upper bound).
+ * Branch-free: the loop length depends only on n and the compare becomes a
+ * conditional move, so there are no mispredictions on random queries.
+ */
+static size_t countFinishedBy(const int* finish, size_t n, int time) {
+    if (n == 0) return 0;
+    const int* base = finish;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (base[half] <= time) ? base + half : base;
+        n -= half;
+    }
+    return (size_t)(base - finish) + (*base <= time);
+}
+
+/**
+ * Weighted interval scheduling on a table sorted by finish time.
+ * best[j] = max(best[j-1], weight[j-1] + best[p]), where p counts the rows
+ * that finish by the time row j-1 starts (binary search on finish times).
+ * Time Complexity: O(n log n), Space Complexity: O(n)
+ * @param selected Optional per-row output of the chosen set
+ * @return Maximum total weight, or -1 if memory could not be allocated
+ */
+long long weightedActivitySelection(const ActivityTable* table, unsigned char* selected) {
+    size_t n = table->n;
+    long long* best = (long long*)malloc((n + 1) * sizeof(long long));
+    if (!best) {
+        printf("Memory allocation failed\n");
+        return -1;
+    }
+    best[0] = 0;
+    for (size_t j = 1; j <= n; j++) {
+        size_t p = countFinishedBy(table->finish, j - 1, table->start[j - 1]);
+        long long take = table->weight[j - 1] + best[p];
+        best[j] = take > best[j - 1] ? take : best[j - 1];
+    }
+    long long total = best[n];
+
+    if (selected) {
+        memset(selected, 0, n);
+        size_t j = n;
+        while (j > 0) {                   // walk back through the decisions
+            size_t p = countFinishedBy(table->finish, j - 1, table->start[j - 1]);
+            if (table->weight[j - 1] + best[p] > best[j - 1]) {
+                selected[j - 1] = 1;
+                j = p;
+            } else {
+                j--;
+            }
+        }
+    }
+    free(best);
+    return total;
+}
+
+/**
+ * k-resource mode (interval partitioning) on a table sorted by start time.
+ * Each activity takes the room that frees up first - the top of a min-heap
+ * of room end times - or opens a new room when every room is still busy.
+ * With maxRooms == 0 rooms are unlimited and the result is the minimum
+ * number of rooms. With maxRooms > 0, an activity that finds all rooms busy
+ * is turned away (roomOf = -1), like a booking desk with fixed rooms.
+ * Time Complexity: O(n log k)
+ * @return Number of rooms used, or -1 if memory could not be allocated
+ */
+int intervalPartitioning(const ActivityTable* table, int maxRooms, int* roomOf, size_t* rejected) {
+    size_t capacity = 64, rooms = 0, turnedAway = 0;
+    int* heapEnd = (int*)malloc(capacity * sizeof(int));
+    int* heapRoom = (int*)malloc(capacity * sizeof(int));
+    if (!heapEnd || !heapRoom) {
+        printf("Memory allocation failed\n");
+        free(heapEnd);
+        free(heapRoom);
+        return -1;
+    }
+
+    for (size_t i = 0; i < table->n; i++) {
+        int start = table->start[i], finish = table->finish[i];
+        int room;
+        if (rooms > 0 && heapEnd[0] <= start) {
+            room = heapRoom[0];           // reuse the earliest-free room: its end moves later, sift down
+            size_t pos = 0;
+            for (;;) {
+                size_t child = 2 * pos + 1;
+                if (child >= rooms) break;
+                if (child + 1 < rooms && heapEnd[child + 1] < heapEnd[child]) child++;
+                if (heapEnd[child] >= finish) break;
+                heapEnd[pos] = heapEnd[child];
+                heapRoom[pos] = heapRoom[child];
+                pos = child;
+            }
+            heapEnd[pos] = finish;
+            heapRoom[pos] = room;
+        } else if (maxRooms == 0 || rooms < (size_t)maxRooms) {
+            if (rooms == capacity) {
+                capacity *= 2;
+                heapEnd = (int*)realloc(heapEnd, capacity * sizeof(int));
+                heapRoom = (int*)realloc(heapRoom, capacity * sizeof(int));
+            }
+            room = (int)rooms;            // open a new room, sift up
+            size_t pos = rooms++;
+            while (pos > 0 && heapEnd[(pos - 1) / 2] > finish) {
+                heapEnd[pos] = heapEnd[(pos - 1) / 2];
+                heapRoom[pos] = heapRoom[(pos - 1) / 2];
+                pos = (pos - 1) / 2;
+            }
+            heapEnd[pos] = finish;
+            heapRoom[pos] = room;
+        } else {
+            room = -1;
+            turnedAway++;
+        }
+        if (roomOf) roomOf[i] = room;
+    }
+
+    free(heapEnd);
+    free(heapRoom);
+    if (rejected) *rejected = turnedAway;
+    return (int)rooms;
+}
+
+/**
+ * Online mode: activities arrive already ordered by finish time and are
+ * accepted or skipped on the spot, keeping only O(1) state
+ */
+typedef struct {
+    int lastFinish;       // finish of the last accepted activity
+    int lastOffered;      // finish of the last offered one, to check the order
+    long long accepted;
+} ActivityStream;
+
+void initActivityStream(ActivityStream* stream) {
+    stream->lastFinish = INT_MIN;
+    stream->lastOffered = INT_MIN;
+    stream->accepted = 0;
+}
+
+/**
+ * @return 1 if accepted, 0 if it conflicts, -1 if it arrived out of finish order
+ */
+int offerActivity(ActivityStream* stream, int start, int finish) {
+    if (finish < stream->lastOffered) return -1;
+    stream->lastOffered = finish;
+    if (start < stream->lastFinish) return 0;
+    stream->lastFinish = finish;
+    stream->accepted++;
+    return 1;
+}
+
+static double secondsSince(struct timespec* t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (t1.tv_sec - t0->tv_sec) + (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+static uint64_t benchState = 88172645463325252ull;
+
+static uint32_t benchRandom(void) {
+    benchState ^= benchState << 13;
+    benchState ^= benchState >> 7;
+    benchState ^= benchState << 17;
+    return (uint32_t)(benchState >> 32);
+}
+
+// Random intervals: start in [0, horizon), duration in [1, 10000], weight in [1, 1000]
+static void fillRandomActivities(ActivityTable* table, int horizon) {
+    for (size_t i = 0; i < table->n; i++) {
+        table->start[i] = (int)(benchRandom() % (uint32_t)horizon);
+        table->finish[i] = table->start[i] + 1 + (int)(benchRandom() % 10000);
+        table->weight[i] = 1 + (int)(benchRandom() % 1000);
+        table->id[i] = (uint32_t)i;
+    }
+}
+
+/**
+ * Check the new modes against brute force on small random inputs
+ */
+void verifySchedulingModes(void) {
+    int weightedOk = 1, roomsOk = 1;
+    for (int trial = 0; trial < 300; trial++) {
+        size_t n = 1 + benchRandom() % 12;
+        ActivityTable* table = createActivityTable(n);
+        for (size_t i = 0; i < n; i++) {
+            table->start[i] = (int)(benchRandom() % 30) - 10;   // negative times too
+            table->finish[i] = table->start[i] + 1 + (int)(benchRandom() % 8);
+            table->weight[i] = 1 + (int)(benchRandom() % 20);
+        }
+
+        // Brute force: heaviest compatible subset over all 2^n subsets
+        long long bruteBest = 0;
+        for (uint32_t mask = 0; mask < (1u << n); mask++) {
+            long long w = 0;
+            int ok = 1;
+            for (size_t a = 0; a < n && ok; a++) {
+                if (!(mask >> a & 1)) continue;
+                w += table->weight[a];
+                for (size_t b = a + 1; b < n; b++)
+                    if ((mask >> b & 1) && table->start[a] < table->finish[b] && table->start[b] < table->finish[a]) ok = 0;
+            }
+            if (ok && w > bruteBest) bruteBest = w;
+        }
+        // Brute force: rooms needed = most activities overlapping at one instant
+        int depth = 0;
+        for (int t = -10; t < 40; t++) {
+            int here = 0;
+            for (size_t i = 0; i < n; i++) here += table->start[i] <= t && t < table->finish[i];
+            if (here > depth) depth = here;
+        }
+
+        unsigned char chosen[12];
+        radixSortActivities(table, table->finish);
+        long long dp = weightedActivitySelection(table, chosen);
+        long long chosenWeight = 0;
+        int lastFinish = INT_MIN;
+        for (size_t i = 0; i < n; i++) {
+            if (!chosen[i]) continue;
+            if (table->start[i] < lastFinish) dp = -1;        // chosen set must be compatible
+            lastFinish = table->finish[i];
+            chosenWeight += table->weight[i];
+        }
+        if (dp != bruteBest || chosenWeight != bruteBest) weightedOk = 0;
+
+        radixSortActivities(table, table->start);
+        if (intervalPartitioning(table, 0, NULL, NULL) != depth) roomsOk = 0;
+        freeActivityTable(table);
+    }
+    printf("Weighted DP vs brute force (300 cases): %s\n", weightedOk ? "all match" : "MISMATCH");
+    printf("Room count vs max overlap (300 cases): %s\n", roomsOk ? "all match" : "MISMATCH");
+}
+
+/**
+ * Benchmark the structure-of-arrays engine on n random intervals
+ */
+void benchmarkActivities(size_t n) {
+    struct timespec t0;
+
+    // The original struct + qsort path, on a size it can handle, as reference
+    size_t legacyN = n < 10000000 ? n : 10000000;
+    Activity* legacy = (Activity*)malloc(legacyN * sizeof(Activity));
+    int* legacySelected = (int*)malloc(legacyN * sizeof(int));
+    ActivityTable* table = createActivityTable(legacyN);
+    if (!legacy || !legacySelected || !table) {
+        printf("Memory allocation failed\n");
+        return;
+    }
+    fillRandomActivities(table, 1000000000);
+    for (size_t i = 0; i < legacyN; i++) {
+        legacy[i].start = table->start[i];
+        legacy[i].finish = table->finish[i];
+        legacy[i].index = (int)i;
+        legacy[i].name[0] = '\0';
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int legacyCount = activitySelection(legacy, (int)legacyN, legacySelected);
+    double legacyTime = secondsSince(&t0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    radixSortActivities(table, table->finish);
+    size_t tableCount = selectActivitiesSorted(table, NULL);
+    double tableTime = secondsSince(&t0);
+    printf("%zu intervals: qsort of structs %.3f s, radix-sorted columns %.3f s (%d vs %zu selected)\n",
+           legacyN, legacyTime, tableTime, legacyCount, tableCount);
+    free(legacy);
+    free(legacySelected);
+    freeActivityTable(table);
+
+    // Full size
+    table = createActivityTable(n);
+    if (!table) return;
+    fillRandomActivities(table, 1000000000);
+    printf("%zu intervals:\n", n);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (!radixSortActivities(table, table->finish)) {
+        freeActivityTable(table);
+        return;
+    }
+    printf("  radix sort by finish:     %.3f s\n", secondsSince(&t0));
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    size_t count = selectActivitiesSorted(table, NULL);
+    printf("  greedy selection:         %.3f s (%zu selected)\n", secondsSince(&t0), count);
+
+    ActivityStream stream;
+    initActivityStream(&stream);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (size_t i = 0; i < n; i++) offerActivity(&stream, table->start[i], table->finish[i]);
+    printf("  streaming selection:      %.3f s (%lld accepted)\n", secondsSince(&t0), stream.accepted);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    long long weight = weightedActivitySelection(table, NULL);
+    printf("  weighted DP:              %.3f s (best weight %lld)\n", secondsSince(&t0), weight);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    radixSortActivities(table, table->start);
+    int rooms = intervalPartitioning(table, 0, NULL, NULL);
+    printf("  sort by start + rooms:    %.3f s (%d rooms)\n", secondsSince(&t0), rooms);
+
+    size_t rejected = 0;
+    char label[32];
+    snprintf(label, sizeof(label), "only %d rooms:", rooms / 2);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    intervalPartitioning(table, rooms / 2, NULL, &rejected);
+    printf("  %-26s%.3f s (%zu turned away)\n", label, secondsSince(&t0), rejected);
+    freeActivityTable(table);
+}
+
+int main(int argc, char* argv[]) {
     printf("=== Activity Selection - Greedy Algorithm ===\n");
     
     // Test Case 1: Classic example
@@ -359,6 +803,45 @@ int main() {
     printf("\n");
     
     compareStrategies(activities5, n5);
-    
+    printf("\n");
+
+    // Test Case 6: Weighted, k-room and streaming modes
+    printf("Test Case 6: Weighted, k-room and streaming modes\n");
+    ActivityTable* table = createActivityTable(n1);
+    for (int i = 0; i < n1; i++) {
+        table->start[i] = activities1[i].start;
+        table->finish[i] = activities1[i].finish;
+        table->weight[i] = activities1[i].finish - activities1[i].start;   // weight = duration
+    }
+    unsigned char chosen[11];
+    radixSortActivities(table, table->finish);
+    long long bestWeight = weightedActivitySelection(table, chosen);
+    printf("Weighted (weight = duration): total %lld using", bestWeight);
+    for (int i = 0; i < n1; i++)
+        if (chosen[i]) printf(" [%d, %d]", table->start[i], table->finish[i]);
+    printf("\n");
+
+    ActivityStream stream;
+    initActivityStream(&stream);
+    for (int i = 0; i < n1; i++) offerActivity(&stream, table->start[i], table->finish[i]);
+    printf("Streaming in finish order: %lld accepted (greedy: %d)\n", stream.accepted, count1);
+
+    int roomOf[11];
+    radixSortActivities(table, table->start);
+    int rooms = intervalPartitioning(table, 0, roomOf, NULL);
+    printf("Rooms needed for all activities: %d\n", rooms);
+    for (int i = 0; i < n1; i++)
+        printf("  [%d, %d] -> room %d\n", table->start[i], table->finish[i], roomOf[i]);
+    freeActivityTable(table);
+    printf("\n");
+
+    verifySchedulingModes();
+    printf("\n");
+
+    // Test Case 7: Large-scale benchmark
+    size_t bigN = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000000;
+    printf("Test Case 7: Benchmark\n");
+    benchmarkActivities(bigN);
+
     return 0;
 }
\ No newline at end of file
@@ -1,11 +1,21 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
 
 /**
  * Greedy Strategy: Fractional Knapsack Problem
  * Core Idea: Always pick items with highest value-to-weight ratio first
  * Time Complexity: O(n log n) due to sorting
  * Space Complexity: O(1) excluding input
+ *
+ * Also: an O(n) expected-time solver that finds the critical item by
+ * quickselect on ratios (optionally across threads), and a streaming mode
+ * with a bounded heap. Compile with: gcc -O2 -pthread FractionalKnapsack.c -lm
  */
 
 /**
@@ -170,7 +180,475 @@ void demonstrateGreedySteps(Item items[], int n, int capacity) {
     free(sortedItems);
 }
 
-int main() {
+/**
+ * Items in structure-of-arrays layout for the linear-time solver. Ratios are
+ * never stored: a/b > c/d is decided exactly as a*d > c*b in 64-bit.
+ */
+typedef struct {
+    int* value;
+    int* weight;
+    uint32_t* id;      // original position of each row
+    size_t n;
+} ItemTable;
+
+ItemTable* createItemTable(size_t n) {
+    ItemTable* table = (ItemTable*)malloc(sizeof(ItemTable));
+    if (!table) return NULL;
+    table->n = n;
+    table->value = (int*)malloc(n * sizeof(int));
+    table->weight = (int*)malloc(n * sizeof(int));
+    table->id = (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (!table->value || !table->weight || !table->id) {
+        printf("Memory allocation failed\n");
+        free(table->value);
+        free(table->weight);
+        free(table->id);
+        free(table);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) table->id[i] = (uint32_t)i;
+    return table;
+}
+
+void freeItemTable(ItemTable* table) {
+    if (!table) return;
+    free(table->value);
+    free(table->weight);
+    free(table->id);
+    free(table);
+}
+
+// Sign of value1/weight1 - value2/weight2, exact (zero weight = infinite ratio)
+static inline int compareRatios(int value1, int weight1, int value2, int weight2) {
+    long long left = (long long)value1 * weight2, right = (long long)value2 * weight1;
+    return (left > right) - (left < right);
+}
+
+static inline void swapRows(ItemTable* t, size_t a, size_t b) {
+    int v = t->value[a]; t->value[a] = t->value[b]; t->value[b] = v;
+    int w = t->weight[a]; t->weight[a] = t->weight[b]; t->weight[b] = w;
+    uint32_t i = t->id[a]; t->id[a] = t->id[b]; t->id[b] = i;
+}
+
+/**
+ * One slice of the table being solved. Rows [begin, lo) are taken whole,
+ * [lo, hi) are still undecided, [hi, end) are left out. After a partition
+ * round, [lo, betterEnd) beat the pivot ratio, [betterEnd, equalEnd) tie it.
+ */
+typedef struct {
+    ItemTable* table;
+    size_t begin, end, lo, hi;
+    size_t betterEnd, equalEnd;
+    int pivotValue, pivotWeight;
+    long long betterWeight, betterValue, equalWeight, equalValue;
+} KnapsackSlice;
+
+/**
+ * Three-way partition of a slice's undecided rows around the pivot ratio
+ * (Dutch national flag), summing weight and value of the upper two groups
+ */
+static void* partitionSlice(void* arg) {
+    KnapsackSlice* s = (KnapsackSlice*)arg;
+    ItemTable* t = s->table;
+    size_t better = s->lo, i = s->lo, worse = s->hi;
+    long long bw = 0, bv = 0, ew = 0, ev = 0;
+    while (i < worse) {
+        int c = compareRatios(t->value[i], t->weight[i], s->pivotValue, s->pivotWeight);
+        if (c > 0) {
+            bw += t->weight[i];
+            bv += t->value[i];
+            if (i != better) swapRows(t, i, better);
+            better++;
+            i++;
+        } else if (c == 0) {
+            ew += t->weight[i];
+            ev += t->value[i];
+            i++;
+        } else {
+            swapRows(t, i, --worse);
+        }
+    }
+    s->betterEnd = better;
+    s->equalEnd = worse;
+    s->betterWeight = bw;
+    s->betterValue = bv;
+    s->equalWeight = ew;
+    s->equalValue = ev;
+    return NULL;
+}
+
+/**
+ * Result of the linear-time solver: every row before a slice's lo is taken
+ * whole, plus criticalFraction of the critical item (id, or -1 if none)
+ */
+typedef struct {
+    double totalValue;
+    long long weightUsed;
+    long long criticalId;
+    double criticalFraction;
+} KnapsackSolution;
+
+/**
+ * Fractional knapsack in O(n) expected time, without sorting. Only the
+ * critical item matters: everything with a better ratio is taken, everything
+ * worse is left. Quickselect finds it - partition around a random pivot
+ * ratio; if the better group alone overflows the capacity recurse into it,
+ * otherwise take it (and the tied group, if it fits) and recurse into the
+ * worse group. Each round discards a constant fraction on average.
+ *
+ * With numThreads > 1 the table is cut into slices and every thread
+ * partitions its own slice around the same pivot; only the group sums are
+ * combined, so no rows move between slices.
+ * @param selected Optional per-original-item fractions (0.0 to 1.0)
+ */
+KnapsackSolution fractionalKnapsackLinear(ItemTable* table, long long capacity, int numThreads, double selected[]) {
+    KnapsackSolution solution = { 0.0, 0, -1, 0.0 };
+    size_t n = table->n;
+    if (numThreads < 1) numThreads = 1;
+    if ((size_t)numThreads > n / 4096 + 1) numThreads = (int)(n / 4096 + 1);   // small inputs: one slice
+
+    KnapsackSlice* slices = (KnapsackSlice*)malloc(numThreads * sizeof(KnapsackSlice));
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    for (int s = 0; s < numThreads; s++) {
+        slices[s].table = table;
+        slices[s].begin = slices[s].lo = n * s / numThreads;
+        slices[s].end = slices[s].hi = n * (s + 1) / numThreads;
+    }
+
+    long long remaining = capacity < 0 ? 0 : capacity;
+    long long takenValue = 0;
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+
+    for (;;) {
+        size_t active = 0;
+        for (int s = 0; s < numThreads; s++) active += slices[s].hi - slices[s].lo;
+        if (active == 0 || remaining == 0) break;
+
+        // Random pivot among the undecided rows of all slices
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        size_t pick = (size_t)(seed % active);
+        int s = 0;
+        while (pick >= slices[s].hi - slices[s].lo) {
+            pick -= slices[s].hi - slices[s].lo;
+            s++;
+        }
+        int pivotValue = table->value[slices[s].lo + pick];
+        int pivotWeight = table->weight[slices[s].lo + pick];
+
+        for (s = 0; s < numThreads; s++) {
+            slices[s].pivotValue = pivotValue;
+            slices[s].pivotWeight = pivotWeight;
+        }
+        if (numThreads == 1) {
+            partitionSlice(&slices[0]);
+        } else {
+            for (s = 0; s < numThreads; s++) pthread_create(&threads[s], NULL, partitionSlice, &slices[s]);
+            for (s = 0; s < numThreads; s++) pthread_join(threads[s], NULL);
+        }
+
+        long long betterWeight = 0, betterValue = 0, equalWeight = 0, equalValue = 0;
+        for (s = 0; s < numThreads; s++) {
+            betterWeight += slices[s].betterWeight;
+            betterValue += slices[s].betterValue;
+            equalWeight += slices[s].equalWeight;
+            equalValue += slices[s].equalValue;
+        }
+
+        if (betterWeight > remaining) {
+            // Critical item beats the pivot: drop the tied and worse rows
+            for (s = 0; s < numThreads; s++) slices[s].hi = slices[s].betterEnd;
+        } else if (betterWeight + equalWeight <= remaining) {
+            // Better and tied rows all fit: take them, continue among the worse
+            remaining -= betterWeight + equalWeight;
+            takenValue += betterValue + equalValue;
+            for (s = 0; s < numThreads; s++) slices[s].lo = slices[s].equalEnd;
+        } else {
+            // The critical ratio is the pivot's: take the better rows, then
+            // tied rows (any order) until the capacity runs out
+            remaining -= betterWeight;
+            takenValue += betterValue;
+            for (s = 0; s < numThreads; s++) {
+                size_t r = slices[s].betterEnd;
+                while (r < slices[s].equalEnd && table->weight[r] <= remaining) {
+                    remaining -= table->weight[r];
+                    takenValue += table->value[r];
+                    r++;
+                }
+                slices[s].lo = r;
+                if (r < slices[s].equalEnd && remaining > 0) {
+                    solution.criticalId = table->id[r];
+                    solution.criticalFraction = (double)remaining / table->weight[r];
+                    solution.totalValue = table->value[r] * solution.criticalFraction;
+                    remaining = 0;
+                }
+                slices[s].hi = slices[s].lo;
+            }
+            break;
+        }
+    }
+
+    solution.totalValue += (double)takenValue;
+    solution.weightUsed = (capacity < 0 ? 0 : capacity) - remaining;
+
+    if (selected) {
+        for (int s = 0; s < numThreads; s++) {
+            for (size_t r = slices[s].begin; r < slices[s].end; r++) {
+                selected[table->id[r]] = r < slices[s].lo ? 1.0 : 0.0;
+            }
+        }
+        if (solution.criticalId >= 0) selected[solution.criticalId] = solution.criticalFraction;
+    }
+    free(slices);
+    free(threads);
+    return solution;
+}
+
+/**
+ * Streaming mode for when the capacity covers only a small prefix of the
+ * items by ratio. Items arrive one at a time; a min-heap (worst ratio on
+ * top) keeps just the best items needed to fill the capacity. Once the heap
+ * minus its worst item still fills the capacity, that item can never be
+ * used and is evicted, and anything worse than the top is rejected in O(1).
+ * Memory is bounded by the size of the answer, not the input.
+ */
+typedef struct {
+    long long capacity;
+    long long heapWeight;        // total weight of the items in the heap
+    long long freeValue;         // value of zero-weight items (always taken)
+    int* value;
+    int* weight;
+    uint32_t* id;
+    size_t size, heapCapacity;
+    size_t seen;
+} KnapsackStream;
+
+void initKnapsackStream(KnapsackStream* stream, long long capacity) {
+    memset(stream, 0, sizeof(KnapsackStream));
+    stream->capacity = capacity;
+}
+
+void freeKnapsackStream(KnapsackStream* stream) {
+    free(stream->value);
+    free(stream->weight);
+    free(stream->id);
+}
+
+static void streamSiftDown(KnapsackStream* h, size_t pos) {
+    int v = h->value[pos], w = h->weight[pos];
+    uint32_t i = h->id[pos];
+    for (;;) {
+        size_t child = 2 * pos + 1;
+        if (child >= h->size) break;
+        if (child + 1 < h->size &&
+            compareRatios(h->value[child + 1], h->weight[child + 1], h->value[child], h->weight[child]) < 0) child++;
+        if (compareRatios(h->value[child], h->weight[child], v, w) >= 0) break;
+        h->value[pos] = h->value[child];
+        h->weight[pos] = h->weight[child];
+        h->id[pos] = h->id[child];
+        pos = child;
+    }
+    h->value[pos] = v;
+    h->weight[pos] = w;
+    h->id[pos] = i;
+}
+
+/**
+ * Offer the next item
+ * @return 1 if kept (for now), 0 if rejected
+ */
+int offerKnapsackItem(KnapsackStream* h, int value, int weight) {
+    uint32_t id = (uint32_t)h->seen++;
+    if (weight == 0) {
+        h->freeValue += value;
+        return 1;
+    }
+    // Heap already fills the capacity and this item is no better than its worst
+    if (h->size > 0 && h->heapWeight >= h->capacity &&
+        compareRatios(value, weight, h->value[0], h->weight[0]) <= 0) return 0;
+
+    if (h->size == h->heapCapacity) {
+        h->heapCapacity = h->heapCapacity ? 2 * h->heapCapacity : 64;
+        h->value = (int*)realloc(h->value, h->heapCapacity * sizeof(int));
+        h->weight = (int*)realloc(h->weight, h->heapCapacity * sizeof(int));
+        h->id = (uint32_t*)realloc(h->id, h->heapCapacity * sizeof(uint32_t));
+    }
+    size_t pos = h->size++;                 // sift up
+    while (pos > 0 && compareRatios(h->value[(pos - 1) / 2], h->weight[(pos - 1) / 2], value, weight) > 0) {
+        size_t parent = (pos - 1) / 2;
+        h->value[pos] = h->value[parent];
+        h->weight[pos] = h->weight[parent];
+        h->id[pos] = h->id[parent];
+        pos = parent;
+    }
+    h->value[pos] = value;
+    h->weight[pos] = weight;
+    h->id[pos] = id;
+    h->heapWeight += weight;
+
+    // Evict worst items the rest of the heap no longer needs
+    while (h->size > 1 && h->heapWeight - h->weight[0] >= h->capacity) {
+        h->heapWeight -= h->weight[0];
+        h->size--;
+        h->value[0] = h->value[h->size];
+        h->weight[0] = h->weight[h->size];
+        h->id[0] = h->id[h->size];
+        streamSiftDown(h, 0);
+    }
+    return 1;
+}
+
+/**
+ * Final answer from the kept items: everything but the heap top is taken
+ * whole, the top (worst kept ratio) is the critical item
+ */
+KnapsackSolution finishKnapsackStream(const KnapsackStream* h) {
+    KnapsackSolution solution = { (double)h->freeValue, 0, -1, 0.0 };
+    if (h->size == 0) return solution;
+    long long rest = h->heapWeight - h->weight[0];    // < capacity, or the top would have been evicted
+    long long restValue = 0;
+    for (size_t i = 1; i < h->size; i++) restValue += h->value[i];
+    if (rest >= h->capacity) {                        // only if a single item is left and it fills everything
+        rest = 0;
+        restValue = 0;
+    }
+    long long room = h->capacity - rest;
+    double fraction = room >= h->weight[0] ? 1.0 : (double)room / h->weight[0];
+    solution.totalValue += (double)restValue + h->value[0] * fraction;
+    solution.weightUsed = rest + (long long)(h->weight[0] * fraction + 0.5);
+    solution.criticalId = h->id[0];
+    solution.criticalFraction = fraction;
+    return solution;
+}
+
+static double secondsSince(struct timespec* t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (t1.tv_sec - t0->tv_sec) + (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+static uint64_t benchState = 88172645463325252ull;
+
+static uint32_t benchRandom(void) {
+    benchState ^= benchState << 13;
+    benchState ^= benchState >> 7;
+    benchState ^= benchState << 17;
+    return (uint32_t)(benchState >> 32);
+}
+
+static int closeEnough(double a, double b) {
+    double scale = fabs(a) > 1.0 ? fabs(a) : 1.0;
+    return fabs(a - b) <= 1e-9 * scale;
+}
+
+/**
+ * Check the linear, parallel and streaming solvers against the sorting one
+ */
+void verifyKnapsackSolvers(void) {
+    int ok = 1;
+    for (int trial = 0; trial < 500; trial++) {
+        int n = 1 + (int)(benchRandom() % (trial % 10 == 0 ? 50000 : 200));   // large ones get several slices
+        Item* items = (Item*)malloc(n * sizeof(Item));
+        ItemTable* table = createItemTable(n);
+        double* expected = (double*)malloc(n * sizeof(double));
+        double* got = (double*)malloc(n * sizeof(double));
+        long long totalWeight = 0;
+        for (int i = 0; i < n; i++) {
+            items[i].value = 1 + (int)(benchRandom() % (trial % 2 ? 10 : 1000));   // odd trials: many ties
+            items[i].weight = 1 + (int)(benchRandom() % (trial % 2 ? 5 : 1000));
+            items[i].index = i;
+            table->value[i] = items[i].value;
+            table->weight[i] = items[i].weight;
+            totalWeight += items[i].weight;
+        }
+        int capacity = (int)(benchRandom() % (totalWeight + 10));
+        double best = fractionalKnapsack(items, n, capacity, expected);
+
+        KnapsackSolution linear = fractionalKnapsackLinear(table, capacity, 1 + trial % 4, got);
+        double fromFractions = 0.0;
+        for (int i = 0; i < n; i++) fromFractions += table->value[i] * got[table->id[i]];
+        if (!closeEnough(linear.totalValue, best) || !closeEnough(fromFractions, best)) ok = 0;
+
+        KnapsackStream stream;
+        initKnapsackStream(&stream, capacity);
+        for (int i = 0; i < n; i++) offerKnapsackItem(&stream, items[i].value, items[i].weight);
+        if (!closeEnough(finishKnapsackStream(&stream).totalValue, best)) ok = 0;
+        freeKnapsackStream(&stream);
+
+        free(items);
+        free(expected);
+        free(got);
+        freeItemTable(table);
+    }
+    printf("Linear, parallel and streaming vs sorting (500 cases): %s\n", ok ? "all match" : "MISMATCH");
+}
+
+/**
+ * Benchmark on n random candidates (value, cost)
+ */
+void benchmarkKnapsack(size_t n) {
+    struct timespec t0;
+    int numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (numThreads < 1) numThreads = 1;
+
+    // The sorting solver on a size it can handle, as reference
+    size_t legacyN = n < 10000000 ? n : 10000000;
+    Item* items = (Item*)malloc(legacyN * sizeof(Item));
+    double* legacySelected = (double*)malloc(legacyN * sizeof(double));
+    ItemTable* table = createItemTable(legacyN);
+    if (!items || !legacySelected || !table) {
+        printf("Memory allocation failed\n");
+        return;
+    }
+    for (size_t i = 0; i < legacyN; i++) {
+        items[i].value = table->value[i] = 1 + (int)(benchRandom() % 1000000);
+        items[i].weight = table->weight[i] = 1 + (int)(benchRandom() % 1000000);
+        items[i].index = (int)i;
+    }
+    int legacyCapacity = 1000000000;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    double legacyValue = fractionalKnapsack(items, (int)legacyN, legacyCapacity, legacySelected);
+    double legacyTime = secondsSince(&t0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    KnapsackSolution linear = fractionalKnapsackLinear(table, legacyCapacity, 1, NULL);
+    printf("%zu items: sort %.3f s, quickselect %.3f s (values %s)\n", legacyN, legacyTime,
+           secondsSince(&t0), closeEnough(legacyValue, linear.totalValue) ? "match" : "DIFFER");
+    free(items);
+    free(legacySelected);
+    freeItemTable(table);
+
+    table = createItemTable(n);
+    if (!table) return;
+    long long capacities[] = { 1000000000LL, 5000000000000LL };   // small prefix, about a tenth of the items
+    printf("%zu items, %d thread(s):\n", n, numThreads);
+    for (int c = 0; c < 2; c++) {
+        benchState = 88172645463325252ull;
+        for (size_t i = 0; i < n; i++) {
+            table->value[i] = 1 + (int)(benchRandom() % 1000000);
+            table->weight[i] = 1 + (int)(benchRandom() % 1000000);
+            table->id[i] = (uint32_t)i;
+        }
+
+        KnapsackStream stream;
+        initKnapsackStream(&stream, capacities[c]);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) offerKnapsackItem(&stream, table->value[i], table->weight[i]);
+        KnapsackSolution streamed = finishKnapsackStream(&stream);
+        double streamTime = secondsSince(&t0);
+        size_t kept = stream.size;
+        freeKnapsackStream(&stream);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        KnapsackSolution parallel = fractionalKnapsackLinear(table, capacities[c], numThreads, NULL);
+        double parallelTime = secondsSince(&t0);
+
+        printf("  capacity %lld: quickselect %.3f s, streaming heap %.3f s (%zu items kept), value %.1f (%s)\n",
+               capacities[c], parallelTime, streamTime, kept, parallel.totalValue,
+               closeEnough(parallel.totalValue, streamed.totalValue) ? "match" : "DIFFER");
+    }
+    freeItemTable(table);
+}
+
+int main(int argc, char* argv[]) {
     printf("=== Fractional Knapsack - Greedy Algorithm ===\n");
     
     // Test Case 1: Classic example
@@ -272,7 +750,29 @@ int main() {
     
     double maxValue5 = fractionalKnapsack(items5, n5, capacity5, selected5);
     printSelection(items5, n5, selected5, maxValue5, capacity5);
-    printf("Expected: No items selected due to zero capacity\n");
-    
+    printf("Expected: No items selected due to zero capacity\n\n");
+
+    // Test Case 6: Linear-time solver on the classic example
+    printf("Test Case 6: Quickselect solver (no sorting)\n");
+    ItemTable* table = createItemTable(3);
+    int values6[] = {60, 100, 120}, weights6[] = {10, 20, 30};
+    for (int i = 0; i < 3; i++) {
+        table->value[i] = values6[i];
+        table->weight[i] = weights6[i];
+    }
+    double selected6[3];
+    KnapsackSolution solution6 = fractionalKnapsackLinear(table, 50, 1, selected6);
+    for (int i = 0; i < 3; i++) printf("  Item %d: %.1f%%\n", i, selected6[i] * 100);
+    printf("Total Value: %.2f (critical item %lld)\n\n", solution6.totalValue, solution6.criticalId);
+    freeItemTable(table);
+
+    verifyKnapsackSolvers();
+    printf("\n");
+
+    // Test Case 7: Large-scale benchmark
+    size_t bigN = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000000;
+    printf("Test Case 7: Benchmark\n");
+    benchmarkKnapsack(bigN);
+
     return 0;
 }
\ No newline at end of file
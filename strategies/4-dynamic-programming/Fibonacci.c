@@ -2,12 +2,17 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <stdint.h>
 
 /**
  * Dynamic Programming Strategy: Fibonacci Sequence
  * Core Idea: Store solutions to subproblems to avoid redundant calculations
  * Time Complexity: O(n) with memoization/tabulation vs O(2^n) naive recursion
  * Space Complexity: O(n) for storing intermediate results
+ *
+ * Beyond F(92) the 64-bit versions overflow. The fast-doubling engines below
+ * compute F(n) in O(log n) steps: exactly with arbitrary-precision integers,
+ * modulo a 64-bit m, or as batched modular queries sharing one table.
  */
 
 /**
@@ -220,6 +225,668 @@ int isFibonacciNumber(long long num) {
     return findFibonacciPosition(num) != -1;
 }
 
+/* ======================================================================
+ * Arbitrary-precision integers
+ * Little-endian base-2^32 limbs. Multiplication switches from schoolbook
+ * to Karatsuba to a number-theoretic transform as operands grow, so a
+ * single fast-doubling step on million-digit values stays near O(n log n).
+ * ====================================================================== */
+
+#define KARATSUBA_THRESHOLD 32
+#define NTT_THRESHOLD 4096
+#define NTT_MODULUS 0xFFFFFFFF00000001ULL   // 2^64 - 2^32 + 1 ("Goldilocks" prime)
+#define NTT_GENERATOR 7ULL
+#define NTT_EPSILON 0xFFFFFFFFULL           // 2^64 mod NTT_MODULUS
+
+typedef struct {
+    uint32_t* limbs;
+    size_t length;      // number of significant limbs (0 represents zero)
+    size_t capacity;
+} BigInt;
+
+void bigIntInit(BigInt* x) {
+    x->limbs = NULL;
+    x->length = 0;
+    x->capacity = 0;
+}
+
+void bigIntFree(BigInt* x) {
+    free(x->limbs);
+    bigIntInit(x);
+}
+
+static void bigIntReserve(BigInt* x, size_t capacity) {
+    if (capacity <= x->capacity) return;
+    size_t newCapacity = x->capacity ? x->capacity : 4;
+    while (newCapacity < capacity) newCapacity *= 2;
+    x->limbs = (uint32_t*)realloc(x->limbs, newCapacity * sizeof(uint32_t));
+    x->capacity = newCapacity;
+}
+
+static void bigIntNormalize(BigInt* x) {
+    while (x->length > 0 && x->limbs[x->length - 1] == 0) {
+        x->length--;
+    }
+}
+
+void bigIntSetU64(BigInt* x, uint64_t value) {
+    bigIntReserve(x, 2);
+    x->limbs[0] = (uint32_t)value;
+    x->limbs[1] = (uint32_t)(value >> 32);
+    x->length = 2;
+    bigIntNormalize(x);
+}
+
+void bigIntCopy(BigInt* dest, const BigInt* src) {
+    if (dest == src) return;
+    bigIntReserve(dest, src->length);
+    if (src->length > 0) {
+        memcpy(dest->limbs, src->limbs, src->length * sizeof(uint32_t));
+    }
+    dest->length = src->length;
+}
+
+int bigIntCompare(const BigInt* a, const BigInt* b) {
+    if (a->length != b->length) return a->length < b->length ? -1 : 1;
+    for (size_t i = a->length; i-- > 0;) {
+        if (a->limbs[i] != b->limbs[i]) return a->limbs[i] < b->limbs[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+size_t bigIntBitLength(const BigInt* x) {
+    if (x->length == 0) return 0;
+    size_t bits = (x->length - 1) * 32;
+    uint32_t top = x->limbs[x->length - 1];
+    while (top) {
+        bits++;
+        top >>= 1;
+    }
+    return bits;
+}
+
+/**
+ * result = a + b (result may alias either operand)
+ */
+void bigIntAdd(BigInt* result, const BigInt* a, const BigInt* b) {
+    if (a->length < b->length) {
+        const BigInt* t = a;
+        a = b;
+        b = t;
+    }
+    size_t aLength = a->length, bLength = b->length;
+    bigIntReserve(result, aLength + 1);
+    
+    uint64_t carry = 0;
+    for (size_t i = 0; i < aLength; i++) {
+        uint64_t sum = (uint64_t)a->limbs[i] + (i < bLength ? b->limbs[i] : 0) + carry;
+        result->limbs[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    result->limbs[aLength] = (uint32_t)carry;
+    result->length = aLength + 1;
+    bigIntNormalize(result);
+}
+
+/**
+ * result = a - b, requires a >= b (result may alias either operand)
+ */
+void bigIntSub(BigInt* result, const BigInt* a, const BigInt* b) {
+    size_t aLength = a->length, bLength = b->length;
+    bigIntReserve(result, aLength);
+    
+    int64_t borrow = 0;
+    for (size_t i = 0; i < aLength; i++) {
+        int64_t diff = (int64_t)a->limbs[i] - (i < bLength ? b->limbs[i] : 0) - borrow;
+        borrow = diff < 0;
+        result->limbs[i] = (uint32_t)(diff + (borrow << 32));
+    }
+    result->length = aLength;
+    bigIntNormalize(result);
+}
+
+// out[0..an+bn) = a * b, out must be zeroed and must not overlap the inputs
+static void limbsMulSchoolbook(const uint32_t* a, size_t an, const uint32_t* b, size_t bn,
+                               uint32_t* out) {
+    for (size_t i = 0; i < an; i++) {
+        uint64_t carry = 0;
+        uint64_t ai = a[i];
+        for (size_t j = 0; j < bn; j++) {
+            uint64_t t = ai * b[j] + out[i + j] + carry;
+            out[i + j] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        out[i + bn] = (uint32_t)carry;
+    }
+}
+
+// out[0..) += a[0..an), propagating the carry as far as needed
+static void limbsAddInto(uint32_t* out, const uint32_t* a, size_t an) {
+    uint64_t carry = 0;
+    size_t i = 0;
+    for (; i < an; i++) {
+        uint64_t sum = (uint64_t)out[i] + a[i] + carry;
+        out[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    while (carry) {
+        uint64_t sum = (uint64_t)out[i] + carry;
+        out[i++] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+}
+
+// out[0..) -= a[0..an), the caller guarantees no final borrow
+static void limbsSubFrom(uint32_t* out, const uint32_t* a, size_t an) {
+    int64_t borrow = 0;
+    size_t i = 0;
+    for (; i < an; i++) {
+        int64_t diff = (int64_t)out[i] - a[i] - borrow;
+        borrow = diff < 0;
+        out[i] = (uint32_t)(diff + (borrow << 32));
+    }
+    while (borrow) {
+        int64_t diff = (int64_t)out[i] - borrow;
+        borrow = diff < 0;
+        out[i++] = (uint32_t)(diff + (borrow << 32));
+    }
+}
+
+// r[0..n+1) = a[0..an) + b[0..bn), where n = max(an, bn)
+static size_t limbsSum(const uint32_t* a, size_t an, const uint32_t* b, size_t bn, uint32_t* r) {
+    size_t n = an > bn ? an : bn;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t sum = (uint64_t)(i < an ? a[i] : 0) + (i < bn ? b[i] : 0) + carry;
+        r[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    r[n] = (uint32_t)carry;
+    return n + 1;
+}
+
+static void limbsMul(const uint32_t* a, size_t an, const uint32_t* b, size_t bn, uint32_t* out);
+
+/**
+ * Karatsuba multiplication: three half-size products instead of four.
+ * Unbalanced operands are split so the smaller one is multiplied piecewise.
+ */
+static void limbsMulKaratsuba(const uint32_t* a, size_t an, const uint32_t* b, size_t bn,
+                              uint32_t* out) {
+    if (an < bn) {
+        const uint32_t* t = a; a = b; b = t;
+        size_t tn = an; an = bn; bn = tn;
+    }
+    if (bn < KARATSUBA_THRESHOLD) {
+        limbsMulSchoolbook(a, an, b, bn, out);
+        return;
+    }
+    
+    size_t m = (an + 1) / 2;
+    if (bn <= m) {
+        // out = a_lo * b + (a_hi * b) << m
+        limbsMul(a, m, b, bn, out);
+        uint32_t* high = (uint32_t*)calloc(an - m + bn, sizeof(uint32_t));
+        limbsMul(a + m, an - m, b, bn, high);
+        limbsAddInto(out + m, high, an - m + bn);
+        free(high);
+        return;
+    }
+    
+    const uint32_t *a0 = a, *a1 = a + m, *b0 = b, *b1 = b + m;
+    size_t a1n = an - m, b1n = bn - m;
+    
+    // z0 and z2 go straight into their final positions in out
+    limbsMul(a0, m, b0, m, out);
+    limbsMul(a1, a1n, b1, b1n, out + 2 * m);
+    
+    uint32_t* sa = (uint32_t*)malloc((m + 1) * sizeof(uint32_t));
+    uint32_t* sb = (uint32_t*)malloc((m + 1) * sizeof(uint32_t));
+    size_t san = limbsSum(a0, m, a1, a1n, sa);
+    size_t sbn = limbsSum(b0, m, b1, b1n, sb);
+    
+    uint32_t* z1 = (uint32_t*)calloc(san + sbn, sizeof(uint32_t));
+    limbsMul(sa, san, sb, sbn, z1);
+    limbsSubFrom(z1, out, 2 * m);
+    limbsSubFrom(z1, out + 2 * m, a1n + b1n);
+    
+    size_t z1n = san + sbn;
+    while (z1n > 0 && z1[z1n - 1] == 0) z1n--;
+    limbsAddInto(out + m, z1, z1n);
+    
+    free(sa);
+    free(sb);
+    free(z1);
+}
+
+static uint64_t nttReduce128(unsigned __int128 x) {
+    uint64_t low = (uint64_t)x;
+    uint64_t high = (uint64_t)(x >> 64);
+    uint64_t highHigh = high >> 32;
+    uint64_t highLow = high & NTT_EPSILON;
+    
+    // 2^96 = -1 and 2^64 = 2^32 - 1 modulo the Goldilocks prime
+    uint64_t t0 = low - highHigh;
+    if (low < highHigh) t0 -= NTT_EPSILON;
+    uint64_t t1 = highLow * NTT_EPSILON;
+    uint64_t t2 = t0 + t1;
+    if (t2 < t0) t2 += NTT_EPSILON;
+    if (t2 >= NTT_MODULUS) t2 -= NTT_MODULUS;
+    return t2;
+}
+
+static uint64_t nttMul(uint64_t a, uint64_t b) {
+    return nttReduce128((unsigned __int128)a * b);
+}
+
+static uint64_t nttAdd(uint64_t a, uint64_t b) {
+    uint64_t sum = a + b;
+    if (sum < a || sum >= NTT_MODULUS) sum -= NTT_MODULUS;
+    return sum;
+}
+
+static uint64_t nttSub(uint64_t a, uint64_t b) {
+    uint64_t diff = a - b;
+    if (a < b) diff += NTT_MODULUS;
+    return diff;
+}
+
+static uint64_t nttPow(uint64_t base, uint64_t exponent) {
+    uint64_t result = 1;
+    while (exponent) {
+        if (exponent & 1) result = nttMul(result, base);
+        base = nttMul(base, base);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+static void nttTransform(uint64_t* data, size_t n, int inverse) {
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            uint64_t t = data[i];
+            data[i] = data[j];
+            data[j] = t;
+        }
+    }
+    
+    for (size_t length = 2; length <= n; length <<= 1) {
+        uint64_t root = nttPow(NTT_GENERATOR, (NTT_MODULUS - 1) / length);
+        if (inverse) root = nttPow(root, NTT_MODULUS - 2);
+        
+        size_t half = length / 2;
+        uint64_t* twiddles = (uint64_t*)malloc(half * sizeof(uint64_t));
+        twiddles[0] = 1;
+        for (size_t k = 1; k < half; k++) twiddles[k] = nttMul(twiddles[k - 1], root);
+        
+        for (size_t start = 0; start < n; start += length) {
+            for (size_t k = 0; k < half; k++) {
+                uint64_t u = data[start + k];
+                uint64_t v = nttMul(data[start + k + half], twiddles[k]);
+                data[start + k] = nttAdd(u, v);
+                data[start + k + half] = nttSub(u, v);
+            }
+        }
+        free(twiddles);
+    }
+    
+    if (inverse) {
+        uint64_t nInverse = nttPow(n, NTT_MODULUS - 2);
+        for (size_t i = 0; i < n; i++) data[i] = nttMul(data[i], nInverse);
+    }
+}
+
+/**
+ * NTT multiplication over the Goldilocks prime. Limbs are split into 16-bit
+ * digits so every convolution coefficient (< 2^21 * 2^32) fits below the
+ * modulus and the result is exact. Squaring reuses the forward transform.
+ */
+static void limbsMulNTT(const uint32_t* a, size_t an, const uint32_t* b, size_t bn,
+                        uint32_t* out) {
+    size_t digits = 2 * (an + bn);
+    size_t n = 1;
+    while (n < digits) n <<= 1;
+    
+    int squaring = (a == b && an == bn);
+    uint64_t* fa = (uint64_t*)calloc(n, sizeof(uint64_t));
+    uint64_t* fb = squaring ? fa : (uint64_t*)calloc(n, sizeof(uint64_t));
+    
+    for (size_t i = 0; i < an; i++) {
+        fa[2 * i] = a[i] & 0xFFFF;
+        fa[2 * i + 1] = a[i] >> 16;
+    }
+    nttTransform(fa, n, 0);
+    if (!squaring) {
+        for (size_t i = 0; i < bn; i++) {
+            fb[2 * i] = b[i] & 0xFFFF;
+            fb[2 * i + 1] = b[i] >> 16;
+        }
+        nttTransform(fb, n, 0);
+    }
+    
+    for (size_t i = 0; i < n; i++) fa[i] = nttMul(fa[i], fb[i]);
+    nttTransform(fa, n, 1);
+    
+    uint64_t carry = 0;
+    for (size_t i = 0; i < an + bn; i++) {
+        uint64_t low = fa[2 * i] + carry;
+        carry = low >> 16;
+        uint64_t high = fa[2 * i + 1] + carry;
+        carry = high >> 16;
+        out[i] = (uint32_t)((low & 0xFFFF) | ((high & 0xFFFF) << 16));
+    }
+    
+    free(fa);
+    if (!squaring) free(fb);
+}
+
+static void limbsMul(const uint32_t* a, size_t an, const uint32_t* b, size_t bn, uint32_t* out) {
+    size_t smaller = an < bn ? an : bn;
+    if (smaller >= NTT_THRESHOLD) {
+        limbsMulNTT(a, an, b, bn, out);
+    } else if (smaller >= KARATSUBA_THRESHOLD) {
+        limbsMulKaratsuba(a, an, b, bn, out);
+    } else {
+        limbsMulSchoolbook(a, an, b, bn, out);
+    }
+}
+
+/**
+ * result = a * b (result may alias either operand)
+ */
+void bigIntMul(BigInt* result, const BigInt* a, const BigInt* b) {
+    if (a->length == 0 || b->length == 0) {
+        result->length = 0;
+        return;
+    }
+    size_t length = a->length + b->length;
+    uint32_t* product = (uint32_t*)calloc(length, sizeof(uint32_t));
+    limbsMul(a->limbs, a->length, b->limbs, b->length, product);
+    
+    free(result->limbs);
+    result->limbs = product;
+    result->length = length;
+    result->capacity = length;
+    bigIntNormalize(result);
+}
+
+/**
+ * Remainder of a big integer by a machine word
+ */
+uint64_t bigIntModU64(const BigInt* x, uint64_t m) {
+    unsigned __int128 remainder = 0;
+    for (size_t i = x->length; i-- > 0;) {
+        remainder = ((remainder << 32) | x->limbs[i]) % m;
+    }
+    return (uint64_t)remainder;
+}
+
+/**
+ * Decimal representation (caller frees). Quadratic, meant for printing.
+ */
+char* bigIntToString(const BigInt* x) {
+    if (x->length == 0) {
+        char* zero = (char*)malloc(2);
+        strcpy(zero, "0");
+        return zero;
+    }
+    
+    uint32_t* work = (uint32_t*)malloc(x->length * sizeof(uint32_t));
+    memcpy(work, x->limbs, x->length * sizeof(uint32_t));
+    size_t length = x->length;
+    
+    size_t chunkCount = 0;
+    uint32_t* chunks = (uint32_t*)malloc((x->length * 10 / 9 + 2) * sizeof(uint32_t));
+    
+    // Peel off nine decimal digits at a time
+    while (length > 0) {
+        uint64_t remainder = 0;
+        for (size_t i = length; i-- > 0;) {
+            uint64_t current = (remainder << 32) | work[i];
+            work[i] = (uint32_t)(current / 1000000000u);
+            remainder = current % 1000000000u;
+        }
+        chunks[chunkCount++] = (uint32_t)remainder;
+        while (length > 0 && work[length - 1] == 0) length--;
+    }
+    
+    char* text = (char*)malloc(chunkCount * 9 + 1);
+    int offset = sprintf(text, "%u", chunks[chunkCount - 1]);
+    for (size_t i = chunkCount - 1; i-- > 0;) {
+        offset += sprintf(text + offset, "%09u", chunks[i]);
+    }
+    
+    free(work);
+    free(chunks);
+    return text;
+}
+
+/**
+ * Parse a non-negative decimal string
+ */
+void bigIntFromString(BigInt* x, const char* text) {
+    x->length = 0;
+    for (const char* p = text; *p >= '0' && *p <= '9'; p++) {
+        uint64_t carry = (uint64_t)(*p - '0');
+        bigIntReserve(x, x->length + 1);
+        for (size_t i = 0; i < x->length; i++) {
+            uint64_t t = (uint64_t)x->limbs[i] * 10 + carry;
+            x->limbs[i] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        if (carry) x->limbs[x->length++] = (uint32_t)carry;
+    }
+}
+
+/* ======================================================================
+ * O(log n) fast doubling
+ *   F(2k)   = F(k) * (2F(k+1) - F(k))
+ *   F(2k+1) = F(k)^2 + F(k+1)^2
+ * ====================================================================== */
+
+/**
+ * Exact F(n) as a big integer. Three multiplications per bit of n; the last
+ * few dominate, so the total cost is a small multiple of one full-size
+ * multiplication (F(10^7) has about 2.09 million digits).
+ */
+void fibonacciBig(uint64_t n, BigInt* result) {
+    BigInt a, b, t, square;
+    bigIntInit(&a);
+    bigIntInit(&b);
+    bigIntInit(&t);
+    bigIntInit(&square);
+    bigIntSetU64(&a, 0);  // F(k)
+    bigIntSetU64(&b, 1);  // F(k+1)
+    
+    int topBit = 63;
+    while (topBit >= 0 && !((n >> topBit) & 1)) topBit--;
+    
+    for (int bit = topBit; bit >= 0; bit--) {
+        // t = F(2k) = F(k) * (2F(k+1) - F(k))
+        bigIntAdd(&t, &b, &b);
+        bigIntSub(&t, &t, &a);
+        bigIntMul(&t, &t, &a);
+        
+        // b = F(2k+1) = F(k)^2 + F(k+1)^2
+        bigIntMul(&square, &a, &a);
+        bigIntMul(&b, &b, &b);
+        bigIntAdd(&b, &b, &square);
+        
+        if ((n >> bit) & 1) {
+            bigIntAdd(&a, &t, &b);   // a = F(2k+2), then swap into place
+            BigInt swap = a; a = b; b = swap;
+        } else {
+            BigInt swap = a; a = t; t = swap;
+        }
+    }
+    
+    bigIntCopy(result, &a);
+    bigIntFree(&a);
+    bigIntFree(&b);
+    bigIntFree(&t);
+    bigIntFree(&square);
+}
+
+static uint64_t mulMod(uint64_t a, uint64_t b, uint64_t m) {
+    if (m <= UINT32_MAX) return (a * b) % m;
+    return (uint64_t)(((unsigned __int128)a * b) % m);
+}
+
+static uint64_t addMod(uint64_t a, uint64_t b, uint64_t m) {
+    return a >= m - b ? a - (m - b) : a + b;
+}
+
+static uint64_t subMod(uint64_t a, uint64_t b, uint64_t m) {
+    return a >= b ? a - b : a + (m - b);
+}
+
+/**
+ * F(n) mod m for any 64-bit n and modulus m >= 1, in O(log n) word operations
+ */
+uint64_t fibonacciMod(uint64_t n, uint64_t m) {
+    if (m == 1) return 0;
+    uint64_t a = 0, b = 1;  // F(k), F(k+1)
+    
+    for (int bit = 63; bit >= 0; bit--) {
+        uint64_t c = mulMod(a, subMod(addMod(b, b, m), a, m), m);   // F(2k)
+        uint64_t d = addMod(mulMod(a, a, m), mulMod(b, b, m), m);   // F(2k+1)
+        if ((n >> bit) & 1) {
+            a = d;
+            b = addMod(c, d, m);
+        } else {
+            a = c;
+            b = d;
+        }
+    }
+    return a;
+}
+
+/* ======================================================================
+ * Batched F(n) mod m queries
+ * Every 64-bit n is split into FIB_WINDOW_BITS-bit digits. The table stores
+ * (F(d * 2^(w*W)), F(d * 2^(w*W) + 1)) for every digit value d and window w,
+ * so a query combines at most 64 / W table entries with the addition law
+ *   F(x+y)   = F(x)F(y+1) + F(x+1)F(y) - F(x)F(y)
+ *   F(x+y+1) = F(x+1)F(y+1) + F(x)F(y)
+ * instead of running 64 doubling steps.
+ * ====================================================================== */
+
+#define FIB_WINDOW_BITS 8
+#define FIB_WINDOW_COUNT (64 / FIB_WINDOW_BITS)
+#define FIB_WINDOW_SIZE (1 << FIB_WINDOW_BITS)
+
+typedef struct {
+    uint64_t modulus;
+    uint64_t value[FIB_WINDOW_COUNT][FIB_WINDOW_SIZE];  // F(d * 2^(wW)) mod m
+    uint64_t next[FIB_WINDOW_COUNT][FIB_WINDOW_SIZE];   // F(d * 2^(wW) + 1) mod m
+} FibonacciModTable;
+
+static void fibonacciCombine(uint64_t* fx, uint64_t* fx1, uint64_t fy, uint64_t fy1, uint64_t m) {
+    uint64_t xy = mulMod(*fx, fy, m);
+    uint64_t sum = subMod(addMod(mulMod(*fx, fy1, m), mulMod(*fx1, fy, m), m), xy, m);
+    uint64_t sumNext = addMod(mulMod(*fx1, fy1, m), xy, m);
+    *fx = sum;
+    *fx1 = sumNext;
+}
+
+FibonacciModTable* fibonacciModTableCreate(uint64_t modulus) {
+    FibonacciModTable* table = (FibonacciModTable*)malloc(sizeof(FibonacciModTable));
+    table->modulus = modulus;
+    
+    for (int w = 0; w < FIB_WINDOW_COUNT; w++) {
+        // Step = 2^(w*W); successive digits add one step each
+        uint64_t step = 1ULL << (w * FIB_WINDOW_BITS);
+        uint64_t stepValue = fibonacciMod(step, modulus);
+        uint64_t stepNext = fibonacciMod(step + 1, modulus);
+        
+        table->value[w][0] = 0;
+        table->next[w][0] = 1 % modulus;
+        for (int d = 1; d < FIB_WINDOW_SIZE; d++) {
+            uint64_t fx = table->value[w][d - 1];
+            uint64_t fx1 = table->next[w][d - 1];
+            fibonacciCombine(&fx, &fx1, stepValue, stepNext, modulus);
+            table->value[w][d] = fx;
+            table->next[w][d] = fx1;
+        }
+    }
+    return table;
+}
+
+void fibonacciModTableFree(FibonacciModTable* table) {
+    free(table);
+}
+
+uint64_t fibonacciModTableQuery(const FibonacciModTable* table, uint64_t n) {
+    uint64_t m = table->modulus;
+    uint64_t fx = 0, fx1 = 1 % m;
+    
+    for (int w = 0; w < FIB_WINDOW_COUNT && n; w++, n >>= FIB_WINDOW_BITS) {
+        int digit = (int)(n & (FIB_WINDOW_SIZE - 1));
+        if (digit) {
+            fibonacciCombine(&fx, &fx1, table->value[w][digit], table->next[w][digit], m);
+        }
+    }
+    return fx;
+}
+
+/**
+ * Answer count queries F(ns[i]) mod table->modulus into results
+ */
+void fibonacciModBatch(const FibonacciModTable* table, const uint64_t* ns,
+                       uint64_t* results, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        results[i] = fibonacciModTableQuery(table, ns[i]);
+    }
+}
+
+/**
+ * Position of a Fibonacci number held as a big integer, or -1.
+ * Integer-only: since φ^(k-2) <= F(k) <= φ^(k-1), the bit length B of the
+ * target pins k to within a few positions of (B - 1) * log_φ(2), so one
+ * fast-doubling evaluation plus a couple of additions decides membership.
+ */
+long long findFibonacciPositionBig(const BigInt* target) {
+    if (target->length == 0) return 0;
+    
+    size_t bits = bigIntBitLength(target);
+    // log_φ(2) = 1.44042..., rounded down so F(start) <= target
+    uint64_t start = (uint64_t)(bits - 1) * 14404 / 10000;
+    start = start >= 2 ? start - 2 : 1;
+    
+    BigInt current, next, sum;
+    bigIntInit(&current);
+    bigIntInit(&next);
+    bigIntInit(&sum);
+    fibonacciBig(start, &current);
+    fibonacciBig(start + 1, &next);
+    
+    long long position = (long long)start;
+    long long found = -1;
+    while (1) {
+        int cmp = bigIntCompare(&current, target);
+        if (cmp == 0) {
+            found = position;
+            break;
+        }
+        if (cmp > 0) break;
+        bigIntAdd(&sum, &current, &next);
+        BigInt swap = current; current = next; next = sum; sum = swap;
+        position++;
+    }
+    
+    bigIntFree(&current);
+    bigIntFree(&next);
+    bigIntFree(&sum);
+    return found;
+}
+
+int isFibonacciNumberBig(const BigInt* num) {
+    return findFibonacciPositionBig(num) != -1;
+}
+
 int main() {
     printf("=== Fibonacci Sequence - Dynamic Programming ===\n");
     
@@ -297,6 +964,96 @@ int main() {
         printf("F(%d)/F(%d) = %.6f\n", i + 1, i, ratio);
     }
     printf("Golden ratio φ = (1 + √5) / 2 ≈ 1.618034\n");
+    printf("\n");
+    
+    // Test Case 9: Exact big-integer values via fast doubling
+    printf("Test Case 9: Arbitrary-precision fast doubling\n");
+    BigInt big;
+    bigIntInit(&big);
+    fibonacciBig(90, &big);
+    char* text = bigIntToString(&big);
+    printf("F(90) = %s (64-bit: %lld)\n", text, fibonacciOptimized(90));
+    free(text);
+    
+    int bigTests[] = {100, 500};
+    for (int i = 0; i < 2; i++) {
+        fibonacciBig(bigTests[i], &big);
+        text = bigIntToString(&big);
+        printf("F(%d) = %s\n", bigTests[i], text);
+        free(text);
+    }
+    printf("\n");
+    
+    // Test Case 10: F(10^7) exactly
+    printf("Test Case 10: F(10^7) with Karatsuba/NTT multiplication\n");
+    uint64_t hugeN = 10000000;
+    clock_t start = clock();
+    fibonacciBig(hugeN, &big);
+    double elapsed = ((double)(clock() - start)) / CLOCKS_PER_SEC * 1000;
+    size_t bits = bigIntBitLength(&big);
+    printf("F(%llu): %zu bits, about %zu decimal digits (Time: %.2f ms)\n",
+           (unsigned long long)hugeN, bits, (size_t)((double)bits * 0.30103) + 1, elapsed);
+    printf("Last 9 digits: %09llu (modular check: %09llu)\n",
+           (unsigned long long)bigIntModU64(&big, 1000000000ULL),
+           (unsigned long long)fibonacciMod(hugeN, 1000000000ULL));
+    printf("\n");
+    
+    // Test Case 11: Modular fast doubling
+    printf("Test Case 11: 64-bit modular fast doubling\n");
+    uint64_t prime = 1000000007ULL;
+    printf("F(10^18) mod 1e9+7 = %llu\n",
+           (unsigned long long)fibonacciMod(1000000000000000000ULL, prime));
+    printf("F(2^64-1) mod (2^64-59) = %llu\n",
+           (unsigned long long)fibonacciMod(UINT64_MAX, 18446744073709551557ULL));
+    printf("\n");
+    
+    // Test Case 12: Batched modular queries
+    printf("Test Case 12: Batched F(n) mod m queries\n");
+    size_t queryCount = 1000000;
+    uint64_t* queries = (uint64_t*)malloc(queryCount * sizeof(uint64_t));
+    uint64_t* answers = (uint64_t*)malloc(queryCount * sizeof(uint64_t));
+    uint64_t state = 88172645463325252ULL;
+    for (size_t i = 0; i < queryCount; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        queries[i] = state;
+    }
+    
+    start = clock();
+    uint64_t checksum = 0;
+    for (size_t i = 0; i < queryCount; i++) {
+        checksum ^= fibonacciMod(queries[i], prime);
+    }
+    double singleTime = ((double)(clock() - start)) / CLOCKS_PER_SEC * 1000;
+    
+    start = clock();
+    FibonacciModTable* table = fibonacciModTableCreate(prime);
+    fibonacciModBatch(table, queries, answers, queryCount);
+    double batchTime = ((double)(clock() - start)) / CLOCKS_PER_SEC * 1000;
+    
+    uint64_t batchChecksum = 0;
+    for (size_t i = 0; i < queryCount; i++) batchChecksum ^= answers[i];
+    printf("%zu queries: one-by-one %.2f ms, batched %.2f ms, results %s\n",
+           queryCount, singleTime, batchTime, checksum == batchChecksum ? "match" : "DIFFER");
+    fibonacciModTableFree(table);
+    free(queries);
+    free(answers);
+    printf("\n");
+    
+    // Test Case 13: Membership on big integers
+    printf("Test Case 13: Big-integer Fibonacci membership\n");
+    BigInt one;
+    bigIntInit(&one);
+    bigIntSetU64(&one, 1);
+    fibonacciBig(300, &big);
+    printf("F(300) found at position %lld\n", findFibonacciPositionBig(&big));
+    bigIntAdd(&big, &big, &one);
+    printf("F(300) + 1 is Fibonacci: %s\n", isFibonacciNumberBig(&big) ? "YES" : "NO");
+    bigIntFromString(&big, "354224848179261915075");
+    printf("354224848179261915075 is F(%lld)\n", findFibonacciPositionBig(&big));
+    bigIntFree(&one);
+    bigIntFree(&big);
     
     return 0;
 }
\ No newline at end of file
@@ -3,12 +3,17 @@
 #include <stdbool.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
 
 /**
  * Backtracking Strategy: Permutation Generation
  * Core Idea: Generate all possible arrangements (permutations) of a given set of elements
  * Time Complexity: O(n! * n) where n is the number of elements
  * Space Complexity: O(n) for recursion stack and current permutation
+ *
+ * The streaming generators (Heap's algorithm, loopless SJT, rank ranges)
+ * visit permutations in place without storing them; the parallel driver
+ * uses POSIX threads (compile with -pthread).
  */
 
 #define MAX_SIZE 10
@@ -404,10 +409,260 @@ long long getCurrentTimeMillis() {
     return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000LL;
 }
 
+/* ======================================================================
+ * Zero-allocation streaming API
+ * Instead of materializing n! permutations, the generators below rewrite a
+ * single array in place and hand it to a visitor after every step. The
+ * visitor returns false to stop early.
+ * ====================================================================== */
+
+#define MAX_STREAM_SIZE 20 // 20! still fits in an unsigned 64-bit rank
+
+/**
+ * Visitor called once per permutation; perm is only valid during the call
+ */
+typedef bool (*PermutationVisitor)(const int perm[], int size, void* context);
+
+/**
+ * Heap's algorithm (iterative): every permutation after the first is
+ * produced by exactly one swap, with O(n) stack state and no heap memory.
+ * @param elements Array permuted in place (left in the final arrangement)
+ * @return Number of permutations visited
+ */
+long long forEachPermutationHeap(int elements[], int size, PermutationVisitor visit, void* context) {
+    if (size < 0 || size > MAX_STREAM_SIZE) return 0;
+    int counters[MAX_STREAM_SIZE] = {0};
+    long long visited = 1;
+    
+    if (!visit(elements, size, context)) return visited;
+    
+    int i = 1;
+    while (i < size) {
+        if (counters[i] < i) {
+            // Even i swaps with position 0, odd i with the counter position
+            swap(elements, (i & 1) ? counters[i] : 0, i);
+            visited++;
+            if (!visit(elements, size, context)) return visited;
+            counters[i]++;
+            i = 1;
+        } else {
+            counters[i] = 0;
+            i++;
+        }
+    }
+    return visited;
+}
+
+/**
+ * Loopless Steinhaus-Johnson-Trotter (Ehrlich's focus-pointer form).
+ * Each step swaps two adjacent positions and takes O(1) worst-case time,
+ * not just amortized, which keeps per-permutation latency flat.
+ * @param elements Array permuted in place
+ * @return Number of permutations visited
+ */
+long long forEachPermutationSJT(int elements[], int size, PermutationVisitor visit, void* context) {
+    if (size < 0 || size > MAX_STREAM_SIZE) return 0;
+    
+    // Labels 1..n track which original element sits where; positions are 1-based
+    int label[MAX_STREAM_SIZE + 2];
+    int position[MAX_STREAM_SIZE + 1];
+    int direction[MAX_STREAM_SIZE + 1];
+    int focus[MAX_STREAM_SIZE + 1];
+    
+    for (int i = 0; i <= size; i++) {
+        label[i] = i;
+        position[i] = i;
+        direction[i] = -1;
+        focus[i] = i;
+    }
+    label[size + 1] = size + 1;
+    
+    long long visited = 1;
+    if (!visit(elements, size, context)) return visited;
+    
+    while (1) {
+        int m = focus[size];
+        focus[size] = size;
+        if (m <= 1) break;
+        
+        // Move label m one step in its direction
+        int from = position[m];
+        int to = from + direction[m];
+        int other = label[to];
+        label[from] = other;
+        label[to] = m;
+        position[other] = from;
+        position[m] = to;
+        swap(elements, from - 1, to - 1);
+        
+        // Label m stops being mobile at an edge or in front of a larger label
+        int beyond = to + direction[m];
+        if (beyond < 1 || beyond > size || label[beyond] > m) {
+            direction[m] = -direction[m];
+            focus[m] = focus[m - 1];
+            focus[m - 1] = m - 1;
+        }
+        
+        visited++;
+        if (!visit(elements, size, context)) return visited;
+    }
+    return visited;
+}
+
+/**
+ * Lexicographic rank of a permutation of distinct values (Lehmer code)
+ * @return Index in [0, n!) of perm among all orderings of its values
+ */
+unsigned long long permutationRank(const int perm[], int size) {
+    unsigned long long rank = 0;
+    for (int i = 0; i < size; i++) {
+        int smaller = 0;
+        for (int j = i + 1; j < size; j++) {
+            if (perm[j] < perm[i]) smaller++;
+        }
+        rank = rank * (size - i) + smaller;
+    }
+    return rank;
+}
+
+/**
+ * Write the permutation of sorted distinct elements with the given
+ * lexicographic rank into perm (inverse of permutationRank)
+ */
+void permutationUnrank(unsigned long long rank, const int sortedElements[], int size, int perm[]) {
+    int pool[MAX_STREAM_SIZE];
+    memcpy(pool, sortedElements, size * sizeof(int));
+    
+    unsigned long long block = (unsigned long long)factorial(size);
+    for (int i = 0; i < size; i++) {
+        block /= (size - i);
+        int index = (int)(rank / block);
+        rank %= block;
+        
+        perm[i] = pool[index];
+        memmove(pool + index, pool + index + 1, (size - i - index - 1) * sizeof(int));
+    }
+}
+
+/**
+ * Visit the lexicographic index range [first, first + count) of the
+ * permutations of sortedElements. Unranking the start and then stepping
+ * with nextPermutation lets disjoint ranges be processed independently.
+ * @return Number of permutations visited
+ */
+long long forEachPermutationInRange(const int sortedElements[], int size,
+                                    unsigned long long first, unsigned long long count,
+                                    PermutationVisitor visit, void* context) {
+    if (size < 1 || size > MAX_STREAM_SIZE || count == 0) return 0;
+    int perm[MAX_STREAM_SIZE];
+    permutationUnrank(first, sortedElements, size, perm);
+    
+    long long visited = 0;
+    do {
+        visited++;
+        if (!visit(perm, size, context)) break;
+    } while ((unsigned long long)visited < count && nextPermutation(perm, size));
+    
+    return visited;
+}
+
+typedef struct {
+    const int* sortedElements;
+    int size;
+    unsigned long long first;
+    unsigned long long count;
+    PermutationVisitor visit;
+    void* context;
+    long long visited;
+} PermutationWorker;
+
+static void* permutationWorkerRun(void* arg) {
+    PermutationWorker* worker = (PermutationWorker*)arg;
+    worker->visited = forEachPermutationInRange(worker->sortedElements, worker->size,
+                                                worker->first, worker->count,
+                                                worker->visit, worker->context);
+    return NULL;
+}
+
+/**
+ * Apply a visitor to every permutation of distinct elements using numThreads
+ * threads, each owning one contiguous lexicographic rank range. Thread t
+ * receives threadContexts[t] so kernels can keep private accumulators and
+ * merge them afterwards; a visitor returning false stops only its own thread.
+ * @return Total number of permutations visited
+ */
+long long parallelForEachPermutation(const int elements[], int size, int numThreads,
+                                     PermutationVisitor visit, void* const threadContexts[]) {
+    if (size < 1 || size > MAX_STREAM_SIZE || numThreads < 1) return 0;
+    
+    int sorted[MAX_STREAM_SIZE];
+    memcpy(sorted, elements, size * sizeof(int));
+    qsort(sorted, size, sizeof(int), compare);
+    
+    unsigned long long total = (unsigned long long)factorial(size);
+    PermutationWorker* workers = (PermutationWorker*)malloc(numThreads * sizeof(PermutationWorker));
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    
+    unsigned long long start = 0;
+    for (int t = 0; t < numThreads; t++) {
+        unsigned long long share = total / numThreads + ((unsigned long long)t < total % numThreads);
+        workers[t] = (PermutationWorker){sorted, size, start, share, visit, threadContexts[t], 0};
+        start += share;
+        pthread_create(&threads[t], NULL, permutationWorkerRun, &workers[t]);
+    }
+    
+    long long visited = 0;
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+        visited += workers[t].visited;
+    }
+    
+    free(workers);
+    free(threads);
+    return visited;
+}
+
+/**
+ * Example kernel: total cost of a route visiting cities in permuted order,
+ * accumulated into a per-thread RouteStats
+ */
+typedef struct {
+    const int* distances; // size x size row-major matrix
+    int best;
+    long long routes;
+} RouteStats;
+
+bool routeCostKernel(const int perm[], int size, void* context) {
+    RouteStats* stats = (RouteStats*)context;
+    int cost = 0;
+    for (int i = 0; i + 1 < size; i++) {
+        cost += stats->distances[perm[i] * size + perm[i + 1]];
+    }
+    if (cost < stats->best) stats->best = cost;
+    stats->routes++;
+    return true;
+}
+
+bool countingVisitor(const int perm[], int size, void* context) {
+    (void)perm;
+    (void)size;
+    (*(long long*)context)++;
+    return true;
+}
+
+bool printingVisitor(const int perm[], int size, void* context) {
+    int* shown = (int*)context;
+    printf("  %2d: ", ++(*shown));
+    printArray((int*)perm, size);
+    printf("\n");
+    return true;
+}
+
 int main() {
     printf("=== Permutation Generation - Backtracking ===\n\n");
     
-    PermutationSet result;
+    // Over 150 MB, so it cannot live on the stack
+    static PermutationSet result;
     
     // Test Case 1: Basic permutations
     printf("Test Case 1: Basic Permutations\n");
@@ -585,6 +840,87 @@ int main() {
     printPermutations(&result, 10);
     printf("\n");
     
+    // Test Case 11: Streaming generators
+    printf("Test Case 11: Streaming generators (no buffers)\n");
+    int heapElements[] = {1, 2, 3};
+    int shown = 0;
+    printf("Heap's algorithm (one swap per step):\n");
+    forEachPermutationHeap(heapElements, 3, printingVisitor, &shown);
+    
+    int sjtElements[] = {1, 2, 3};
+    shown = 0;
+    printf("Steinhaus-Johnson-Trotter (adjacent swaps):\n");
+    forEachPermutationSJT(sjtElements, 3, printingVisitor, &shown);
+    printf("\n");
+    
+    // Test Case 12: Rank and unrank
+    printf("Test Case 12: Rank / unrank\n");
+    int sortedFive[] = {1, 2, 3, 4, 5};
+    int unranked[5];
+    unsigned long long ranks[] = {0, 1, 57, 119};
+    for (int i = 0; i < 4; i++) {
+        permutationUnrank(ranks[i], sortedFive, 5, unranked);
+        printf("Rank %3llu -> ", ranks[i]);
+        printArray(unranked, 5);
+        printf(" -> rank %llu\n", permutationRank(unranked, 5));
+    }
+    printf("\n");
+    
+    // Test Case 13: Streaming throughput
+    printf("Test Case 13: Streaming throughput (n = 11)\n");
+    int streamSize = 11;
+    int streamElements[MAX_STREAM_SIZE];
+    for (int i = 0; i < streamSize; i++) streamElements[i] = i;
+    
+    long long counted = 0;
+    startTime = getCurrentTimeMillis();
+    long long heapCount = forEachPermutationHeap(streamElements, streamSize, countingVisitor, &counted);
+    long long heapTime = getCurrentTimeMillis() - startTime;
+    
+    counted = 0;
+    startTime = getCurrentTimeMillis();
+    long long sjtCount = forEachPermutationSJT(streamElements, streamSize, countingVisitor, &counted);
+    long long sjtTime = getCurrentTimeMillis() - startTime;
+    
+    printf("Heap's: %lld permutations in %lldms\n", heapCount, heapTime);
+    printf("SJT:    %lld permutations in %lldms\n", sjtCount, sjtTime);
+    printf("\n");
+    
+    // Test Case 14: Parallel kernel over all permutations
+    printf("Test Case 14: Parallel route kernel (n = %d)\n", streamSize);
+    int* distances = (int*)malloc(streamSize * streamSize * sizeof(int));
+    for (int i = 0; i < streamSize; i++) {
+        for (int j = 0; j < streamSize; j++) {
+            distances[i * streamSize + j] = i == j ? 0 : 1 + (i * 7 + j * 13) % 29;
+        }
+    }
+    
+    for (int i = 0; i < streamSize; i++) streamElements[i] = i;
+    int threadCounts[] = {1, 4};
+    for (int c = 0; c < 2; c++) {
+        int numThreads = threadCounts[c];
+        RouteStats stats[8];
+        void* contexts[8];
+        for (int t = 0; t < numThreads; t++) {
+            stats[t] = (RouteStats){distances, 1 << 30, 0};
+            contexts[t] = &stats[t];
+        }
+        
+        startTime = getCurrentTimeMillis();
+        long long routes = parallelForEachPermutation(streamElements, streamSize, numThreads,
+                                                      routeCostKernel, contexts);
+        long long parallelTime = getCurrentTimeMillis() - startTime;
+        
+        int best = 1 << 30;
+        for (int t = 0; t < numThreads; t++) {
+            if (stats[t].best < best) best = stats[t].best;
+        }
+        printf("%d thread(s): %lld routes, best path cost %d (Time: %lldms)\n",
+               numThreads, routes, best, parallelTime);
+    }
+    free(distances);
+    printf("\n");
+    
     printf("Applications:\n");
     printf("- Traveling Salesman Problem: permutations of cities\n");
     printf("- Anagram generation: permutations of letters\n");
@@ -598,6 +934,7 @@ int main() {
     printf("- Total permutations: n! for distinct elements\n");
     printf("- With duplicates: n! / (n1! * n2! * ... * nk!)\n");
     printf("- Optimizations: Heap's algorithm, iterative generation\n");
+    printf("- Streaming: O(1) extra memory, rank ranges split work across threads\n");
     
     return 0;
 }
\ No newline at end of file
@@ -3,12 +3,19 @@
 #include <stdbool.h>
 #include <string.h>
 #include <time.h>
+#include <stdint.h>
+#include <pthread.h>
 
 /**
  * Backtracking Strategy: Subset Sum Problem
  * Core Idea: Find if there exists a subset of given numbers that sum to a target value
  * Time Complexity: O(2^n) where n is the number of elements (worst case)
  * Space Complexity: O(n) for recursion stack and subset tracking
+ *
+ * Faster engines for larger inputs (compile with -pthread):
+ * - Meet-in-the-middle: O(2^(n/2)) for n <= 60 with arbitrary values
+ * - Bitset DP: O(n * target / 64) for non-negative values and bounded targets
+ * - Parallel counting over the meet-in-the-middle lists
  */
 
 #define MAX_SIZE 20
@@ -31,6 +38,15 @@ typedef struct {
     int count;
 } SubsetCollection;
 
+bool findSubsetSumHelper(int numbers[], int size, int index, int targetSum, 
+                        int currentSum, int result[], int* resultSize);
+void findAllSubsetsHelper(int numbers[], int size, int index, int targetSum, 
+                         int currentSum, int currentSubset[], int subsetSize, 
+                         SubsetCollection* collection);
+bool meetInMiddleSubsetSum(const int numbers[], int size, long long targetSum,
+                           int result[], int* resultSize);
+bool bitsetSubsetSum(const int numbers[], int size, int targetSum, int result[], int* resultSize);
+
 /**
  * Backtracking helper function for subset sum
  * @param numbers Array of numbers
@@ -271,6 +287,318 @@ bool solveWithSteps(int numbers[], int size, int targetSum) {
     return backtrackWithSteps(numbers, size, 0, targetSum, 0, currentSubset, 0, &stepNum);
 }
 
+/* ======================================================================
+ * Meet-in-the-middle (Horowitz-Sahni)
+ * Split the input into halves, list every subset sum of each half in
+ * sorted order, then combine the two lists with a two-pointer sweep.
+ * O(2^(n/2)) time and memory instead of O(2^n), for any integer values.
+ * ====================================================================== */
+
+#define MITM_MAX_SIZE 60
+#define BITSET_MAX_TARGET (1 << 26)
+
+/**
+ * One subset sum of a half, with the bitmask of chosen elements
+ */
+typedef struct {
+    long long sum;
+    uint32_t mask;
+} HalfSum;
+
+typedef struct {
+    HalfSum* left;
+    HalfSum* right;
+    size_t leftCount;
+    size_t rightCount;
+    int leftSize;
+} MeetInMiddle;
+
+/**
+ * List all 2^count subset sums of values in ascending order. Adding element
+ * i merges the sorted list with a copy shifted by values[i], which is still
+ * sorted, so each step is a linear merge rather than a sort.
+ */
+static HalfSum* buildSortedHalfSums(const int values[], int count) {
+    size_t total = (size_t)1 << count;
+    HalfSum* list = (HalfSum*)malloc(total * sizeof(HalfSum));
+    HalfSum* scratch = (HalfSum*)malloc(total * sizeof(HalfSum));
+    if (!list || !scratch) {
+        free(list);
+        free(scratch);
+        return NULL;
+    }
+    
+    list[0] = (HalfSum){0, 0};
+    size_t length = 1;
+    
+    for (int i = 0; i < count; i++) {
+        long long value = values[i];
+        uint32_t bit = 1u << i;
+        size_t a = 0, b = 0, out = 0;
+        
+        while (a < length && b < length) {
+            long long shifted = list[b].sum + value;
+            if (list[a].sum <= shifted) {
+                scratch[out++] = list[a++];
+            } else {
+                scratch[out++] = (HalfSum){shifted, list[b].mask | bit};
+                b++;
+            }
+        }
+        while (a < length) scratch[out++] = list[a++];
+        while (b < length) {
+            scratch[out++] = (HalfSum){list[b].sum + value, list[b].mask | bit};
+            b++;
+        }
+        
+        HalfSum* temp = list;
+        list = scratch;
+        scratch = temp;
+        length *= 2;
+    }
+    
+    free(scratch);
+    return list;
+}
+
+static bool buildMeetInMiddle(MeetInMiddle* mitm, const int numbers[], int size) {
+    if (size < 0 || size > MITM_MAX_SIZE) return false;
+    mitm->leftSize = size / 2;
+    mitm->leftCount = (size_t)1 << mitm->leftSize;
+    mitm->rightCount = (size_t)1 << (size - mitm->leftSize);
+    mitm->left = buildSortedHalfSums(numbers, mitm->leftSize);
+    mitm->right = buildSortedHalfSums(numbers + mitm->leftSize, size - mitm->leftSize);
+    
+    if (!mitm->left || !mitm->right) {
+        free(mitm->left);
+        free(mitm->right);
+        return false;
+    }
+    return true;
+}
+
+static void freeMeetInMiddle(MeetInMiddle* mitm) {
+    free(mitm->left);
+    free(mitm->right);
+}
+
+/**
+ * Expand a (left, right) mask pair back into the chosen numbers
+ */
+static int decodeMeetInMiddle(const MeetInMiddle* mitm, const int numbers[], int size,
+                              uint32_t leftMask, uint32_t rightMask, int result[]) {
+    int count = 0;
+    for (int i = 0; i < mitm->leftSize; i++) {
+        if (leftMask & (1u << i)) result[count++] = numbers[i];
+    }
+    for (int i = mitm->leftSize; i < size; i++) {
+        if (rightMask & (1u << (i - mitm->leftSize))) result[count++] = numbers[i];
+    }
+    return count;
+}
+
+/**
+ * Find one subset with the target sum using meet-in-the-middle
+ * @param numbers Array of up to MITM_MAX_SIZE integers (any sign)
+ * @param result Receives the subset (capacity size), may be NULL
+ * @return true if such a subset exists
+ */
+bool meetInMiddleSubsetSum(const int numbers[], int size, long long targetSum,
+                           int result[], int* resultSize) {
+    MeetInMiddle mitm;
+    if (!buildMeetInMiddle(&mitm, numbers, size)) return false;
+    
+    // Left ascends, right descends: one linear sweep over both lists
+    size_t i = 0;
+    size_t j = mitm.rightCount;
+    bool found = false;
+    while (i < mitm.leftCount && j > 0) {
+        long long sum = mitm.left[i].sum + mitm.right[j - 1].sum;
+        if (sum == targetSum) {
+            if (result) {
+                *resultSize = decodeMeetInMiddle(&mitm, numbers, size, mitm.left[i].mask,
+                                                 mitm.right[j - 1].mask, result);
+            }
+            found = true;
+            break;
+        }
+        if (sum < targetSum) i++;
+        else j--;
+    }
+    
+    freeMeetInMiddle(&mitm);
+    return found;
+}
+
+/**
+ * Count pairs in [leftBegin, leftEnd) x right whose sums add up to target.
+ * Runs of equal left sums are multiplied by the matching run in right.
+ */
+static long long countMeetInMiddleRange(const MeetInMiddle* mitm, size_t leftBegin,
+                                        size_t leftEnd, long long targetSum) {
+    // Start right at the last entry not exceeding target - left[leftBegin]
+    long long firstNeed = targetSum - mitm->left[leftBegin].sum;
+    size_t low = 0, high = mitm->rightCount;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (mitm->right[mid].sum <= firstNeed) low = mid + 1;
+        else high = mid;
+    }
+    size_t j = low;
+    
+    long long count = 0;
+    size_t i = leftBegin;
+    while (i < leftEnd && j > 0) {
+        long long leftSum = mitm->left[i].sum;
+        size_t runEnd = i + 1;
+        while (runEnd < leftEnd && mitm->left[runEnd].sum == leftSum) runEnd++;
+        
+        long long need = targetSum - leftSum;
+        while (j > 0 && mitm->right[j - 1].sum > need) j--;
+        
+        size_t k = j;
+        while (k > 0 && mitm->right[k - 1].sum == need) k--;
+        count += (long long)(runEnd - i) * (long long)(j - k);
+        
+        i = runEnd;
+    }
+    return count;
+}
+
+/**
+ * Count all subsets with the target sum using meet-in-the-middle
+ * @return Number of subsets, or -1 if the input is too large
+ */
+long long meetInMiddleCountSubsets(const int numbers[], int size, long long targetSum) {
+    MeetInMiddle mitm;
+    if (!buildMeetInMiddle(&mitm, numbers, size)) return -1;
+    long long count = countMeetInMiddleRange(&mitm, 0, mitm.leftCount, targetSum);
+    freeMeetInMiddle(&mitm);
+    return count;
+}
+
+typedef struct {
+    const MeetInMiddle* mitm;
+    size_t leftBegin;
+    size_t leftEnd;
+    long long targetSum;
+    long long count;
+} CountWorker;
+
+static void* countWorkerRun(void* arg) {
+    CountWorker* worker = (CountWorker*)arg;
+    worker->count = worker->leftBegin < worker->leftEnd
+        ? countMeetInMiddleRange(worker->mitm, worker->leftBegin, worker->leftEnd,
+                                 worker->targetSum)
+        : 0;
+    return NULL;
+}
+
+/**
+ * Parallel counting: the sorted left list is cut into numThreads slices and
+ * each thread sweeps the shared right list independently. A run of equal
+ * left sums split across slices is still counted once per element.
+ * @return Number of subsets, or -1 if the input is too large
+ */
+long long parallelCountSubsetSums(const int numbers[], int size, long long targetSum,
+                                  int numThreads) {
+    MeetInMiddle mitm;
+    if (numThreads < 1 || !buildMeetInMiddle(&mitm, numbers, size)) return -1;
+    
+    CountWorker* workers = (CountWorker*)malloc(numThreads * sizeof(CountWorker));
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    
+    for (int t = 0; t < numThreads; t++) {
+        workers[t].mitm = &mitm;
+        workers[t].leftBegin = mitm.leftCount * t / numThreads;
+        workers[t].leftEnd = mitm.leftCount * (t + 1) / numThreads;
+        workers[t].targetSum = targetSum;
+        pthread_create(&threads[t], NULL, countWorkerRun, &workers[t]);
+    }
+    
+    long long count = 0;
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+        count += workers[t].count;
+    }
+    
+    free(workers);
+    free(threads);
+    freeMeetInMiddle(&mitm);
+    return count;
+}
+
+/* ======================================================================
+ * Bitset dynamic programming for bounded targets
+ * Bit s of the reachable set means "some subset sums to s". Adding a
+ * number x is reachable |= reachable << x, done 64 sums per word.
+ * O(n * target / 64) time, independent of how many subsets exist.
+ * ====================================================================== */
+
+static void bitsetShiftOr(uint64_t* bits, size_t words, int shift) {
+    size_t wordShift = (size_t)shift / 64;
+    int bitShift = shift % 64;
+    
+    // High to low so every source word is read before it is updated
+    for (size_t w = words; w-- > wordShift;) {
+        uint64_t shifted = bits[w - wordShift] << bitShift;
+        if (bitShift && w > wordShift) {
+            shifted |= bits[w - wordShift - 1] >> (64 - bitShift);
+        }
+        bits[w] |= shifted;
+    }
+}
+
+/**
+ * Subset sum by shift-or bitset DP
+ * @param numbers Non-negative integers (values above the target are ignored)
+ * @param targetSum Target in [0, BITSET_MAX_TARGET]
+ * @param result If non-NULL, receives one valid subset; this keeps one
+ *        bitset row per number, i.e. size * targetSum / 8 bytes
+ * @return true if some subset sums to targetSum
+ */
+bool bitsetSubsetSum(const int numbers[], int size, int targetSum, int result[], int* resultSize) {
+    if (targetSum < 0 || targetSum > BITSET_MAX_TARGET) return false;
+    
+    size_t words = (size_t)targetSum / 64 + 1;
+    bool reconstruct = result != NULL;
+    size_t rowCount = reconstruct ? (size_t)size + 1 : 1;
+    uint64_t* rows = (uint64_t*)calloc(rowCount * words, sizeof(uint64_t));
+    if (!rows) return false;
+    
+    rows[0] = 1; // the empty subset reaches 0
+    uint64_t* current = rows;
+    
+    for (int i = 0; i < size; i++) {
+        if (reconstruct) {
+            memcpy(rows + (i + 1) * words, current, words * sizeof(uint64_t));
+            current = rows + (i + 1) * words;
+        }
+        if (numbers[i] >= 0 && numbers[i] <= targetSum) {
+            bitsetShiftOr(current, words, numbers[i]);
+        }
+        if (!reconstruct && ((current[targetSum / 64] >> (targetSum % 64)) & 1)) break;
+    }
+    
+    bool found = (current[targetSum / 64] >> (targetSum % 64)) & 1;
+    
+    if (found && reconstruct) {
+        // Walk back: if the sum was unreachable before item i, item i is used
+        int remaining = targetSum;
+        *resultSize = 0;
+        for (int i = size - 1; i >= 0 && remaining > 0; i--) {
+            const uint64_t* before = rows + (size_t)i * words;
+            if (!((before[remaining / 64] >> (remaining % 64)) & 1)) {
+                result[(*resultSize)++] = numbers[i];
+                remaining -= numbers[i];
+            }
+        }
+    }
+    
+    free(rows);
+    return found;
+}
+
 /**
  * Check if array can be partitioned into two equal sum subsets
  */
@@ -285,60 +613,57 @@ bool canPartition(int numbers[], int size) {
         return false;
     }
     
+    bool nonNegative = true;
+    for (int i = 0; i < size; i++) {
+        if (numbers[i] < 0) nonNegative = false;
+    }
+    
+    // Bounded half-sum: bitset DP; otherwise meet in the middle
+    if (nonNegative && totalSum / 2 <= BITSET_MAX_TARGET) {
+        return bitsetSubsetSum(numbers, size, totalSum / 2, NULL, NULL);
+    }
+    if (size <= MITM_MAX_SIZE) {
+        return meetInMiddleSubsetSum(numbers, size, totalSum / 2, NULL, NULL);
+    }
     return hasSubsetSum(numbers, size, totalSum / 2);
 }
 
 /**
  * Find subset closest to target sum
+ * Sweeps the two sorted half-sum lists with two pointers, so the cost is
+ * O(2^(n/2)) after building the lists instead of visiting all 2^n subsets.
+ * @param numbers Array of up to MITM_MAX_SIZE integers
  */
 void findClosestSubset(int numbers[], int size, int targetSum, int result[], int* resultSize, int* bestSum) {
     *resultSize = 0;
     *bestSum = 0;
-    int bestDifference = 2147483647; // INT_MAX
-    int bestSubset[MAX_SIZE];
-    int bestSubsetSize = 0;
     
-    findClosestHelper(numbers, size, 0, targetSum, 0, numbers, 0, 
-                     &bestDifference, bestSubset, &bestSubsetSize, bestSum);
+    MeetInMiddle mitm;
+    if (!buildMeetInMiddle(&mitm, numbers, size)) return;
     
-    // Copy best result
-    for (int i = 0; i < bestSubsetSize; i++) {
-        result[i] = bestSubset[i];
-    }
-    *resultSize = bestSubsetSize;
-}
-
-/**
- * Helper method to find closest subset
- */
-void findClosestHelper(int numbers[], int size, int index, int targetSum, 
-                      int currentSum, int currentSubset[], int subsetSize, 
-                      int* bestDifference, int bestSubset[], int* bestSubsetSize, int* bestSum) {
-    // Update best if current is closer
-    int currentDifference = abs(targetSum - currentSum);
-    if (currentDifference < *bestDifference) {
-        *bestDifference = currentDifference;
-        *bestSum = currentSum;
-        *bestSubsetSize = subsetSize;
-        for (int i = 0; i < subsetSize; i++) {
-            bestSubset[i] = currentSubset[i];
-        }
-    }
+    long long bestDifference = -1;
+    uint32_t bestLeft = 0, bestRight = 0;
+    size_t i = 0;
+    size_t j = mitm.rightCount;
     
-    if (index >= size) {
-        return;
+    while (i < mitm.leftCount && j > 0) {
+        long long sum = mitm.left[i].sum + mitm.right[j - 1].sum;
+        long long difference = sum > targetSum ? sum - targetSum : targetSum - sum;
+        
+        if (bestDifference < 0 || difference < bestDifference) {
+            bestDifference = difference;
+            bestLeft = mitm.left[i].mask;
+            bestRight = mitm.right[j - 1].mask;
+            *bestSum = (int)sum;
+        }
+        
+        if (sum == targetSum) break;
+        if (sum < targetSum) i++;
+        else j--;
     }
     
-    // Include current element
-    currentSubset[subsetSize] = numbers[index];
-    findClosestHelper(numbers, size, index + 1, targetSum, 
-                     currentSum + numbers[index], currentSubset, subsetSize + 1, 
-                     bestDifference, bestSubset, bestSubsetSize, bestSum);
-    
-    // Exclude current element
-    findClosestHelper(numbers, size, index + 1, targetSum, 
-                     currentSum, currentSubset, subsetSize, 
-                     bestDifference, bestSubset, bestSubsetSize, bestSum);
+    *resultSize = decodeMeetInMiddle(&mitm, numbers, size, bestLeft, bestRight, result);
+    freeMeetInMiddle(&mitm);
 }
 
 /**
@@ -575,10 +900,89 @@ int main() {
     }
     printf("\n");
     
+    // Test Case 10: Meet-in-the-middle on 40 elements
+    printf("Test Case 10: Meet-in-the-middle (n = 40, arbitrary values)\n");
+    int numbers10[40];
+    unsigned int seed = 12345;
+    long long positiveTotal = 0;
+    for (int i = 0; i < 40; i++) {
+        seed = seed * 1103515245u + 12345u;
+        numbers10[i] = (int)((seed >> 8) % 2000001) - 1000000;
+        if (numbers10[i] > 0) positiveTotal += numbers10[i];
+    }
+    long long target10 = numbers10[3] + numbers10[17] + numbers10[22] + numbers10[39];
+    
+    int result10[40];
+    int resultSize10 = 0;
+    startTime = getCurrentTimeMillis();
+    bool found10 = meetInMiddleSubsetSum(numbers10, 40, target10, result10, &resultSize10);
+    endTime = getCurrentTimeMillis();
+    
+    long long check10 = 0;
+    for (int i = 0; i < resultSize10; i++) check10 += result10[i];
+    printf("Target %lld: %s, %d elements summing to %lld (Time: %lldms)\n",
+           target10, found10 ? "found" : "not found", resultSize10, check10, endTime - startTime);
+    printf("Brute force would visit 2^40 = %lld subsets\n\n", 1LL << 40);
+    
+    // Test Case 11: Counting, sequential vs parallel
+    printf("Test Case 11: Counting subsets (n = 36)\n");
+    int numbers11[36];
+    for (int i = 0; i < 36; i++) numbers11[i] = 1 + (i * 37) % 23;
+    long long target11 = 120;
+    
+    startTime = getCurrentTimeMillis();
+    long long count11 = meetInMiddleCountSubsets(numbers11, 36, target11);
+    long long sequentialTime = getCurrentTimeMillis() - startTime;
+    
+    startTime = getCurrentTimeMillis();
+    long long parallelCount11 = parallelCountSubsetSums(numbers11, 36, target11, 4);
+    long long parallelTime = getCurrentTimeMillis() - startTime;
+    
+    printf("Subsets summing to %lld: %lld (sequential %lldms), %lld (4 threads %lldms)\n",
+           target11, count11, sequentialTime, parallelCount11, parallelTime);
+    printf("Backtracking count on first 20 elements, target 60: %d vs meet-in-the-middle %lld\n\n",
+           countSubsetSums(numbers11, 20, 60), meetInMiddleCountSubsets(numbers11, 20, 60));
+    
+    // Test Case 12: Bitset DP
+    printf("Test Case 12: Bitset DP (n = 500, bounded target)\n");
+    int numbers12[500];
+    int total12 = 0;
+    for (int i = 0; i < 500; i++) {
+        seed = seed * 1103515245u + 12345u;
+        numbers12[i] = 1 + (int)((seed >> 8) % 5000);
+        total12 += numbers12[i];
+    }
+    int target12 = total12 / 3;
+    int* result12 = (int*)malloc(500 * sizeof(int));
+    int resultSize12 = 0;
+    
+    startTime = getCurrentTimeMillis();
+    bool found12 = bitsetSubsetSum(numbers12, 500, target12, result12, &resultSize12);
+    endTime = getCurrentTimeMillis();
+    
+    long long check12 = 0;
+    for (int i = 0; i < resultSize12; i++) check12 += result12[i];
+    printf("Target %d: %s with %d elements summing to %lld (Time: %lldms)\n",
+           target12, found12 ? "found" : "not found", resultSize12, check12, endTime - startTime);
+    printf("Equal partition possible: %s\n\n", canPartition(numbers12, 500) ? "true" : "false");
+    free(result12);
+    
+    // Test Case 13: Closest subset on 40 elements
+    printf("Test Case 13: Closest subset (n = 40)\n");
+    int closest13[40];
+    int closestSize13, closestSum13;
+    startTime = getCurrentTimeMillis();
+    findClosestSubset(numbers10, 40, 123456789, closest13, &closestSize13, &closestSum13);
+    endTime = getCurrentTimeMillis();
+    printf("Target 123456789 (above every reachable sum, max %lld): closest %d using %d elements (Time: %lldms)\n\n",
+           positiveTotal, closestSum13, closestSize13, endTime - startTime);
+    
     printf("Complexity Analysis:\n");
     printf("- Time: O(2^n) where n is number of elements (worst case)\n");
     printf("- Space: O(n) for recursion stack\n");
     printf("- Optimizations: pruning, sorting, duplicate skipping\n");
+    printf("- Meet-in-the-middle: O(2^(n/2)) time and memory for n <= %d\n", MITM_MAX_SIZE);
+    printf("- Bitset DP: O(n * target / 64) for bounded non-negative inputs\n");
     printf("- Applications: partition problem, knapsack, change making\n");
     printf("- Related: subset sum is NP-Complete problem\n");
     
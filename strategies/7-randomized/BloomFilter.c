@@ -16,6 +16,17 @@
  * - Query: O(k) where k is the number of hash functions
  * - Space: O(m) where m is the size of the bit array
  * 
+ * Also: a cuckoo filter (deletable, 16-bit fingerprints, SIMD bucket probe)
+ * and a binary fuse filter for static sets (~9 bits/key at 0.39% FP) with
+ * a multi-threaded build. performance_benchmark compares all three.
+ * Bloom filters can be saved to a versioned, checksummed file and mapped
+ * back read-only with mmap (zero-copy); union/intersection can stream
+ * over two such files.
+ * For streams of unknown size: a scalable Bloom filter that chains larger,
+ * tighter sub-filters to hold its FP target, and a HyperLogLog++ sketch
+ * (sparse mode, SIMD merge, mergeable serialization) for distinct counts.
+ * Compile with: gcc -O2 -mavx2 -pthread BloomFilter.c -lm (-mavx2 is optional)
+ * 
  * Applications:
  * - Web caching and CDNs (avoid expensive disk lookups)
  * - Database query optimization (bloom joins)
@@ -30,9 +41,49 @@
 #include <math.h>
 #include <stdbool.h>
 #include <time.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "trace.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #define MAX_HASH_FUNCTIONS 20
-#define MAX_OPERATIONS 1000
+
+// Trace events (compiled out unless built with -DTRACE_ENABLED, see trace.h)
+enum {
+    EV_BLOOM_INIT, EV_BLOOM_INIT_PARAMS, EV_BLOOM_INIT_CUSTOM, EV_BLOOM_CUSTOM_PARAMS, EV_BLOOM_ADD, EV_BLOOM_ADD_HASH, EV_BLOOM_ADDED,
+    EV_BLOOM_CHECK, EV_BLOOM_BIT_SET, EV_BLOOM_BIT_CLEAR, EV_BLOOM_ABSENT, EV_BLOOM_MAYBE,
+    EV_BLOOM_CLEARED, EV_BLOOM_UNION, EV_BLOOM_INTERSECTION, BLOOM_EVENT_COUNT
+};
+
+static const TraceEvent BLOOM_EVENTS[BLOOM_EVENT_COUNT] = {
+    [EV_BLOOM_INIT]         = { "init", "=== Bloom Filter Initialized ===" },
+    [EV_BLOOM_INIT_PARAMS]  = { "init_params", "Expected: %d elements, FP Rate: %.4f, Bits: %d, Hash Functions: %d" },
+    [EV_BLOOM_INIT_CUSTOM]  = { "init_custom", "=== Bloom Filter Initialized (Custom) ===" },
+    [EV_BLOOM_CUSTOM_PARAMS] = { "custom_params", "Bit Array Size: %d, Hash Functions: %d" },
+    [EV_BLOOM_ADD]          = { "add", "=== Adding element: %s ===" },
+    [EV_BLOOM_ADD_HASH]     = { "add_hash", "Hash function %d: %s -> bit %u" },
+    [EV_BLOOM_ADDED]        = { "added", "Element added. Total insertions: %d" },
+    [EV_BLOOM_CHECK]        = { "check", "=== Checking element: %s ===" },
+    [EV_BLOOM_BIT_SET]      = { "bit_set", "Hash function %d: %s -> bit %u (SET)" },
+    [EV_BLOOM_BIT_CLEAR]    = { "bit_clear", "Hash function %d: %s -> bit %u (NOT SET)" },
+    [EV_BLOOM_ABSENT]       = { "absent", "Result: DEFINITELY NOT in set" },
+    [EV_BLOOM_MAYBE]        = { "maybe", "Result: MIGHT be in set (all bits set)" },
+    [EV_BLOOM_CLEARED]      = { "cleared", "=== Bloom Filter Cleared ===" },
+    [EV_BLOOM_UNION]        = { "union", "=== Bloom Filter Union Created ===" },
+    [EV_BLOOM_INTERSECTION] = { "intersection", "=== Bloom Filter Intersection Created ===" },
+};
 
 typedef struct {
     int expected_elements;
@@ -49,6 +100,9 @@ typedef struct {
     int true_negatives;
     double actual_false_positive_rate;
     double fill_ratio;
+    double bits_per_key;
+    double insert_ns;         // per key; for static filters the build time per key
+    double query_ns;
 } BloomFilterStats;
 
 typedef struct {
@@ -56,10 +110,9 @@ typedef struct {
     int bit_array_size;
     int num_hash_functions;
     int insert_count;
-    bool verbose;
-    char operations[MAX_OPERATIONS][200];
-    int operation_count;
     BloomFilterConfig config;
+    void* mapping;            // set when bit_array points into a read-only file mapping
+    size_t mapping_size;
 } BloomFilter;
 
 // Hash function seeds for multiple independent hash functions
@@ -68,25 +121,6 @@ static const int HASH_SEEDS[MAX_HASH_FUNCTIONS] = {
     12289, 24593, 49157, 98317, 196613, 393241, 786433, 1572869, 3145739, 6291469
 };
 
-// Utility functions
-void add_operation(BloomFilter* filter, const char* operation) {
-    if (filter->verbose && filter->operation_count < MAX_OPERATIONS) {
-        strncpy(filter->operations[filter->operation_count], operation, 199);
-        filter->operations[filter->operation_count][199] = '\0';
-        filter->operation_count++;
-    }
-}
-
-void print_operations(const BloomFilter* filter) {
-    for (int i = 0; i < filter->operation_count; i++) {
-        printf("  %s\n", filter->operations[i]);
-    }
-}
-
-void clear_operations(BloomFilter* filter) {
-    filter->operation_count = 0;
-}
-
 // Simple hash function using djb2 algorithm with different seeds
 unsigned int hash_function(const char* str, int seed, int array_size) {
     unsigned int hash = 5381 + seed;
@@ -125,7 +159,7 @@ BloomFilterConfig calculate_optimal_parameters(int expected_elements, double fal
 }
 
 // Create a new bloom filter with optimal parameters
-BloomFilter* create_bloom_filter(int expected_elements, double false_positive_rate, bool verbose) {
+BloomFilter* create_bloom_filter(int expected_elements, double false_positive_rate) {
     BloomFilter* filter = malloc(sizeof(BloomFilter));
     
     filter->config = calculate_optimal_parameters(expected_elements, false_positive_rate);
@@ -137,23 +171,18 @@ BloomFilter* create_bloom_filter(int expected_elements, double false_positive_ra
     filter->bit_array = calloc(byte_array_size, sizeof(unsigned char));
     
     filter->insert_count = 0;
-    filter->verbose = verbose;
-    filter->operation_count = 0;
+    filter->mapping = NULL;
+    filter->mapping_size = 0;
     
-    if (verbose) {
-        add_operation(filter, "=== Bloom Filter Initialized ===");
-        char msg[200];
-        sprintf(msg, "Expected: %d elements, FP Rate: %.4f, Bits: %d, Hash Functions: %d",
-                expected_elements, false_positive_rate, 
-                filter->bit_array_size, filter->num_hash_functions);
-        add_operation(filter, msg);
-    }
+    TRACE(EV_BLOOM_INIT);
+    TRACE(EV_BLOOM_INIT_PARAMS, expected_elements, false_positive_rate,
+          filter->bit_array_size, filter->num_hash_functions);
     
     return filter;
 }
 
 // Create a bloom filter with custom parameters
-BloomFilter* create_bloom_filter_custom(int bit_array_size, int num_hash_functions, bool verbose) {
+BloomFilter* create_bloom_filter_custom(int bit_array_size, int num_hash_functions) {
     BloomFilter* filter = malloc(sizeof(BloomFilter));
     
     filter->bit_array_size = bit_array_size;
@@ -164,283 +193,2189 @@ BloomFilter* create_bloom_filter_custom(int bit_array_size, int num_hash_functio
         filter->num_hash_functions = MAX_HASH_FUNCTIONS;
     }
     
-    // Allocate bit array
-    int byte_array_size = (bit_array_size + 7) / 8;
-    filter->bit_array = calloc(byte_array_size, sizeof(unsigned char));
+    // No sizing target: record the parameters as given
+    filter->config.expected_elements = 0;
+    filter->config.false_positive_rate = 0.0;
+    filter->config.optimal_bit_array_size = bit_array_size;
+    filter->config.optimal_hash_functions = filter->num_hash_functions;
+    
+    // Allocate bit array
+    int byte_array_size = (bit_array_size + 7) / 8;
+    filter->bit_array = calloc(byte_array_size, sizeof(unsigned char));
+    
+    filter->insert_count = 0;
+    filter->mapping = NULL;
+    filter->mapping_size = 0;
+    
+    TRACE(EV_BLOOM_INIT_CUSTOM);
+    TRACE(EV_BLOOM_CUSTOM_PARAMS, bit_array_size, num_hash_functions);
+    
+    return filter;
+}
+
+// Set a bit in the bit array
+void set_bit(BloomFilter* filter, int bit_index) {
+    int byte_index = bit_index / 8;
+    int bit_offset = bit_index % 8;
+    filter->bit_array[byte_index] |= (1 << bit_offset);
+}
+
+// Get a bit from the bit array
+bool get_bit(const BloomFilter* filter, int bit_index) {
+    int byte_index = bit_index / 8;
+    int bit_offset = bit_index % 8;
+    return (filter->bit_array[byte_index] & (1 << bit_offset)) != 0;
+}
+
+// Add an element to the bloom filter
+void bloom_add(BloomFilter* filter, const char* element) {
+    if (filter->mapping) {
+        printf("Error: cannot add to a memory-mapped (read-only) bloom filter\n");
+        return;
+    }
+    TRACE_S(EV_BLOOM_ADD, element);
+    
+    for (int i = 0; i < filter->num_hash_functions; i++) {
+        unsigned int hash = hash_function(element, HASH_SEEDS[i], filter->bit_array_size);
+        set_bit(filter, hash);
+        TRACE_S(EV_BLOOM_ADD_HASH, element, i, hash);
+    }
+    
+    filter->insert_count++;
+    TRACE(EV_BLOOM_ADDED, filter->insert_count);
+}
+
+// Test if an element might be in the set
+bool bloom_might_contain(BloomFilter* filter, const char* element) {
+    TRACE_S(EV_BLOOM_CHECK, element);
+    
+    for (int i = 0; i < filter->num_hash_functions; i++) {
+        unsigned int hash = hash_function(element, HASH_SEEDS[i], filter->bit_array_size);
+        
+        if (!get_bit(filter, hash)) {
+            TRACE_S(EV_BLOOM_BIT_CLEAR, element, i, hash);
+            TRACE(EV_BLOOM_ABSENT);
+            return false; // Definitely not in the set
+        }
+        TRACE_S(EV_BLOOM_BIT_SET, element, i, hash);
+    }
+    
+    TRACE(EV_BLOOM_MAYBE);
+    return true; // Might be in the set
+}
+
+// Get the current fill ratio of the bit array
+double get_fill_ratio(const BloomFilter* filter) {
+    int set_bits = 0;
+    
+    for (int i = 0; i < filter->bit_array_size; i++) {
+        if (get_bit(filter, i)) {
+            set_bits++;
+        }
+    }
+    
+    return (double) set_bits / filter->bit_array_size;
+}
+
+// Calculate the expected false positive rate based on current state
+double get_expected_false_positive_rate(const BloomFilter* filter) {
+    double fill_ratio = get_fill_ratio(filter);
+    return pow(fill_ratio, filter->num_hash_functions);
+}
+
+// Clear all bits in the bloom filter
+void bloom_clear(BloomFilter* filter) {
+    if (filter->mapping) {
+        printf("Error: cannot clear a memory-mapped (read-only) bloom filter\n");
+        return;
+    }
+    int byte_array_size = (filter->bit_array_size + 7) / 8;
+    memset(filter->bit_array, 0, byte_array_size);
+    filter->insert_count = 0;
+    TRACE(EV_BLOOM_CLEARED);
+}
+
+typedef enum { BLOOM_OR, BLOOM_AND } BloomCombineOp;
+
+// out = a OR b / a AND b, 32 bytes per step where AVX2 is available
+static void bloom_combine_bytes(unsigned char* out, const unsigned char* a, const unsigned char* b,
+                                size_t bytes, BloomCombineOp op) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= bytes; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*) (a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*) (b + i));
+        __m256i r = op == BLOOM_OR ? _mm256_or_si256(x, y) : _mm256_and_si256(x, y);
+        _mm256_storeu_si256((__m256i*) (out + i), r);
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= bytes; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*) (a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*) (b + i));
+        __m128i r = op == BLOOM_OR ? _mm_or_si128(x, y) : _mm_and_si128(x, y);
+        _mm_storeu_si128((__m128i*) (out + i), r);
+    }
+#endif
+    for (; i < bytes; i++) {
+        out[i] = op == BLOOM_OR ? a[i] | b[i] : a[i] & b[i];
+    }
+}
+
+// Create a union of two bloom filters
+BloomFilter* bloom_union(const BloomFilter* filter1, const BloomFilter* filter2) {
+    if (filter1->bit_array_size != filter2->bit_array_size || 
+        filter1->num_hash_functions != filter2->num_hash_functions) {
+        printf("Error: Bloom filters must have same parameters for union\n");
+        return NULL;
+    }
+    
+    BloomFilter* result = create_bloom_filter_custom(filter1->bit_array_size, 
+                                                    filter1->num_hash_functions);
+    
+    int byte_array_size = (filter1->bit_array_size + 7) / 8;
+    
+    // Perform bitwise OR operation
+    bloom_combine_bytes(result->bit_array, filter1->bit_array, filter2->bit_array, byte_array_size, BLOOM_OR);
+    
+    result->insert_count = filter1->insert_count + filter2->insert_count; // Approximate
+    
+    TRACE(EV_BLOOM_UNION);
+    
+    return result;
+}
+
+// Create an intersection of two bloom filters
+BloomFilter* bloom_intersection(const BloomFilter* filter1, const BloomFilter* filter2) {
+    if (filter1->bit_array_size != filter2->bit_array_size || 
+        filter1->num_hash_functions != filter2->num_hash_functions) {
+        printf("Error: Bloom filters must have same parameters for intersection\n");
+        return NULL;
+    }
+    
+    BloomFilter* result = create_bloom_filter_custom(filter1->bit_array_size, 
+                                                    filter1->num_hash_functions);
+    
+    int byte_array_size = (filter1->bit_array_size + 7) / 8;
+    
+    // Perform bitwise AND operation
+    bloom_combine_bytes(result->bit_array, filter1->bit_array, filter2->bit_array, byte_array_size, BLOOM_AND);
+    
+    result->insert_count = (filter1->insert_count < filter2->insert_count) ? 
+                          filter1->insert_count : filter2->insert_count; // Conservative estimate
+    
+    TRACE(EV_BLOOM_INTERSECTION);
+    
+    return result;
+}
+
+// Estimate the number of elements in the bloom filter
+int estimate_element_count(const BloomFilter* filter) {
+    double fill_ratio = get_fill_ratio(filter);
+    if (fill_ratio == 0.0) return 0;
+    if (fill_ratio >= 1.0) return INT_MAX; // Overflow case
+    
+    // n ≈ -(m/k) * ln(1 - X) where X is the fraction of set bits
+    double estimate = -((double) filter->bit_array_size / filter->num_hash_functions) * log(1 - fill_ratio);
+    return (int) round(estimate);
+}
+
+// Display bloom filter structure (for small filters)
+void bloom_display(const BloomFilter* filter) {
+    if (filter->bit_array_size > 100) {
+        int set_bits = 0;
+        for (int i = 0; i < filter->bit_array_size; i++) {
+            if (get_bit(filter, i)) set_bits++;
+        }
+        
+        printf("Bloom Filter: %d bits, %d hash functions, %d/%d bits set (%.3f%% full)\n",
+               filter->bit_array_size, filter->num_hash_functions, set_bits, 
+               filter->bit_array_size, get_fill_ratio(filter) * 100);
+        return;
+    }
+    
+    printf("=== Bloom Filter Bit Array ===\n");
+    printf("Size: %d bits, Hash Functions: %d, Fill Ratio: %.3f\n", 
+           filter->bit_array_size, filter->num_hash_functions, get_fill_ratio(filter));
+    
+    // Display bit array in groups of 10
+    for (int i = 0; i < filter->bit_array_size; i++) {
+        if (i % 10 == 0) {
+            printf("\nBits %3d-%3d: ", i, (i + 9 < filter->bit_array_size) ? i + 9 : filter->bit_array_size - 1);
+        }
+        printf("%c", get_bit(filter, i) ? '1' : '0');
+    }
+    printf("\n\n");
+}
+
+// Free bloom filter memory
+void free_bloom_filter(BloomFilter* filter) {
+    if (filter) {
+        if (filter->mapping) munmap(filter->mapping, filter->mapping_size);
+        else free(filter->bit_array);
+        free(filter);
+    }
+}
+
+// Format bytes for display
+void format_bytes(int bytes, char* buffer) {
+    if (bytes < 1024) {
+        sprintf(buffer, "%d B", bytes);
+    } else if (bytes < 1024 * 1024) {
+        sprintf(buffer, "%.1f KB", bytes / 1024.0);
+    } else {
+        sprintf(buffer, "%.1f MB", bytes / (1024.0 * 1024.0));
+    }
+}
+
+// ==================== 64-bit key hashing ====================
+
+// MurmurHash64A over the string bytes. The cuckoo and binary fuse filters
+// derive every bucket, position and fingerprint from this one value.
+uint64_t hash_string64(const char* str, uint64_t seed) {
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    size_t len = strlen(str);
+    const unsigned char* p = (const unsigned char*) str;
+    uint64_t hash = seed ^ (len * m);
+    
+    while (len >= 8) {
+        uint64_t k;
+        memcpy(&k, p, 8);
+        k *= m;
+        k ^= k >> 47;
+        k *= m;
+        hash ^= k;
+        hash *= m;
+        p += 8;
+        len -= 8;
+    }
+    
+    switch (len) {
+        case 7: hash ^= (uint64_t) p[6] << 48; // fall through
+        case 6: hash ^= (uint64_t) p[5] << 40; // fall through
+        case 5: hash ^= (uint64_t) p[4] << 32; // fall through
+        case 4: hash ^= (uint64_t) p[3] << 24; // fall through
+        case 3: hash ^= (uint64_t) p[2] << 16; // fall through
+        case 2: hash ^= (uint64_t) p[1] << 8;  // fall through
+        case 1: hash ^= (uint64_t) p[0];
+                hash *= m;
+    }
+    
+    hash ^= hash >> 47;
+    hash *= m;
+    hash ^= hash >> 47;
+    return hash;
+}
+
+// Murmur3 finalizer: re-randomizes a 64-bit key under a per-filter seed
+static inline uint64_t mix64(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static inline uint64_t splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Map a 64-bit hash uniformly onto [0, range) without a division
+static inline uint64_t fast_range64(uint64_t hash, uint64_t range) {
+    return (uint64_t) (((unsigned __int128) hash * range) >> 64);
+}
+
+// Count a query answer against the ground truth
+void record_query(BloomFilterStats* stats, bool answer, bool member) {
+    stats->total_queries++;
+    if (answer && member) stats->true_positives++;
+    else if (answer) stats->false_positives++;
+    else if (!member) stats->true_negatives++;
+}
+
+void finish_stats(BloomFilterStats* stats) {
+    int negatives = stats->false_positives + stats->true_negatives;
+    stats->actual_false_positive_rate = negatives ? (double) stats->false_positives / negatives : 0.0;
+}
+
+// ==================== On-disk format ====================
+
+/**
+ * Versioned file layout, native byte order:
+ *   [BloomFileHeader, 64 bytes][bit array, (bits + 7) / 8 bytes]
+ * The bit array starts on a cache-line boundary, so a read-only mmap of the
+ * file is used as the filter directly: no copy, and every process mapping
+ * the same file shares its page-cache pages.
+ */
+#define BLOOM_FILE_MAGIC "BLOOMFLT"
+#define BLOOM_FORMAT_VERSION 1
+#define BLOOM_HASH_VERSION 1          // hash_function() with HASH_SEEDS
+#define BLOOM_ENDIAN_TAG 0x01020304u
+#define BLOOM_STREAM_CHUNK (1 << 20)  // bytes per step when streaming file set operations
+
+typedef struct {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t hash_version;
+    uint64_t bit_array_size;
+    uint32_t num_hash_functions;
+    uint32_t endian_tag;
+    uint64_t insert_count;
+    uint64_t expected_elements;
+    double false_positive_rate;
+    uint64_t checksum;                // of the bit array, see checksum_final
+} BloomFileHeader;
+
+_Static_assert(sizeof(BloomFileHeader) == 64, "bit array must start on a cache line");
+
+// XXH64-style checksum: four independent lanes keep up with memory bandwidth
+#define CHECKSUM_P1 0x9E3779B185EBCA87ULL
+#define CHECKSUM_P2 0xC2B2AE3D27D4EB4FULL
+
+typedef struct {
+    uint64_t lanes[4];
+    uint64_t length;
+} BloomChecksum;
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static void checksum_init(BloomChecksum* sum) {
+    sum->lanes[0] = CHECKSUM_P1 + CHECKSUM_P2;
+    sum->lanes[1] = CHECKSUM_P2;
+    sum->lanes[2] = 0;
+    sum->lanes[3] = -CHECKSUM_P1;
+    sum->length = 0;
+}
+
+// Absorb all whole 32-byte blocks; returns how many bytes were consumed
+static size_t checksum_update(BloomChecksum* sum, const unsigned char* data, size_t length) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        for (int lane = 0; lane < 4; lane++) {
+            uint64_t word;
+            memcpy(&word, data + i + 8 * lane, 8);
+            sum->lanes[lane] = rotl64(sum->lanes[lane] + word * CHECKSUM_P2, 31) * CHECKSUM_P1;
+        }
+    }
+    sum->length += i;
+    return i;
+}
+
+static uint64_t checksum_final(const BloomChecksum* sum, const unsigned char* tail, size_t tail_length) {
+    uint64_t hash = rotl64(sum->lanes[0], 1) + rotl64(sum->lanes[1], 7) +
+                    rotl64(sum->lanes[2], 12) + rotl64(sum->lanes[3], 18);
+    for (size_t i = 0; i < tail_length; i++) {
+        hash = rotl64(hash ^ (tail[i] * CHECKSUM_P1), 11) * CHECKSUM_P2;
+    }
+    return mix64(hash ^ (sum->length + tail_length));
+}
+
+static uint64_t checksum_bytes(const unsigned char* data, size_t length) {
+    BloomChecksum sum;
+    checksum_init(&sum);
+    size_t done = checksum_update(&sum, data, length);
+    return checksum_final(&sum, data + done, length - done);
+}
+
+static void bloom_init_header(BloomFileHeader* header, uint64_t bit_array_size, int num_hash_functions,
+                              uint64_t insert_count, const BloomFilterConfig* config) {
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, BLOOM_FILE_MAGIC, sizeof(header->magic));
+    header->format_version = BLOOM_FORMAT_VERSION;
+    header->hash_version = BLOOM_HASH_VERSION;
+    header->bit_array_size = bit_array_size;
+    header->num_hash_functions = (uint32_t) num_hash_functions;
+    header->endian_tag = BLOOM_ENDIAN_TAG;
+    header->insert_count = insert_count;
+    header->expected_elements = (uint64_t) config->expected_elements;
+    header->false_positive_rate = config->false_positive_rate;
+}
+
+// Write to "<path>.tmp" and rename, so readers never map a half-written file
+static FILE* open_temporary(const char* path, char* temp_path, size_t size) {
+    snprintf(temp_path, size, "%s.tmp", path);
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) printf("Error: cannot create %s: %s\n", temp_path, strerror(errno));
+    return file;
+}
+
+static bool commit_temporary(FILE* file, const char* temp_path, const char* path) {
+    bool ok = fflush(file) == 0 && fsync(fileno(file)) == 0;
+    ok = fclose(file) == 0 && ok;
+    if (ok && rename(temp_path, path) == 0) return true;
+    printf("Error: cannot write %s: %s\n", path, strerror(errno));
+    remove(temp_path);
+    return false;
+}
+
+/**
+ * Serialize a bloom filter (header + bit array)
+ * @return true on success
+ */
+bool bloom_save(const BloomFilter* filter, const char* path) {
+    size_t bytes = ((size_t) filter->bit_array_size + 7) / 8;
+    BloomFileHeader header;
+    bloom_init_header(&header, filter->bit_array_size, filter->num_hash_functions,
+                      filter->insert_count, &filter->config);
+    header.checksum = checksum_bytes(filter->bit_array, bytes);
+    
+    char temp_path[4096];
+    FILE* file = open_temporary(path, temp_path, sizeof(temp_path));
+    if (!file) return false;
+    if (fwrite(&header, sizeof(header), 1, file) != 1 || fwrite(filter->bit_array, 1, bytes, file) != bytes) {
+        printf("Error: short write to %s\n", temp_path);
+        fclose(file);
+        remove(temp_path);
+        return false;
+    }
+    return commit_temporary(file, temp_path, path);
+}
+
+/**
+ * Map a saved filter read-only. Queries run directly on the mapping; the
+ * filter must not be modified (bloom_add/bloom_clear refuse).
+ * @param verify_checksum Read the whole bit array once to check integrity
+ * @return The mapped filter, or NULL if the file is missing or invalid
+ */
+BloomFilter* bloom_map_file(const char* path, bool verify_checksum) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Error: cannot open %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+    
+    struct stat info;
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && (size_t) info.st_size >= sizeof(BloomFileHeader)) {
+        mapping = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);   // the mapping keeps the file alive
+    if (mapping == MAP_FAILED) {
+        printf("Error: cannot map %s\n", path);
+        return NULL;
+    }
+    
+    const BloomFileHeader* header = mapping;
+    const unsigned char* bits = (const unsigned char*) mapping + sizeof(BloomFileHeader);
+    size_t bytes = (header->bit_array_size + 7) / 8;
+    const char* problem = NULL;
+    if (memcmp(header->magic, BLOOM_FILE_MAGIC, sizeof(header->magic)) != 0) problem = "not a bloom filter file";
+    else if (header->endian_tag != BLOOM_ENDIAN_TAG) problem = "written with a different byte order";
+    else if (header->format_version != BLOOM_FORMAT_VERSION) problem = "unsupported format version";
+    else if (header->hash_version != BLOOM_HASH_VERSION) problem = "built with a different hash function";
+    else if (header->bit_array_size == 0 || header->bit_array_size > INT_MAX ||
+             header->num_hash_functions < 1 || header->num_hash_functions > MAX_HASH_FUNCTIONS) problem = "bad parameters";
+    else if ((size_t) info.st_size != sizeof(BloomFileHeader) + bytes) problem = "truncated or oversized";
+    else if (verify_checksum && checksum_bytes(bits, bytes) != header->checksum) problem = "checksum mismatch";
+    if (problem) {
+        printf("Error: %s: %s\n", path, problem);
+        munmap(mapping, info.st_size);
+        return NULL;
+    }
+    
+    madvise(mapping, info.st_size, MADV_RANDOM);   // queries touch one line per hash
+    
+    BloomFilter* filter = malloc(sizeof(BloomFilter));
+    filter->bit_array = (unsigned char*) bits;
+    filter->bit_array_size = (int) header->bit_array_size;
+    filter->num_hash_functions = (int) header->num_hash_functions;
+    filter->insert_count = (int) header->insert_count;
+    filter->config.expected_elements = (int) header->expected_elements;
+    filter->config.false_positive_rate = header->false_positive_rate;
+    filter->config.optimal_bit_array_size = filter->bit_array_size;
+    filter->config.optimal_hash_functions = filter->num_hash_functions;
+    filter->mapping = mapping;
+    filter->mapping_size = info.st_size;
+    return filter;
+}
+
+/**
+ * Stream a set operation over two saved filters into a new file. Inputs are
+ * mapped and read sequentially one chunk at a time, so neither is ever
+ * copied into memory; their checksums are verified on the way through.
+ */
+static bool bloom_combine_files(const char* path1, const char* path2, const char* out_path,
+                                BloomCombineOp op) {
+    BloomFilter* filter1 = bloom_map_file(path1, false);
+    BloomFilter* filter2 = filter1 ? bloom_map_file(path2, false) : NULL;
+    if (!filter1 || !filter2) {
+        free_bloom_filter(filter1);
+        return false;
+    }
+    if (filter1->bit_array_size != filter2->bit_array_size ||
+        filter1->num_hash_functions != filter2->num_hash_functions) {
+        printf("Error: Bloom filters must have same parameters for %s\n", op == BLOOM_OR ? "union" : "intersection");
+        free_bloom_filter(filter1);
+        free_bloom_filter(filter2);
+        return false;
+    }
+    madvise(filter1->mapping, filter1->mapping_size, MADV_SEQUENTIAL);
+    madvise(filter2->mapping, filter2->mapping_size, MADV_SEQUENTIAL);
+    
+    int inserts = op == BLOOM_OR ? filter1->insert_count + filter2->insert_count
+                                 : (filter1->insert_count < filter2->insert_count ? filter1->insert_count
+                                                                                   : filter2->insert_count);
+    BloomFileHeader header;
+    bloom_init_header(&header, filter1->bit_array_size, filter1->num_hash_functions, inserts, &filter1->config);
+    
+    char temp_path[4096];
+    FILE* file = open_temporary(out_path, temp_path, sizeof(temp_path));
+    unsigned char* chunk = malloc(BLOOM_STREAM_CHUNK);
+    bool ok = file && chunk && fwrite(&header, sizeof(header), 1, file) == 1;
+    
+    BloomChecksum sum1, sum2, sum_out;
+    checksum_init(&sum1);
+    checksum_init(&sum2);
+    checksum_init(&sum_out);
+    size_t bytes = ((size_t) filter1->bit_array_size + 7) / 8;
+    const unsigned char* a = filter1->bit_array;
+    const unsigned char* b = filter2->bit_array;
+    
+    // Chunks are whole 32-byte checksum blocks except for the last one's tail
+    size_t tail = bytes % 32;
+    const unsigned char* out_tail = chunk;
+    for (size_t offset = 0; ok && offset < bytes; offset += BLOOM_STREAM_CHUNK) {
+        size_t length = bytes - offset < BLOOM_STREAM_CHUNK ? bytes - offset : BLOOM_STREAM_CHUNK;
+        bloom_combine_bytes(chunk, a + offset, b + offset, length, op);
+        checksum_update(&sum1, a + offset, length);
+        checksum_update(&sum2, b + offset, length);
+        checksum_update(&sum_out, chunk, length);
+        out_tail = chunk + length - tail;
+        ok = fwrite(chunk, 1, length, file) == length;
+    }
+    
+    if (ok) {
+        const BloomFileHeader* header1 = filter1->mapping;
+        const BloomFileHeader* header2 = filter2->mapping;
+        const char* corrupt = NULL;
+        if (checksum_final(&sum1, a + bytes - tail, tail) != header1->checksum) corrupt = path1;
+        else if (checksum_final(&sum2, b + bytes - tail, tail) != header2->checksum) corrupt = path2;
+        if (corrupt) {
+            printf("Error: %s: checksum mismatch\n", corrupt);
+            ok = false;
+        }
+        header.checksum = checksum_final(&sum_out, out_tail, tail);
+    }
+    ok = ok && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+    
+    free(chunk);
+    free_bloom_filter(filter1);
+    free_bloom_filter(filter2);
+    if (file && ok) return commit_temporary(file, temp_path, out_path);
+    if (file) {
+        fclose(file);
+        remove(temp_path);
+    }
+    return false;
+}
+
+bool bloom_union_files(const char* path1, const char* path2, const char* out_path) {
+    return bloom_combine_files(path1, path2, out_path, BLOOM_OR);
+}
+
+bool bloom_intersection_files(const char* path1, const char* path2, const char* out_path) {
+    return bloom_combine_files(path1, path2, out_path, BLOOM_AND);
+}
+
+// ==================== Cuckoo Filter ====================
+
+/**
+ * Cuckoo filter (Fan et al.): buckets of four 16-bit fingerprints, two
+ * candidate buckets per key. Unlike the Bloom filter it supports deletion,
+ * and at ~95% load costs about 16.8 bits/key for a ~0.012% FP rate.
+ *
+ * The alternate bucket is (h(fp) - i) mod m, an involution for any bucket
+ * count m, so the table is sized to the load factor rather than rounded up
+ * to a power of two. Fingerprint 0 marks an empty slot.
+ */
+#define CUCKOO_BUCKET_SIZE 4
+#define CUCKOO_MAX_KICKS 500
+#define CUCKOO_TARGET_LOAD 0.95
+#define CUCKOO_SEED 0x2545f4914f6cdd1dULL
+
+typedef struct {
+    uint16_t* slots;          // bucket_count x CUCKOO_BUCKET_SIZE fingerprints
+    uint64_t bucket_count;
+    uint64_t count;
+    uint64_t rng;             // picks the slot to evict while relocating
+    bool has_victim;          // a fingerprint that found no home: the filter is full
+    uint16_t victim_fingerprint;
+    uint64_t victim_index;
+} CuckooFilter;
+
+CuckooFilter* create_cuckoo_filter(uint64_t expected_elements) {
+    CuckooFilter* filter = malloc(sizeof(CuckooFilter));
+    
+    filter->bucket_count = (uint64_t) ceil(expected_elements / (CUCKOO_BUCKET_SIZE * CUCKOO_TARGET_LOAD));
+    if (filter->bucket_count < 2) filter->bucket_count = 2;
+    
+    // 8-byte buckets: one aligned load covers a whole bucket
+    size_t bytes = filter->bucket_count * CUCKOO_BUCKET_SIZE * sizeof(uint16_t);
+    filter->slots = aligned_alloc(64, (bytes + 63) & ~(size_t) 63);
+    if (!filter->slots) {
+        printf("Error: cannot allocate %zu bytes for cuckoo filter\n", bytes);
+        free(filter);
+        return NULL;
+    }
+    memset(filter->slots, 0, bytes);
+    
+    filter->count = 0;
+    filter->rng = CUCKOO_SEED;
+    filter->has_victim = false;
+    filter->victim_fingerprint = 0;
+    filter->victim_index = 0;
+    return filter;
+}
+
+static inline uint16_t cuckoo_fingerprint(uint64_t hash) {
+    uint16_t fingerprint = (uint16_t) hash;   // low bits; the bucket comes from the high bits
+    return fingerprint ? fingerprint : 1;
+}
+
+static inline uint64_t cuckoo_alt_index(const CuckooFilter* filter, uint64_t index, uint16_t fingerprint) {
+    uint64_t pivot = fast_range64(mix64(fingerprint), filter->bucket_count);
+    return pivot >= index ? pivot - index : pivot + filter->bucket_count - index;
+}
+
+static inline uint64_t cuckoo_load_bucket(const CuckooFilter* filter, uint64_t index) {
+    uint64_t bucket;
+    memcpy(&bucket, filter->slots + index * CUCKOO_BUCKET_SIZE, sizeof(bucket));
+    return bucket;
+}
+
+// Compare the fingerprint against all 8 slots of both buckets at once
+static inline bool cuckoo_buckets_contain(const CuckooFilter* filter, uint64_t i1, uint64_t i2,
+                                          uint16_t fingerprint) {
+#ifdef __SSE2__
+    __m128i both = _mm_set_epi64x((long long) cuckoo_load_bucket(filter, i2),
+                                  (long long) cuckoo_load_bucket(filter, i1));
+    __m128i hits = _mm_cmpeq_epi16(both, _mm_set1_epi16((short) fingerprint));
+    return _mm_movemask_epi8(hits) != 0;
+#else
+    const uint64_t ones = 0x0001000100010001ULL, highs = 0x8000800080008000ULL;
+    uint64_t a = cuckoo_load_bucket(filter, i1) ^ (fingerprint * ones);
+    uint64_t b = cuckoo_load_bucket(filter, i2) ^ (fingerprint * ones);
+    return (((a - ones) & ~a) | ((b - ones) & ~b)) & highs;
+#endif
+}
+
+static bool cuckoo_bucket_put(CuckooFilter* filter, uint64_t index, uint16_t fingerprint) {
+    uint16_t* bucket = filter->slots + index * CUCKOO_BUCKET_SIZE;
+    for (int s = 0; s < CUCKOO_BUCKET_SIZE; s++) {
+        if (bucket[s] == 0) {
+            bucket[s] = fingerprint;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool cuckoo_bucket_remove(CuckooFilter* filter, uint64_t index, uint16_t fingerprint) {
+    uint16_t* bucket = filter->slots + index * CUCKOO_BUCKET_SIZE;
+    for (int s = 0; s < CUCKOO_BUCKET_SIZE; s++) {
+        if (bucket[s] == fingerprint) {
+            bucket[s] = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Store a fingerprint whose two buckets are full by evicting residents
+static void cuckoo_relocate(CuckooFilter* filter, uint64_t index, uint16_t fingerprint) {
+    for (int kick = 0; kick < CUCKOO_MAX_KICKS; kick++) {
+        filter->rng ^= filter->rng << 13;
+        filter->rng ^= filter->rng >> 7;
+        filter->rng ^= filter->rng << 17;
+        
+        uint16_t* slot = filter->slots + index * CUCKOO_BUCKET_SIZE + (filter->rng & (CUCKOO_BUCKET_SIZE - 1));
+        uint16_t evicted = *slot;
+        *slot = fingerprint;
+        fingerprint = evicted;
+        
+        index = cuckoo_alt_index(filter, index, fingerprint);
+        if (cuckoo_bucket_put(filter, index, fingerprint)) return;
+    }
+    
+    // Keep the homeless fingerprint so no inserted key is ever lost
+    filter->has_victim = true;
+    filter->victim_fingerprint = fingerprint;
+    filter->victim_index = index;
+}
+
+/**
+ * Add an element to the cuckoo filter
+ * @return false if the filter is full (the element is not stored)
+ */
+bool cuckoo_insert(CuckooFilter* filter, const char* element) {
+    if (filter->has_victim) return false;
+    
+    uint64_t hash = hash_string64(element, CUCKOO_SEED);
+    uint16_t fingerprint = cuckoo_fingerprint(hash);
+    uint64_t i1 = fast_range64(hash, filter->bucket_count);
+    uint64_t i2 = cuckoo_alt_index(filter, i1, fingerprint);
+    
+    filter->count++;
+    if (cuckoo_bucket_put(filter, i1, fingerprint) || cuckoo_bucket_put(filter, i2, fingerprint)) {
+        return true;
+    }
+    cuckoo_relocate(filter, (filter->rng & 1) ? i1 : i2, fingerprint);
+    return true;
+}
+
+bool cuckoo_might_contain(const CuckooFilter* filter, const char* element) {
+    uint64_t hash = hash_string64(element, CUCKOO_SEED);
+    uint16_t fingerprint = cuckoo_fingerprint(hash);
+    uint64_t i1 = fast_range64(hash, filter->bucket_count);
+    uint64_t i2 = cuckoo_alt_index(filter, i1, fingerprint);
+    
+    if (filter->has_victim && filter->victim_fingerprint == fingerprint &&
+        (filter->victim_index == i1 || filter->victim_index == i2)) {
+        return true;
+    }
+    return cuckoo_buckets_contain(filter, i1, i2, fingerprint);
+}
+
+/**
+ * Remove an element. Only delete elements that were inserted: deleting a
+ * never-inserted key that shares a fingerprint would evict another key.
+ * @return true if a matching fingerprint was removed
+ */
+bool cuckoo_delete(CuckooFilter* filter, const char* element) {
+    uint64_t hash = hash_string64(element, CUCKOO_SEED);
+    uint16_t fingerprint = cuckoo_fingerprint(hash);
+    uint64_t i1 = fast_range64(hash, filter->bucket_count);
+    uint64_t i2 = cuckoo_alt_index(filter, i1, fingerprint);
+    
+    if (cuckoo_bucket_remove(filter, i1, fingerprint) || cuckoo_bucket_remove(filter, i2, fingerprint)) {
+        filter->count--;
+        
+        // A slot opened up: give the stashed victim another chance
+        if (filter->has_victim) {
+            uint64_t v1 = filter->victim_index;
+            uint16_t victim = filter->victim_fingerprint;
+            filter->has_victim = false;
+            if (!cuckoo_bucket_put(filter, v1, victim) &&
+                !cuckoo_bucket_put(filter, cuckoo_alt_index(filter, v1, victim), victim)) {
+                cuckoo_relocate(filter, v1, victim);
+            }
+        }
+        return true;
+    }
+    
+    if (filter->has_victim && filter->victim_fingerprint == fingerprint &&
+        (filter->victim_index == i1 || filter->victim_index == i2)) {
+        filter->has_victim = false;
+        filter->count--;
+        return true;
+    }
+    return false;
+}
+
+size_t cuckoo_size_bytes(const CuckooFilter* filter) {
+    return filter->bucket_count * CUCKOO_BUCKET_SIZE * sizeof(uint16_t);
+}
+
+double cuckoo_load_factor(const CuckooFilter* filter) {
+    return (double) filter->count / (filter->bucket_count * CUCKOO_BUCKET_SIZE);
+}
+
+void free_cuckoo_filter(CuckooFilter* filter) {
+    if (filter) {
+        free(filter->slots);
+        free(filter);
+    }
+}
+
+// ==================== Binary Fuse Filter ====================
+
+/**
+ * Binary fuse filter (Graf & Lemire, 2022) for static key sets: 8-bit
+ * fingerprints in an array of ~1.125 n slots, so about 9 bits/key for a
+ * 1/256 (0.39%) FP rate. A key is present iff the XOR of its three slots
+ * equals its fingerprint; the three slots fall in consecutive segments,
+ * which keeps construction cache-friendly.
+ *
+ * Large sets are split by the top hash bits into shards of at most
+ * FUSE_SHARD_KEYS keys. Shards are built independently (in parallel when
+ * threads > 1) and each shard's scratch space stays cache-sized. The shard
+ * layout depends only on the key count, so the filter is identical for any
+ * thread count.
+ */
+#define FUSE_ARITY 3
+#define FUSE_MAX_ATTEMPTS 100
+#define FUSE_MAX_SEGMENT_LENGTH 262144
+#define FUSE_SHARD_KEYS (1 << 22)
+#define FUSE_KEY_SEED 0x9e3779b97f4a7c15ULL
+
+typedef struct {
+    uint64_t seed;
+    uint32_t segment_length;
+    uint32_t segment_length_mask;
+    uint32_t segment_count;
+    uint32_t segment_count_length;
+    uint32_t array_length;
+    uint8_t* fingerprints;
+} FuseShard;
+
+typedef struct {
+    int shard_bits;
+    int shard_count;
+    uint64_t key_count;
+    FuseShard* shards;
+} BinaryFuseFilter;
+
+static inline uint8_t fuse_fingerprint(uint64_t hash) {
+    return (uint8_t) (hash ^ (hash >> 32));
+}
+
+static inline void fuse_positions(const FuseShard* shard, uint64_t hash, uint32_t positions[3]) {
+    uint32_t h0 = (uint32_t) fast_range64(hash, shard->segment_count_length);
+    positions[0] = h0;
+    positions[1] = (h0 + shard->segment_length) ^ (uint32_t) ((hash >> 18) & shard->segment_length_mask);
+    positions[2] = (h0 + 2 * shard->segment_length) ^ (uint32_t) (hash & shard->segment_length_mask);
+}
+
+// Size the segments for a shard of `size` keys (parameters from the paper)
+static bool fuse_shard_init(FuseShard* shard, uint32_t size) {
+    uint32_t segment_length = size == 0 ? 4 : 1u << (int) floor(log((double) size) / log(3.33) + 2.25);
+    if (segment_length > FUSE_MAX_SEGMENT_LENGTH) segment_length = FUSE_MAX_SEGMENT_LENGTH;
+    
+    double size_factor = size <= 1 ? 0.0 : fmax(1.125, 0.875 + 0.25 * log(1000000.0) / log((double) size));
+    uint64_t capacity = size <= 1 ? 0 : (uint64_t) round(size * size_factor);
+    int64_t segment_count = (int64_t) ((capacity + segment_length - 1) / segment_length) - (FUSE_ARITY - 1);
+    if (segment_count < 1) segment_count = 1;
+    
+    shard->seed = 0;
+    shard->segment_length = segment_length;
+    shard->segment_length_mask = segment_length - 1;
+    shard->segment_count = (uint32_t) segment_count;
+    shard->segment_count_length = (uint32_t) segment_count * segment_length;
+    shard->array_length = (uint32_t) (segment_count + FUSE_ARITY - 1) * segment_length;
+    shard->fingerprints = calloc(shard->array_length, sizeof(uint8_t));
+    return shard->fingerprints != NULL;
+}
+
+static int compare_uint64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*) a, y = *(const uint64_t*) b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t sort_and_dedupe(uint64_t* keys, uint32_t size) {
+    if (size == 0) return 0;
+    qsort(keys, size, sizeof(uint64_t), compare_uint64);
+    uint32_t unique = 1;
+    for (uint32_t i = 1; i < size; i++) {
+        if (keys[i] != keys[unique - 1]) keys[unique++] = keys[i];
+    }
+    return unique;
+}
+
+/**
+ * Build one shard from its 64-bit keys by hypergraph peeling: repeatedly
+ * take a slot touched by exactly one remaining key, assign that key to it,
+ * and remove the key; then fill fingerprints in reverse peel order.
+ * Keys may be reordered (duplicates are removed in place).
+ */
+static bool fuse_build_shard(FuseShard* shard, uint64_t* keys, uint32_t size, uint64_t seed_state) {
+    if (!fuse_shard_init(shard, size)) return false;
+    
+    uint32_t capacity = shard->array_length;
+    uint64_t* reverse_order = calloc((size_t) size + 1, sizeof(uint64_t));
+    uint8_t* reverse_h = malloc((size_t) size + 1);
+    uint32_t* alone = malloc((size_t) capacity * sizeof(uint32_t));
+    uint8_t* t2count = calloc(capacity, sizeof(uint8_t));     // (keys << 2) | XOR of slot roles
+    uint64_t* t2hash = calloc(capacity, sizeof(uint64_t));    // XOR of key hashes
+    int block_bits = 1;
+    while ((1u << block_bits) < shard->segment_count) block_bits++;
+    uint32_t block = 1u << block_bits;
+    uint32_t* start_pos = malloc(block * sizeof(uint32_t));
+    
+    bool built = false;
+    uint32_t stack_size = 0;
+    uint64_t rng = seed_state;
+    
+    for (int attempt = 0; attempt < FUSE_MAX_ATTEMPTS && reverse_order && reverse_h && alone &&
+                          t2count && t2hash && start_pos; attempt++) {
+        shard->seed = splitmix64(&rng);
+        memset(reverse_order, 0, ((size_t) size + 1) * sizeof(uint64_t));
+        memset(t2count, 0, capacity);
+        memset(t2hash, 0, (size_t) capacity * sizeof(uint64_t));
+        reverse_order[size] = 1;   // sentinel for the bucket scan below
+        
+        // Bucket the hashes by segment block so the counting pass walks memory in order
+        for (uint32_t i = 0; i < block; i++) start_pos[i] = (uint32_t) (((uint64_t) i * size) >> block_bits);
+        for (uint32_t i = 0; i < size; i++) {
+            uint64_t hash = mix64(keys[i] + shard->seed);
+            uint64_t segment = hash >> (64 - block_bits);
+            while (reverse_order[start_pos[segment]] != 0) segment = (segment + 1) & (block - 1);
+            reverse_order[start_pos[segment]++] = hash;
+        }
+        
+        bool overflow = false;
+        uint32_t duplicates = 0;
+        uint32_t h[5];
+        for (uint32_t i = 0; i < size; i++) {
+            uint64_t hash = reverse_order[i];
+            fuse_positions(shard, hash, h);
+            t2count[h[0]] += 4;
+            t2hash[h[0]] ^= hash;
+            t2count[h[1]] += 4;
+            t2count[h[1]] ^= 1;
+            t2hash[h[1]] ^= hash;
+            t2count[h[2]] += 4;
+            t2count[h[2]] ^= 2;
+            t2hash[h[2]] ^= hash;
+            
+            // The same key twice cancels itself out of t2hash: undo the second copy
+            if ((t2hash[h[0]] & t2hash[h[1]] & t2hash[h[2]]) == 0 &&
+                ((t2hash[h[0]] == 0 && t2count[h[0]] == 8) ||
+                 (t2hash[h[1]] == 0 && t2count[h[1]] == 8) ||
+                 (t2hash[h[2]] == 0 && t2count[h[2]] == 8))) {
+                duplicates++;
+                t2count[h[0]] -= 4;
+                t2hash[h[0]] ^= hash;
+                t2count[h[1]] -= 4;
+                t2count[h[1]] ^= 1;
+                t2hash[h[1]] ^= hash;
+                t2count[h[2]] -= 4;
+                t2count[h[2]] ^= 2;
+                t2hash[h[2]] ^= hash;
+            }
+            overflow |= t2count[h[0]] < 4 || t2count[h[1]] < 4 || t2count[h[2]] < 4;
+        }
+        if (overflow) continue;   // more than 63 keys on one slot: reseed
+        
+        uint32_t queue_size = 0;
+        for (uint32_t i = 0; i < capacity; i++) {
+            alone[queue_size] = i;
+            queue_size += (t2count[i] >> 2) == 1;
+        }
+        
+        stack_size = 0;
+        while (queue_size > 0) {
+            uint32_t index = alone[--queue_size];
+            if ((t2count[index] >> 2) != 1) continue;
+            
+            uint64_t hash = t2hash[index];
+            uint8_t found = t2count[index] & 3;
+            fuse_positions(shard, hash, h);
+            h[3] = h[0];
+            h[4] = h[1];
+            reverse_h[stack_size] = found;
+            reverse_order[stack_size] = hash;
+            stack_size++;
+            
+            for (int other = 1; other <= 2; other++) {
+                uint32_t slot = h[found + other];
+                alone[queue_size] = slot;
+                queue_size += (t2count[slot] >> 2) == 2;
+                t2count[slot] -= 4;
+                t2count[slot] ^= (found + other) % 3;
+                t2hash[slot] ^= hash;
+            }
+        }
+        
+        if (stack_size + duplicates == size) {
+            built = true;
+            break;
+        }
+        if (duplicates > 0) size = sort_and_dedupe(keys, size);
+    }
+    
+    if (built) {
+        uint32_t h[5];
+        for (uint32_t i = stack_size; i-- > 0;) {
+            uint64_t hash = reverse_order[i];
+            uint8_t found = reverse_h[i];
+            fuse_positions(shard, hash, h);
+            h[3] = h[0];
+            h[4] = h[1];
+            shard->fingerprints[h[found]] = fuse_fingerprint(hash) ^
+                shard->fingerprints[h[found + 1]] ^ shard->fingerprints[h[found + 2]];
+        }
+    }
+    
+    free(reverse_order);
+    free(reverse_h);
+    free(alone);
+    free(t2count);
+    free(t2hash);
+    free(start_pos);
+    return built;
+}
+
+typedef struct {
+    const char* const* keys;
+    uint64_t begin, end;
+    int shard_bits;
+    uint64_t* cursors;        // this thread's per-shard counts, then write positions
+    uint64_t* hashed_keys;    // shared output, grouped by shard
+} FuseHashTask;
+
+static inline uint64_t fuse_shard_of(uint64_t key, int shard_bits) {
+    return shard_bits ? key >> (64 - shard_bits) : 0;
+}
+
+static void* fuse_count_worker(void* arg) {
+    FuseHashTask* task = arg;
+    for (uint64_t i = task->begin; i < task->end; i++) {
+        task->cursors[fuse_shard_of(hash_string64(task->keys[i], FUSE_KEY_SEED), task->shard_bits)]++;
+    }
+    return NULL;
+}
+
+// Rehashing beats keeping a second n-sized array: peak memory stays at 8 bytes/key
+static void* fuse_scatter_worker(void* arg) {
+    FuseHashTask* task = arg;
+    for (uint64_t i = task->begin; i < task->end; i++) {
+        uint64_t key = hash_string64(task->keys[i], FUSE_KEY_SEED);
+        task->hashed_keys[task->cursors[fuse_shard_of(key, task->shard_bits)]++] = key;
+    }
+    return NULL;
+}
+
+typedef struct {
+    BinaryFuseFilter* filter;
+    uint64_t* hashed_keys;
+    const uint64_t* shard_offsets;    // shard s owns hashed_keys[offsets[s] .. offsets[s + 1])
+    _Atomic int next_shard;
+    _Atomic bool failed;
+} FuseBuildTask;
+
+static void* fuse_build_worker(void* arg) {
+    FuseBuildTask* task = arg;
+    int s;
+    while ((s = atomic_fetch_add(&task->next_shard, 1)) < task->filter->shard_count) {
+        uint64_t begin = task->shard_offsets[s];
+        uint32_t size = (uint32_t) (task->shard_offsets[s + 1] - begin);
+        if (!fuse_build_shard(&task->filter->shards[s], task->hashed_keys + begin, size,
+                              FUSE_KEY_SEED ^ ((uint64_t) s * 0xbf58476d1ce4e5b9ULL))) {
+            atomic_store(&task->failed, true);
+        }
+    }
+    return NULL;
+}
+
+static void run_workers(void* (*worker)(void*), void* tasks, size_t task_size, int threads) {
+    if (threads == 1) {
+        worker(tasks);
+        return;
+    }
+    pthread_t* ids = malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) pthread_create(&ids[t], NULL, worker, (char*) tasks + t * task_size);
+    for (int t = 0; t < threads; t++) pthread_join(ids[t], NULL);
+    free(ids);
+}
+
+void free_binary_fuse_filter(BinaryFuseFilter* filter) {
+    if (filter) {
+        for (int s = 0; s < filter->shard_count; s++) free(filter->shards[s].fingerprints);
+        free(filter->shards);
+        free(filter);
+    }
+}
+
+/**
+ * Build a binary fuse filter over a static set of strings
+ * @param threads Worker threads for hashing and shard construction
+ * @return The filter, or NULL if memory ran out or construction failed
+ */
+BinaryFuseFilter* create_binary_fuse_filter(const char* const* keys, uint64_t count, int threads) {
+    if (threads < 1) threads = 1;
+    if ((uint64_t) threads > count / 65536 + 1) threads = (int) (count / 65536 + 1);
+    
+    BinaryFuseFilter* filter = malloc(sizeof(BinaryFuseFilter));
+    filter->key_count = count;
+    filter->shard_bits = 0;
+    while ((count >> filter->shard_bits) > FUSE_SHARD_KEYS) filter->shard_bits++;
+    filter->shard_count = 1 << filter->shard_bits;
+    filter->shards = calloc(filter->shard_count, sizeof(FuseShard));
+    
+    uint64_t* hashed_keys = malloc((count ? count : 1) * sizeof(uint64_t));
+    uint64_t* shard_offsets = calloc(filter->shard_count + 1, sizeof(uint64_t));
+    uint64_t* cursors = calloc((size_t) threads * filter->shard_count, sizeof(uint64_t));
+    FuseHashTask* hash_tasks = malloc(threads * sizeof(FuseHashTask));
+    if (!filter->shards || !hashed_keys || !shard_offsets || !cursors || !hash_tasks) {
+        printf("Error: out of memory building binary fuse filter for %llu keys\n", (unsigned long long) count);
+        free(filter->shards);
+        free(filter);
+        free(hashed_keys);
+        free(shard_offsets);
+        free(cursors);
+        free(hash_tasks);
+        return NULL;
+    }
+    
+    // Pass 1: per-thread shard histograms; pass 2: each thread scatters its
+    // range into its own precomputed slice of every shard (no atomics needed)
+    for (int t = 0; t < threads; t++) {
+        hash_tasks[t].keys = keys;
+        hash_tasks[t].begin = count * t / threads;
+        hash_tasks[t].end = count * (t + 1) / threads;
+        hash_tasks[t].shard_bits = filter->shard_bits;
+        hash_tasks[t].cursors = cursors + (size_t) t * filter->shard_count;
+        hash_tasks[t].hashed_keys = hashed_keys;
+    }
+    run_workers(fuse_count_worker, hash_tasks, sizeof(FuseHashTask), threads);
+    
+    uint64_t position = 0;
+    for (int s = 0; s < filter->shard_count; s++) {
+        shard_offsets[s] = position;
+        for (int t = 0; t < threads; t++) {
+            uint64_t shard_keys = hash_tasks[t].cursors[s];
+            hash_tasks[t].cursors[s] = position;
+            position += shard_keys;
+        }
+    }
+    shard_offsets[filter->shard_count] = position;
+    run_workers(fuse_scatter_worker, hash_tasks, sizeof(FuseHashTask), threads);
+    free(hash_tasks);
+    free(cursors);
+    
+    // Shards are handed out dynamically; all workers share one task
+    FuseBuildTask build = { filter, hashed_keys, shard_offsets, 0, false };
+    pthread_t* ids = malloc(threads * sizeof(pthread_t));
+    for (int t = 1; t < threads; t++) pthread_create(&ids[t], NULL, fuse_build_worker, &build);
+    fuse_build_worker(&build);
+    for (int t = 1; t < threads; t++) pthread_join(ids[t], NULL);
+    free(ids);
+    
+    free(hashed_keys);
+    free(shard_offsets);
+    
+    if (atomic_load(&build.failed)) {
+        printf("Error: binary fuse construction failed\n");
+        free_binary_fuse_filter(filter);
+        return NULL;
+    }
+    return filter;
+}
+
+bool binary_fuse_might_contain(const BinaryFuseFilter* filter, const char* element) {
+    uint64_t key = hash_string64(element, FUSE_KEY_SEED);
+    const FuseShard* shard = &filter->shards[fuse_shard_of(key, filter->shard_bits)];
+    uint64_t hash = mix64(key + shard->seed);
+    uint32_t h[3];
+    fuse_positions(shard, hash, h);
+    uint8_t fingerprint = fuse_fingerprint(hash) ^ shard->fingerprints[h[0]] ^
+                          shard->fingerprints[h[1]] ^ shard->fingerprints[h[2]];
+    return fingerprint == 0;
+}
+
+size_t binary_fuse_size_bytes(const BinaryFuseFilter* filter) {
+    size_t bytes = 0;
+    for (int s = 0; s < filter->shard_count; s++) bytes += filter->shards[s].array_length;
+    return bytes;
+}
+
+// ==================== Scalable Bloom Filter ====================
+
+/**
+ * Scalable Bloom filter (Almeida et al., 2007) for streams of unknown size.
+ * When the current sub-filter reaches its capacity a new one is chained on,
+ * SCALABLE_GROWTH times larger, with its FP rate tightened by
+ * SCALABLE_TIGHTENING. The compounded FP rate then stays below
+ * p0 / (1 - r) = target for any number of insertions.
+ *
+ * One 64-bit hash per element feeds every sub-filter through double
+ * hashing (h1 + i * h2), instead of k string hashes per sub-filter.
+ */
+#define SCALABLE_GROWTH 2
+#define SCALABLE_TIGHTENING 0.85
+#define SCALABLE_SEED 0x6a09e667f3bcc909ULL
+
+typedef struct {
+    BloomFilter** filters;
+    int filter_count;
+    int filter_slots;
+    int initial_capacity;
+    double target_false_positive_rate;
+    long long insert_count;       // distinct-looking insertions (repeats are skipped)
+} ScalableBloomFilter;
+
+static void bloom_add_hashed(BloomFilter* filter, uint64_t h1, uint64_t h2) {
+    for (int i = 0; i < filter->num_hash_functions; i++) {
+        set_bit(filter, (int) fast_range64(h1 + i * h2, filter->bit_array_size));
+    }
+    filter->insert_count++;
+}
+
+static bool bloom_contains_hashed(const BloomFilter* filter, uint64_t h1, uint64_t h2) {
+    for (int i = 0; i < filter->num_hash_functions; i++) {
+        if (!get_bit(filter, (int) fast_range64(h1 + i * h2, filter->bit_array_size))) return false;
+    }
+    return true;
+}
+
+// Chain on the next, larger and tighter sub-filter
+static bool scalable_bloom_grow(ScalableBloomFilter* scalable) {
+    int level = scalable->filter_count;
+    double rate = scalable->target_false_positive_rate * (1 - SCALABLE_TIGHTENING) * pow(SCALABLE_TIGHTENING, level);
+    double capacity = scalable->initial_capacity * pow(SCALABLE_GROWTH, level);
+    
+    // Stop growing once a sub-filter would outgrow the int-sized bit array
+    while (capacity > scalable->initial_capacity &&
+           -(capacity * log(rate)) / pow(log(2), 2) > INT_MAX / 2) {
+        capacity /= SCALABLE_GROWTH;
+    }
+    
+    if (scalable->filter_count == scalable->filter_slots) {
+        int slots = scalable->filter_slots ? scalable->filter_slots * 2 : 8;
+        BloomFilter** filters = realloc(scalable->filters, slots * sizeof(BloomFilter*));
+        if (!filters) return false;
+        scalable->filters = filters;
+        scalable->filter_slots = slots;
+    }
+    
+    BloomFilter* filter = create_bloom_filter((int) capacity, rate);
+    if (!filter->bit_array) {
+        printf("Error: cannot allocate scalable bloom sub-filter %d\n", level);
+        free(filter);
+        return false;
+    }
+    scalable->filters[scalable->filter_count++] = filter;
+    return true;
+}
+
+ScalableBloomFilter* create_scalable_bloom_filter(int initial_capacity, double target_false_positive_rate) {
+    ScalableBloomFilter* scalable = malloc(sizeof(ScalableBloomFilter));
+    scalable->filters = NULL;
+    scalable->filter_count = 0;
+    scalable->filter_slots = 0;
+    scalable->initial_capacity = initial_capacity > 0 ? initial_capacity : 1;
+    scalable->target_false_positive_rate = target_false_positive_rate;
+    scalable->insert_count = 0;
+    
+    if (!scalable_bloom_grow(scalable)) {
+        free(scalable->filters);
+        free(scalable);
+        return NULL;
+    }
+    return scalable;
+}
+
+bool scalable_bloom_might_contain(const ScalableBloomFilter* scalable, const char* element) {
+    uint64_t h1 = hash_string64(element, SCALABLE_SEED);
+    uint64_t h2 = mix64(h1) | 1;
+    
+    // Newest first: it is the largest and holds the most recent keys
+    for (int f = scalable->filter_count - 1; f >= 0; f--) {
+        if (bloom_contains_hashed(scalable->filters[f], h1, h2)) return true;
+    }
+    return false;
+}
+
+/**
+ * Add an element. Elements that already test positive are not re-added, so
+ * repeats in a stream do not use up sub-filter capacity.
+ * @return false if a new sub-filter was needed but could not be allocated
+ */
+bool scalable_bloom_add(ScalableBloomFilter* scalable, const char* element) {
+    uint64_t h1 = hash_string64(element, SCALABLE_SEED);
+    uint64_t h2 = mix64(h1) | 1;
+    
+    for (int f = scalable->filter_count - 1; f >= 0; f--) {
+        if (bloom_contains_hashed(scalable->filters[f], h1, h2)) return true;
+    }
+    
+    BloomFilter* current = scalable->filters[scalable->filter_count - 1];
+    if (current->insert_count >= current->config.expected_elements) {
+        if (!scalable_bloom_grow(scalable)) return false;
+        current = scalable->filters[scalable->filter_count - 1];
+    }
+    bloom_add_hashed(current, h1, h2);
+    scalable->insert_count++;
+    return true;
+}
+
+// Compounded FP rate from the sub-filters' actual fill: 1 - prod(1 - fill^k)
+double scalable_bloom_expected_false_positive_rate(const ScalableBloomFilter* scalable) {
+    double pass = 1.0;
+    for (int f = 0; f < scalable->filter_count; f++) {
+        pass *= 1.0 - get_expected_false_positive_rate(scalable->filters[f]);
+    }
+    return 1.0 - pass;
+}
+
+size_t scalable_bloom_size_bytes(const ScalableBloomFilter* scalable) {
+    size_t bytes = 0;
+    for (int f = 0; f < scalable->filter_count; f++) {
+        bytes += ((size_t) scalable->filters[f]->bit_array_size + 7) / 8;
+    }
+    return bytes;
+}
+
+void free_scalable_bloom_filter(ScalableBloomFilter* scalable) {
+    if (scalable) {
+        for (int f = 0; f < scalable->filter_count; f++) free_bloom_filter(scalable->filters[f]);
+        free(scalable->filters);
+        free(scalable);
+    }
+}
+
+// ==================== HyperLogLog ====================
+
+/**
+ * HyperLogLog++ distinct counter (Heule et al., 2013).
+ * - Sparse mode: while few registers are set, the sketch stores sorted
+ *   (index, rank) entries at precision HLL_SPARSE_PRECISION (2^25
+ *   virtual registers, near-exact small counts). It switches to dense
+ *   once the entries would outgrow the dense array.
+ * - Dense mode: 2^p one-byte registers. Merging is a byte-wise max,
+ *   32 registers per AVX2 instruction.
+ * - The estimate uses Ertl's improved estimator (2017). It is accurate
+ *   over the whole range without HLL++'s empirical bias tables.
+ * - Serialized dense sketches pack registers into 6 bits. At the default
+ *   p = 11 that is 1.5 KB per stream (about 2.3% standard error).
+ */
+#define HLL_DEFAULT_PRECISION 11
+#define HLL_MIN_PRECISION 4
+#define HLL_MAX_PRECISION 18
+#define HLL_SPARSE_PRECISION 25
+#define HLL_PENDING_CAPACITY 128
+#define HLL_SEED 0xbb67ae8584caa73bULL
+#define HLL_FORMAT_VERSION 1
+
+typedef struct {
+    int precision;             // p: 2^p dense registers
+    bool sparse;
+    uint8_t* registers;        // dense mode
+    uint32_t* sparse_list;     // sparse mode: sorted, one entry per sparse index
+    int sparse_count;
+    int sparse_slots;
+    uint32_t pending[HLL_PENDING_CAPACITY];   // unsorted sparse entries not yet merged
+    int pending_count;
+} HyperLogLog;
+
+HyperLogLog* create_hyperloglog(int precision) {
+    if (precision < HLL_MIN_PRECISION || precision > HLL_MAX_PRECISION) {
+        printf("Error: HyperLogLog precision must be in [%d, %d]\n", HLL_MIN_PRECISION, HLL_MAX_PRECISION);
+        return NULL;
+    }
+    HyperLogLog* hll = calloc(1, sizeof(HyperLogLog));
+    hll->precision = precision;
+    hll->sparse = true;
+    return hll;
+}
+
+void free_hyperloglog(HyperLogLog* hll) {
+    if (hll) {
+        free(hll->registers);
+        free(hll->sparse_list);
+        free(hll);
+    }
+}
+
+// Sparse entry: idx' << 7 | rank << 1 | 1 when the bits between p and p' are
+// all zero (the rank must come from the tail), else idx' << 1
+static inline uint32_t hll_encode_sparse(uint64_t hash, int precision) {
+    uint32_t index = (uint32_t) (hash >> (64 - HLL_SPARSE_PRECISION));
+    uint32_t between_mask = (1u << (HLL_SPARSE_PRECISION - precision)) - 1;
+    if ((index & between_mask) != 0) return index << 1;
+    uint64_t tail = hash << HLL_SPARSE_PRECISION;
+    int rank = tail ? __builtin_clzll(tail) + 1 : 64 - HLL_SPARSE_PRECISION + 1;
+    return index << 7 | (uint32_t) rank << 1 | 1;
+}
+
+static inline uint32_t hll_sparse_index(uint32_t entry) {
+    return entry & 1 ? entry >> 7 : entry >> 1;
+}
+
+// Whether an entry could have come from hll_encode_sparse; untrusted lists
+// are checked with this before anything decodes them
+static bool hll_sparse_entry_valid(uint32_t entry, int precision) {
+    if (entry & 1) {
+        int rank = (entry >> 1) & 63;
+        return rank >= 1 && rank <= 64 - HLL_SPARSE_PRECISION + 1;   // index fits by construction
+    }
+    uint32_t between_mask = (1u << (HLL_SPARSE_PRECISION - precision)) - 1;
+    return entry < 1u << (HLL_SPARSE_PRECISION + 1) && (entry >> 1 & between_mask) != 0;
+}
+
+// Dense register index and rank for a sparse entry
+static inline void hll_decode_sparse(uint32_t entry, int precision, uint32_t* index, uint8_t* rank) {
+    int extra = HLL_SPARSE_PRECISION - precision;
+    uint32_t sparse_index = hll_sparse_index(entry);
+    *index = sparse_index >> extra;
+    if (entry & 1) {
+        *rank = (uint8_t) (((entry >> 1) & 63) + extra);
+    } else {
+        uint32_t between = sparse_index & ((1u << extra) - 1);
+        *rank = (uint8_t) (__builtin_clz(between) - (32 - extra) + 1);
+    }
+}
+
+static inline void hll_update_dense(uint8_t* registers, int precision, uint64_t hash) {
+    uint32_t index = (uint32_t) (hash >> (64 - precision));
+    uint64_t tail = (hash << precision) | (1ULL << (precision - 1));   // caps rank at 64 - p + 1
+    uint8_t rank = (uint8_t) (__builtin_clzll(tail) + 1);
+    if (rank > registers[index]) registers[index] = rank;
+}
+
+static bool hll_to_dense(HyperLogLog* hll);
+
+static int compare_uint32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*) a, y = *(const uint32_t*) b;
+    return (x > y) - (x < y);
+}
+
+// Merge sorted entries into the sparse list, keeping the highest entry per index
+static bool hll_merge_sparse(HyperLogLog* hll, const uint32_t* entries, int count) {
+    int total = hll->sparse_count + count;
+    if (total > hll->sparse_slots) {
+        int slots = hll->sparse_slots ? hll->sparse_slots : 16;
+        while (slots < total) slots *= 2;
+        uint32_t* list = realloc(hll->sparse_list, slots * sizeof(uint32_t));
+        if (!list) return false;
+        hll->sparse_list = list;
+        hll->sparse_slots = slots;
+    }
+    
+    // Merge from the back so the list can be updated in place
+    int i = hll->sparse_count - 1, j = count - 1, out = total - 1;
+    while (j >= 0) {
+        if (i >= 0 && hll->sparse_list[i] > entries[j]) hll->sparse_list[out--] = hll->sparse_list[i--];
+        else hll->sparse_list[out--] = entries[j--];
+    }
     
-    filter->insert_count = 0;
-    filter->verbose = verbose;
-    filter->operation_count = 0;
+    // Same index sorts adjacent with the higher rank last
+    int unique = 0;
+    for (int k = 0; k < total; k++) {
+        if (unique > 0 && hll_sparse_index(hll->sparse_list[unique - 1]) == hll_sparse_index(hll->sparse_list[k])) {
+            hll->sparse_list[unique - 1] = hll->sparse_list[k];
+        } else {
+            hll->sparse_list[unique++] = hll->sparse_list[k];
+        }
+    }
+    hll->sparse_count = unique;
     
-    if (verbose) {
-        add_operation(filter, "=== Bloom Filter Initialized (Custom) ===");
-        char msg[200];
-        sprintf(msg, "Bit Array Size: %d, Hash Functions: %d", bit_array_size, num_hash_functions);
-        add_operation(filter, msg);
+    // Past this size the dense array is smaller
+    if ((size_t) hll->sparse_count * sizeof(uint32_t) > ((size_t) 1 << hll->precision)) return hll_to_dense(hll);
+    return true;
+}
+
+static bool hll_flush_pending(HyperLogLog* hll) {
+    if (hll->pending_count == 0) return true;
+    qsort(hll->pending, hll->pending_count, sizeof(uint32_t), compare_uint32);
+    int count = hll->pending_count;
+    hll->pending_count = 0;
+    return hll_merge_sparse(hll, hll->pending, count);
+}
+
+static bool hll_to_dense(HyperLogLog* hll) {
+    uint8_t* registers = calloc((size_t) 1 << hll->precision, sizeof(uint8_t));
+    if (!registers) return false;
+    
+    uint32_t index;
+    uint8_t rank;
+    for (int i = 0; i < hll->sparse_count; i++) {
+        hll_decode_sparse(hll->sparse_list[i], hll->precision, &index, &rank);
+        if (rank > registers[index]) registers[index] = rank;
+    }
+    for (int i = 0; i < hll->pending_count; i++) {
+        hll_decode_sparse(hll->pending[i], hll->precision, &index, &rank);
+        if (rank > registers[index]) registers[index] = rank;
     }
     
-    return filter;
+    free(hll->sparse_list);
+    hll->sparse_list = NULL;
+    hll->sparse_count = hll->sparse_slots = hll->pending_count = 0;
+    hll->registers = registers;
+    hll->sparse = false;
+    return true;
 }
 
-// Set a bit in the bit array
-void set_bit(BloomFilter* filter, int bit_index) {
-    int byte_index = bit_index / 8;
-    int bit_offset = bit_index % 8;
-    filter->bit_array[byte_index] |= (1 << bit_offset);
+void hll_add_hash(HyperLogLog* hll, uint64_t hash) {
+    if (!hll->sparse) {
+        hll_update_dense(hll->registers, hll->precision, hash);
+        return;
+    }
+    hll->pending[hll->pending_count++] = hll_encode_sparse(hash, hll->precision);
+    if (hll->pending_count == HLL_PENDING_CAPACITY) hll_flush_pending(hll);
 }
 
-// Get a bit from the bit array
-bool get_bit(const BloomFilter* filter, int bit_index) {
-    int byte_index = bit_index / 8;
-    int bit_offset = bit_index % 8;
-    return (filter->bit_array[byte_index] & (1 << bit_offset)) != 0;
+void hll_add(HyperLogLog* hll, const char* element) {
+    hll_add_hash(hll, hash_string64(element, HLL_SEED));
 }
 
-// Add an element to the bloom filter
-void bloom_add(BloomFilter* filter, const char* element) {
-    if (filter->verbose) {
-        char msg[200];
-        sprintf(msg, "=== Adding element: %s ===", element);
-        add_operation(filter, msg);
+// Ertl's sigma and tau series for the improved raw estimator
+static double hll_sigma(double x) {
+    if (x == 1.0) return INFINITY;
+    double y = 1.0, z = x, previous;
+    do {
+        x *= x;
+        previous = z;
+        z += x * y;
+        y += y;
+    } while (z != previous);
+    return z;
+}
+
+static double hll_tau(double x) {
+    if (x == 0.0 || x == 1.0) return 0.0;
+    double y = 1.0, z = 1.0 - x, previous;
+    do {
+        x = sqrt(x);
+        previous = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous);
+    return z / 3.0;
+}
+
+// Estimate from a histogram of register values over m registers of q+1 max rank
+static double hll_estimate_histogram(const int* histogram, int q, double m) {
+    double z = m * hll_tau(1.0 - histogram[q + 1] / m);
+    for (int k = q; k >= 1; k--) {
+        z = 0.5 * (z + histogram[k]);
     }
-    
-    for (int i = 0; i < filter->num_hash_functions; i++) {
-        unsigned int hash = hash_function(element, HASH_SEEDS[i], filter->bit_array_size);
-        set_bit(filter, hash);
-        
-        if (filter->verbose) {
-            char msg[200];
-            sprintf(msg, "Hash function %d: %s -> bit %u", i, element, hash);
-            add_operation(filter, msg);
-        }
+    z += m * hll_sigma(histogram[0] / m);
+    return m * m / (2.0 * log(2.0) * z);
+}
+
+double hll_count(HyperLogLog* hll) {
+    if (hll->sparse) {
+        hll_flush_pending(hll);
+    }
+    if (hll->sparse) {
+        // Linear counting over the 2^25 sparse indices: exact enough until dense takes over
+        double m = (double) (1 << HLL_SPARSE_PRECISION);
+        return m * log(m / (m - hll->sparse_count));
     }
     
-    filter->insert_count++;
-    
-    if (filter->verbose) {
-        char msg[200];
-        sprintf(msg, "Element added. Total insertions: %d", filter->insert_count);
-        add_operation(filter, msg);
+    int m = 1 << hll->precision;
+    int q = 64 - hll->precision;
+    int histogram[64] = {0};
+    for (int i = 0; i < m; i++) histogram[hll->registers[i]]++;
+    return hll_estimate_histogram(histogram, q, m);
+}
+
+// Byte-wise register max: 32 registers per instruction with AVX2
+static void hll_max_registers(uint8_t* destination, const uint8_t* source, size_t count) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= count; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*) (destination + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*) (source + i));
+        _mm256_storeu_si256((__m256i*) (destination + i), _mm256_max_epu8(a, b));
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= count; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i*) (destination + i));
+        __m128i b = _mm_loadu_si128((const __m128i*) (source + i));
+        _mm_storeu_si128((__m128i*) (destination + i), _mm_max_epu8(a, b));
+    }
+#endif
+    for (; i < count; i++) {
+        if (source[i] > destination[i]) destination[i] = source[i];
     }
 }
 
-// Test if an element might be in the set
-bool bloom_might_contain(BloomFilter* filter, const char* element) {
-    if (filter->verbose) {
-        char msg[200];
-        sprintf(msg, "=== Checking element: %s ===", element);
-        add_operation(filter, msg);
+/**
+ * Merge source into destination (union of the two streams).
+ * Both sketches must use the same precision.
+ */
+bool hll_merge(HyperLogLog* destination, HyperLogLog* source) {
+    if (destination->precision != source->precision) {
+        printf("Error: cannot merge HyperLogLog sketches of precision %d and %d\n",
+               destination->precision, source->precision);
+        return false;
     }
+    if (source->sparse && !hll_flush_pending(source)) return false;
     
-    for (int i = 0; i < filter->num_hash_functions; i++) {
-        unsigned int hash = hash_function(element, HASH_SEEDS[i], filter->bit_array_size);
-        
-        if (!get_bit(filter, hash)) {
-            if (filter->verbose) {
-                char msg[200];
-                sprintf(msg, "Hash function %d: %s -> bit %u (NOT SET)", i, element, hash);
-                add_operation(filter, msg);
-                add_operation(filter, "Result: DEFINITELY NOT in set");
-            }
-            return false; // Definitely not in the set
+    if (source->sparse) {
+        if (destination->sparse) {
+            if (!hll_flush_pending(destination)) return false;
+            if (destination->sparse) return hll_merge_sparse(destination, source->sparse_list, source->sparse_count);
         }
-        
-        if (filter->verbose) {
-            char msg[200];
-            sprintf(msg, "Hash function %d: %s -> bit %u (SET)", i, element, hash);
-            add_operation(filter, msg);
+        uint32_t index;
+        uint8_t rank;
+        for (int i = 0; i < source->sparse_count; i++) {
+            hll_decode_sparse(source->sparse_list[i], destination->precision, &index, &rank);
+            if (rank > destination->registers[index]) destination->registers[index] = rank;
         }
+        return true;
     }
     
-    if (filter->verbose) {
-        add_operation(filter, "Result: MIGHT be in set (all bits set)");
+    if (destination->sparse && !hll_to_dense(destination)) return false;
+    hll_max_registers(destination->registers, source->registers, (size_t) 1 << destination->precision);
+    return true;
+}
+
+/**
+ * Serialized layout (little-endian):
+ *   "HLL" magic, format version, precision, encoding (0 sparse, 1 dense),
+ *   2 reserved bytes, uint32 entry count (sparse only)
+ *   sparse: sorted entries, delta-encoded as LEB128 varints
+ *   dense:  2^p registers packed into 6 bits each
+ */
+#define HLL_HEADER_SIZE 12
+
+static size_t hll_packed_size(int precision) {
+    return (((size_t) 6 << precision) + 7) / 8;
+}
+
+size_t hll_serialized_size(HyperLogLog* hll) {
+    if (!hll->sparse) return HLL_HEADER_SIZE + hll_packed_size(hll->precision);
+    hll_flush_pending(hll);
+    if (!hll->sparse) return HLL_HEADER_SIZE + hll_packed_size(hll->precision);
+    
+    size_t size = HLL_HEADER_SIZE;
+    uint32_t previous = 0;
+    for (int i = 0; i < hll->sparse_count; i++) {
+        uint32_t delta = hll->sparse_list[i] - previous;
+        previous = hll->sparse_list[i];
+        do {
+            size++;
+            delta >>= 7;
+        } while (delta);
     }
     
-    return true; // Might be in the set
+    // Never ship more than the packed dense form would take
+    if (size > HLL_HEADER_SIZE + hll_packed_size(hll->precision) && hll_to_dense(hll)) {
+        return HLL_HEADER_SIZE + hll_packed_size(hll->precision);
+    }
+    return size;
 }
 
-// Get the current fill ratio of the bit array
-double get_fill_ratio(const BloomFilter* filter) {
-    int set_bits = 0;
-    
-    for (int i = 0; i < filter->bit_array_size; i++) {
-        if (get_bit(filter, i)) {
-            set_bits++;
+/**
+ * Write the sketch into buffer.
+ * @return bytes written, or 0 if capacity is smaller than hll_serialized_size
+ */
+size_t hll_serialize(HyperLogLog* hll, uint8_t* buffer, size_t capacity) {
+    size_t size = hll_serialized_size(hll);
+    if (capacity < size) return 0;
+    
+    memcpy(buffer, "HLL", 3);
+    buffer[3] = HLL_FORMAT_VERSION;
+    buffer[4] = (uint8_t) hll->precision;
+    buffer[5] = hll->sparse ? 0 : 1;
+    buffer[6] = buffer[7] = 0;
+    uint32_t count = hll->sparse ? (uint32_t) hll->sparse_count : 0;
+    for (int b = 0; b < 4; b++) buffer[8 + b] = (uint8_t) (count >> (8 * b));
+    
+    uint8_t* out = buffer + HLL_HEADER_SIZE;
+    if (hll->sparse) {
+        uint32_t previous = 0;
+        for (int i = 0; i < hll->sparse_count; i++) {
+            uint32_t delta = hll->sparse_list[i] - previous;
+            previous = hll->sparse_list[i];
+            while (delta >= 0x80) {
+                *out++ = (uint8_t) (delta | 0x80);
+                delta >>= 7;
+            }
+            *out++ = (uint8_t) delta;
+        }
+    } else {
+        uint32_t bits = 0;
+        int pending_bits = 0;
+        for (int i = 0; i < 1 << hll->precision; i++) {
+            bits |= (uint32_t) hll->registers[i] << pending_bits;
+            pending_bits += 6;
+            while (pending_bits >= 8) {
+                *out++ = (uint8_t) bits;
+                bits >>= 8;
+                pending_bits -= 8;
+            }
+        }
+        if (pending_bits > 0) *out++ = (uint8_t) bits;
+    }
+    return size;
+}
+
+HyperLogLog* hll_deserialize(const uint8_t* buffer, size_t size) {
+    if (size < HLL_HEADER_SIZE || memcmp(buffer, "HLL", 3) != 0) {
+        printf("Error: not a serialized HyperLogLog sketch\n");
+        return NULL;
+    }
+    if (buffer[3] != HLL_FORMAT_VERSION) {
+        printf("Error: unsupported HyperLogLog format version %d\n", buffer[3]);
+        return NULL;
+    }
+    HyperLogLog* hll = create_hyperloglog(buffer[4]);
+    if (!hll) return NULL;
+    
+    const uint8_t* in = buffer + HLL_HEADER_SIZE;
+    const uint8_t* end = buffer + size;
+    if (buffer[5] == 1) {
+        if ((size_t) (end - in) != hll_packed_size(hll->precision) || !hll_to_dense(hll)) {
+            printf("Error: truncated HyperLogLog register array\n");
+            free_hyperloglog(hll);
+            return NULL;
+        }
+        uint32_t bits = 0;
+        int available = 0;
+        for (int i = 0; i < 1 << hll->precision; i++) {
+            while (available < 6) {
+                bits |= (uint32_t) *in++ << available;
+                available += 8;
+            }
+            hll->registers[i] = bits & 63;
+            bits >>= 6;
+            available -= 6;
         }
+        return hll;
     }
     
-    return (double) set_bits / filter->bit_array_size;
+    uint32_t count = 0;
+    for (int b = 0; b < 4; b++) count |= (uint32_t) buffer[8 + b] << (8 * b);
+    if (count > (1u << hll->precision) / sizeof(uint32_t) + HLL_PENDING_CAPACITY) {
+        printf("Error: corrupt HyperLogLog sparse entry count\n");
+        free_hyperloglog(hll);
+        return NULL;
+    }
+    uint32_t* entries = malloc((count ? count : 1) * sizeof(uint32_t));
+    uint32_t previous = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t delta = 0;
+        int shift = 0;
+        do {
+            if (in == end || shift > 28) {
+                printf("Error: truncated HyperLogLog sparse list\n");
+                free(entries);
+                free_hyperloglog(hll);
+                return NULL;
+            }
+            delta |= (uint32_t) (*in & 0x7f) << shift;
+            shift += 7;
+        } while (*in++ & 0x80);
+        // Strictly increasing, and each entry decodes to an in-range register
+        if ((i > 0 && (delta == 0 || previous + delta < previous)) ||
+            !hll_sparse_entry_valid(previous + delta, hll->precision)) {
+            printf("Error: corrupt HyperLogLog sparse entry\n");
+            free(entries);
+            free_hyperloglog(hll);
+            return NULL;
+        }
+        previous += delta;
+        entries[i] = previous;
+    }
+    bool merged = hll_merge_sparse(hll, entries, (int) count);
+    free(entries);
+    if (!merged) {
+        free_hyperloglog(hll);
+        return NULL;
+    }
+    return hll;
 }
 
-// Calculate the expected false positive rate based on current state
-double get_expected_false_positive_rate(const BloomFilter* filter) {
-    double fill_ratio = get_fill_ratio(filter);
-    return pow(fill_ratio, filter->num_hash_functions);
+#define BENCH_KEY_LENGTH 24
+
+typedef bool (*MembershipQuery)(const void* filter, const char* element);
+
+static bool bloom_query(const void* filter, const char* element) {
+    return bloom_might_contain((BloomFilter*) filter, element);
 }
 
-// Clear all bits in the bloom filter
-void bloom_clear(BloomFilter* filter) {
-    int byte_array_size = (filter->bit_array_size + 7) / 8;
-    memset(filter->bit_array, 0, byte_array_size);
-    filter->insert_count = 0;
-    
-    if (filter->verbose) {
-        add_operation(filter, "=== Bloom Filter Cleared ===");
-    }
+static bool cuckoo_query(const void* filter, const char* element) {
+    return cuckoo_might_contain(filter, element);
 }
 
-// Create a union of two bloom filters
-BloomFilter* bloom_union(const BloomFilter* filter1, const BloomFilter* filter2, bool verbose) {
-    if (filter1->bit_array_size != filter2->bit_array_size || 
-        filter1->num_hash_functions != filter2->num_hash_functions) {
-        printf("Error: Bloom filters must have same parameters for union\n");
-        return NULL;
+static bool binary_fuse_query(const void* filter, const char* element) {
+    return binary_fuse_might_contain(filter, element);
+}
+
+static double elapsed_ns(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+// Time `count` non-member queries and account them in stats
+static void measure_queries(BloomFilterStats* stats, MembershipQuery query, const void* filter,
+                            const char* queries, int count) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < count; i++) {
+        record_query(stats, query(filter, queries + (size_t) i * BENCH_KEY_LENGTH), false);
     }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    stats->query_ns = elapsed_ns(start, end) / count;
+    finish_stats(stats);
+}
+
+static void print_filter_stats(int size, const char* name, const BloomFilterStats* stats) {
+    printf("%-10d | %-12s | %8.2f | %6.3f | %9.1f | %8.1f | %.4f%%\n",
+           size, name, stats->bits_per_key, stats->fill_ratio, stats->insert_ns,
+           stats->query_ns, stats->actual_false_positive_rate * 100);
+}
+
+void performance_benchmark() {
+    printf("Comparing Bloom (1/256 target), cuckoo and binary fuse filters:\n");
     
-    BloomFilter* result = create_bloom_filter_custom(filter1->bit_array_size, 
-                                                    filter1->num_hash_functions, verbose);
+    int sizes[] = {10000, 100000, 1000000};
+    int num_sizes = sizeof(sizes) / sizeof(sizes[0]);
+    int query_count = 200000;
+    int threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
     
-    int byte_array_size = (filter1->bit_array_size + 7) / 8;
+    printf("%-10s | %-12s | %-8s | %-6s | %-9s | %-8s | %s\n",
+           "Size", "Filter", "Bits/key", "Fill", "Insert ns", "Query ns", "FP rate");
+    printf("---------------------------------------------------------------------------------\n");
     
-    // Perform bitwise OR operation
-    for (int i = 0; i < byte_array_size; i++) {
-        result->bit_array[i] = filter1->bit_array[i] | filter2->bit_array[i];
+    char* queries = malloc((size_t) query_count * BENCH_KEY_LENGTH);
+    for (int i = 0; i < query_count; i++) {
+        snprintf(queries + (size_t) i * BENCH_KEY_LENGTH, BENCH_KEY_LENGTH, "query_%d", i);
     }
     
-    result->insert_count = filter1->insert_count + filter2->insert_count; // Approximate
-    
-    if (verbose) {
-        add_operation(result, "=== Bloom Filter Union Created ===");
+    for (int s = 0; s < num_sizes; s++) {
+        int size = sizes[s];
+        char* keys = malloc((size_t) size * BENCH_KEY_LENGTH);
+        const char** key_ptrs = malloc(size * sizeof(char*));
+        for (int i = 0; i < size; i++) {
+            key_ptrs[i] = keys + (size_t) i * BENCH_KEY_LENGTH;
+            snprintf(keys + (size_t) i * BENCH_KEY_LENGTH, BENCH_KEY_LENGTH, "element_%d", i);
+        }
+        struct timespec start, end;
+        
+        // Bloom filter
+        BloomFilterStats bloom_stats = {0};
+        BloomFilter* bloom_filter = create_bloom_filter(size, 1.0 / 256);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < size; i++) bloom_add(bloom_filter, key_ptrs[i]);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        bloom_stats.total_inserts = size;
+        bloom_stats.insert_ns = elapsed_ns(start, end) / size;
+        bloom_stats.bits_per_key = (double) bloom_filter->bit_array_size / size;
+        bloom_stats.fill_ratio = get_fill_ratio(bloom_filter);
+        measure_queries(&bloom_stats, bloom_query, bloom_filter, queries, query_count);
+        print_filter_stats(size, "Bloom", &bloom_stats);
+        free_bloom_filter(bloom_filter);
+        
+        // Cuckoo filter
+        BloomFilterStats cuckoo_stats = {0};
+        CuckooFilter* cuckoo_filter = create_cuckoo_filter(size);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < size; i++) cuckoo_stats.total_inserts += cuckoo_insert(cuckoo_filter, key_ptrs[i]);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        cuckoo_stats.insert_ns = elapsed_ns(start, end) / size;
+        cuckoo_stats.bits_per_key = 8.0 * cuckoo_size_bytes(cuckoo_filter) / size;
+        cuckoo_stats.fill_ratio = cuckoo_load_factor(cuckoo_filter);
+        measure_queries(&cuckoo_stats, cuckoo_query, cuckoo_filter, queries, query_count);
+        print_filter_stats(size, "Cuckoo", &cuckoo_stats);
+        free_cuckoo_filter(cuckoo_filter);
+        
+        // Binary fuse filter (static build over the whole key set)
+        BloomFilterStats fuse_stats = {0};
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        BinaryFuseFilter* fuse_filter = create_binary_fuse_filter(key_ptrs, size, threads);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        if (fuse_filter) {
+            fuse_stats.total_inserts = size;
+            fuse_stats.insert_ns = elapsed_ns(start, end) / size;
+            fuse_stats.bits_per_key = 8.0 * binary_fuse_size_bytes(fuse_filter) / size;
+            fuse_stats.fill_ratio = (double) size / binary_fuse_size_bytes(fuse_filter);
+            measure_queries(&fuse_stats, binary_fuse_query, fuse_filter, queries, query_count);
+            print_filter_stats(size, "Binary fuse", &fuse_stats);
+            free_binary_fuse_filter(fuse_filter);
+        }
+        
+        free(key_ptrs);
+        free(keys);
     }
     
-    return result;
+    free(queries);
 }
 
-// Create an intersection of two bloom filters
-BloomFilter* bloom_intersection(const BloomFilter* filter1, const BloomFilter* filter2, bool verbose) {
-    if (filter1->bit_array_size != filter2->bit_array_size || 
-        filter1->num_hash_functions != filter2->num_hash_functions) {
-        printf("Error: Bloom filters must have same parameters for intersection\n");
-        return NULL;
+// Deletion on the cuckoo filter and exactness of the static binary fuse build
+void verify_filter_family() {
+    const int key_count = 200000;
+    const int probe_count = 200000;
+    char element[BENCH_KEY_LENGTH];
+    
+    CuckooFilter* cuckoo_filter = create_cuckoo_filter(key_count);
+    int inserted = 0;
+    for (int i = 0; i < key_count; i++) {
+        snprintf(element, sizeof(element), "element_%d", i);
+        inserted += cuckoo_insert(cuckoo_filter, element);
     }
     
-    BloomFilter* result = create_bloom_filter_custom(filter1->bit_array_size, 
-                                                    filter1->num_hash_functions, verbose);
-    
-    int byte_array_size = (filter1->bit_array_size + 7) / 8;
-    
-    // Perform bitwise AND operation
-    for (int i = 0; i < byte_array_size; i++) {
-        result->bit_array[i] = filter1->bit_array[i] & filter2->bit_array[i];
+    int false_negatives = 0;
+    for (int i = 0; i < key_count; i++) {
+        snprintf(element, sizeof(element), "element_%d", i);
+        false_negatives += !cuckoo_might_contain(cuckoo_filter, element);
+    }
+    int false_positives = 0;
+    for (int i = 0; i < probe_count; i++) {
+        snprintf(element, sizeof(element), "test_%d", i);
+        false_positives += cuckoo_might_contain(cuckoo_filter, element);
     }
     
-    result->insert_count = (filter1->insert_count < filter2->insert_count) ? 
-                          filter1->insert_count : filter2->insert_count; // Conservative estimate
+    printf("Cuckoo filter: %d/%d keys in %llu buckets (load %.3f, %.2f bits/key)\n",
+           inserted, key_count, (unsigned long long) cuckoo_filter->bucket_count,
+           cuckoo_load_factor(cuckoo_filter), 8.0 * cuckoo_size_bytes(cuckoo_filter) / key_count);
+    printf("  False negatives: %d\n", false_negatives);
+    printf("  False positive rate: %.4f%% (%d/%d)\n",
+           100.0 * false_positives / probe_count, false_positives, probe_count);
+    
+    // Delete every even key: odd keys must survive, even keys should vanish
+    int deleted = 0;
+    for (int i = 0; i < key_count; i += 2) {
+        snprintf(element, sizeof(element), "element_%d", i);
+        deleted += cuckoo_delete(cuckoo_filter, element);
+    }
+    int survivors_lost = 0, deleted_still_reported = 0;
+    for (int i = 0; i < key_count; i++) {
+        snprintf(element, sizeof(element), "element_%d", i);
+        bool present = cuckoo_might_contain(cuckoo_filter, element);
+        if (i % 2 == 1) survivors_lost += !present;
+        else deleted_still_reported += present;
+    }
+    printf("  After deleting %d keys: %d survivors lost, %d deleted keys still reported, load %.3f\n",
+           deleted, survivors_lost, deleted_still_reported, cuckoo_load_factor(cuckoo_filter));
+    free_cuckoo_filter(cuckoo_filter);
+    
+    // Binary fuse filter over the same keys
+    char* keys = malloc((size_t) key_count * BENCH_KEY_LENGTH);
+    const char** key_ptrs = malloc(key_count * sizeof(char*));
+    for (int i = 0; i < key_count; i++) {
+        key_ptrs[i] = keys + (size_t) i * BENCH_KEY_LENGTH;
+        snprintf(keys + (size_t) i * BENCH_KEY_LENGTH, BENCH_KEY_LENGTH, "element_%d", i);
+    }
     
-    if (verbose) {
-        add_operation(result, "=== Bloom Filter Intersection Created ===");
+    BinaryFuseFilter* fuse_filter = create_binary_fuse_filter(key_ptrs, key_count, 2);
+    if (fuse_filter) {
+        false_negatives = 0;
+        for (int i = 0; i < key_count; i++) false_negatives += !binary_fuse_might_contain(fuse_filter, key_ptrs[i]);
+        false_positives = 0;
+        for (int i = 0; i < probe_count; i++) {
+            snprintf(element, sizeof(element), "test_%d", i);
+            false_positives += binary_fuse_might_contain(fuse_filter, element);
+        }
+        
+        printf("Binary fuse filter: %d keys, %d shard(s), %.2f bits/key\n", key_count,
+               fuse_filter->shard_count, 8.0 * binary_fuse_size_bytes(fuse_filter) / key_count);
+        printf("  False negatives: %d\n", false_negatives);
+        printf("  False positive rate: %.4f%% (%d/%d, expected %.4f%%)\n",
+               100.0 * false_positives / probe_count, false_positives, probe_count, 100.0 / 256);
+        free_binary_fuse_filter(fuse_filter);
     }
     
-    return result;
+    free(key_ptrs);
+    free(keys);
 }
 
-// Estimate the number of elements in the bloom filter
-int estimate_element_count(const BloomFilter* filter) {
-    double fill_ratio = get_fill_ratio(filter);
-    if (fill_ratio == 0.0) return 0;
-    if (fill_ratio >= 1.0) return INT_MAX; // Overflow case
+// Save, map and combine filters on disk; compare against rebuilding in memory
+void demonstrate_persistent_filters() {
+    const char* temp_dir = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+    char path1[1024], path2[1024], union_path[1024], intersection_path[1024];
+    snprintf(path1, sizeof(path1), "%s/bloom_%d_a.bf", temp_dir, (int) getpid());
+    snprintf(path2, sizeof(path2), "%s/bloom_%d_b.bf", temp_dir, (int) getpid());
+    snprintf(union_path, sizeof(union_path), "%s/bloom_%d_union.bf", temp_dir, (int) getpid());
+    snprintf(intersection_path, sizeof(intersection_path), "%s/bloom_%d_inter.bf", temp_dir, (int) getpid());
+    
+    const int element_count = 200000;
+    char element[32];
+    struct timespec start, end;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    BloomFilter* filter1 = create_bloom_filter(element_count, 0.01);
+    for (int i = 0; i < element_count; i++) {
+        snprintf(element, sizeof(element), "element_%d", i);
+        bloom_add(filter1, element);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double rebuild_ms = elapsed_ns(start, end) / 1e6;
     
-    // n ≈ -(m/k) * ln(1 - X) where X is the fraction of set bits
-    double estimate = -((double) filter->bit_array_size / filter->num_hash_functions) * log(1 - fill_ratio);
-    return (int) round(estimate);
-}
-
-// Display bloom filter structure (for small filters)
-void bloom_display(const BloomFilter* filter) {
-    if (filter->bit_array_size > 100) {
-        int set_bits = 0;
-        for (int i = 0; i < filter->bit_array_size; i++) {
-            if (get_bit(filter, i)) set_bits++;
-        }
-        
-        printf("Bloom Filter: %d bits, %d hash functions, %d/%d bits set (%.3f%% full)\n",
-               filter->bit_array_size, filter->num_hash_functions, set_bits, 
-               filter->bit_array_size, get_fill_ratio(filter) * 100);
-        return;
+    BloomFilter* filter2 = create_bloom_filter(element_count, 0.01);
+    for (int i = element_count / 2; i < element_count * 3 / 2; i++) {
+        snprintf(element, sizeof(element), "element_%d", i);
+        bloom_add(filter2, element);
     }
     
-    printf("=== Bloom Filter Bit Array ===\n");
-    printf("Size: %d bits, Hash Functions: %d, Fill Ratio: %.3f\n", 
-           filter->bit_array_size, filter->num_hash_functions, get_fill_ratio(filter));
+    bool saved = bloom_save(filter1, path1) && bloom_save(filter2, path2);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    BloomFilter* mapped = saved ? bloom_map_file(path1, false) : NULL;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double map_ms = elapsed_ns(start, end) / 1e6;
+    if (!mapped) {
+        printf("Persistence demo skipped: cannot write to %s\n", temp_dir);
+        free_bloom_filter(filter1);
+        free_bloom_filter(filter2);
+        return;
+    }
     
-    // Display bit array in groups of 10
-    for (int i = 0; i < filter->bit_array_size; i++) {
-        if (i % 10 == 0) {
-            printf("\nBits %3d-%3d: ", i, (i + 9 < filter->bit_array_size) ? i + 9 : filter->bit_array_size - 1);
+    int mismatches = 0;
+    for (int i = 0; i < 2 * element_count; i++) {
+        snprintf(element, sizeof(element), i % 2 ? "element_%d" : "probe_%d", i);
+        mismatches += bloom_might_contain(mapped, element) != bloom_might_contain(filter1, element);
+    }
+    printf("Saved %d-bit filter (%d hash functions) to %s\n",
+           mapped->bit_array_size, mapped->num_hash_functions, path1);
+    printf("Rebuild by replaying %d adds: %.2f ms, mmap load: %.3f ms\n", element_count, rebuild_ms, map_ms);
+    printf("Mapped vs in-memory answers differing: %d/%d\n", mismatches, 2 * element_count);
+    printf("bloom_add on the mapped filter: ");
+    bloom_add(mapped, "new_element");
+    
+    // Streamed set operations must match the in-memory ones bit for bit
+    BloomFilter* union_memory = bloom_union(filter1, filter2);
+    BloomFilter* intersection_memory = bloom_intersection(filter1, filter2);
+    size_t bytes = ((size_t) filter1->bit_array_size + 7) / 8;
+    if (bloom_union_files(path1, path2, union_path) &&
+        bloom_intersection_files(path1, path2, intersection_path)) {
+        BloomFilter* union_file = bloom_map_file(union_path, true);
+        BloomFilter* intersection_file = bloom_map_file(intersection_path, true);
+        if (union_file && intersection_file) {
+            printf("Streamed union matches in-memory union: %s\n",
+                   memcmp(union_file->bit_array, union_memory->bit_array, bytes) == 0 ? "yes" : "NO");
+            printf("Streamed intersection matches in-memory intersection: %s\n",
+                   memcmp(intersection_file->bit_array, intersection_memory->bit_array, bytes) == 0 ? "yes" : "NO");
         }
-        printf("%c", get_bit(filter, i) ? '1' : '0');
+        free_bloom_filter(union_file);
+        free_bloom_filter(intersection_file);
     }
-    printf("\n\n");
-}
-
-// Free bloom filter memory
-void free_bloom_filter(BloomFilter* filter) {
-    if (filter) {
-        free(filter->bit_array);
-        free(filter);
+    
+    // Flip one bit in a saved file: the checksum must catch it
+    FILE* file = fopen(path2, "r+b");
+    if (file) {
+        fseek(file, sizeof(BloomFileHeader) + bytes / 2, SEEK_SET);
+        int byte = fgetc(file);
+        fseek(file, sizeof(BloomFileHeader) + bytes / 2, SEEK_SET);
+        fputc(byte ^ 0x10, file);
+        fclose(file);
+        printf("Loading a corrupted file: ");
+        BloomFilter* corrupted = bloom_map_file(path2, true);
+        if (corrupted) printf("loaded (corruption NOT detected)\n");
+        free_bloom_filter(corrupted);
+        printf("Streaming union over a corrupted file: ");
+        if (bloom_union_files(path1, path2, union_path)) printf("succeeded (corruption NOT detected)\n");
     }
+    
+    free_bloom_filter(mapped);
+    free_bloom_filter(filter1);
+    free_bloom_filter(filter2);
+    free_bloom_filter(union_memory);
+    free_bloom_filter(intersection_memory);
+    remove(path1);
+    remove(path2);
+    remove(union_path);
+    remove(intersection_path);
 }
 
-// Format bytes for display
-void format_bytes(int bytes, char* buffer) {
-    if (bytes < 1024) {
-        sprintf(buffer, "%d B", bytes);
-    } else if (bytes < 1024 * 1024) {
-        sprintf(buffer, "%.1f KB", bytes / 1024.0);
-    } else {
-        sprintf(buffer, "%.1f MB", bytes / (1024.0 * 1024.0));
+// Unbounded streams: a growing Bloom filter and distinct counting
+void demonstrate_streaming_sketches() {
+    const double target_rate = 0.01;
+    const int initial_capacity = 1000;
+    const int stream_length = 1000000;
+    const int probe_count = 200000;
+    char element[BENCH_KEY_LENGTH];
+    
+    // A fixed filter sized for the first 1000 keys vs the scalable one
+    BloomFilter* fixed = create_bloom_filter(initial_capacity, target_rate);
+    ScalableBloomFilter* scalable = create_scalable_bloom_filter(initial_capacity, target_rate);
+    if (!scalable) {
+        free_bloom_filter(fixed);
+        return;
     }
-}
-
-void performance_benchmark() {
-    printf("Comparing Bloom Filter vs hash table performance:\n");
-    
-    int sizes[] = {10000, 100000, 500000};
-    int num_sizes = sizeof(sizes) / sizeof(sizes[0]);
     
-    printf("%-10s | %-15s | %-15s\n", "Size", "Bloom Add (ms)", "Bloom Query (ms)");
-    printf("----------------------------------------\n");
+    printf("Stream of %d unique keys, both filters sized for %d at %.1f%% FP\n",
+           stream_length, initial_capacity, target_rate * 100);
+    printf("%-10s %-16s %-16s %-10s %-14s %-12s\n",
+           "Keys", "Fixed FP", "Scalable FP", "Stages", "Bound", "Bits/key");
+    printf("%-10s %-16s %-16s %-10s %-14s %-12s\n",
+           "----", "--------", "-----------", "------", "-----", "--------");
+    
+    int inserted = 0;
+    for (int checkpoint = 10000; checkpoint <= stream_length; checkpoint *= 10) {
+        for (; inserted < checkpoint; inserted++) {
+            snprintf(element, sizeof(element), "element_%d", inserted);
+            bloom_add(fixed, element);
+            scalable_bloom_add(scalable, element);
+        }
+        int fixed_hits = 0, scalable_hits = 0;
+        for (int i = 0; i < probe_count; i++) {
+            snprintf(element, sizeof(element), "probe_%d", i);
+            fixed_hits += bloom_might_contain(fixed, element);
+            scalable_hits += scalable_bloom_might_contain(scalable, element);
+        }
+        printf("%-10d %-16.4f %-16.4f %-10d %-14.4f %-12.2f\n", checkpoint,
+               (double) fixed_hits / probe_count * 100, (double) scalable_hits / probe_count * 100,
+               scalable->filter_count, scalable_bloom_expected_false_positive_rate(scalable) * 100,
+               scalable_bloom_size_bytes(scalable) * 8.0 / scalable->insert_count);
+    }
     
-    for (int s = 0; s < num_sizes; s++) {
-        int size = sizes[s];
-        
-        // Bloom Filter benchmark
-        BloomFilter* bloom_filter = create_bloom_filter(size, 0.01, false);
-        
-        clock_t bloom_add_start = clock();
-        for (int i = 0; i < size; i++) {
-            char element[50];
-            sprintf(element, "element_%d", i);
-            bloom_add(bloom_filter, element);
+    int false_negatives = 0;
+    for (int i = 0; i < stream_length; i += 97) {
+        snprintf(element, sizeof(element), "element_%d", i);
+        false_negatives += !scalable_bloom_might_contain(scalable, element);
+    }
+    printf("(FP columns in %%) Scalable false negatives on sampled members: %d\n", false_negatives);
+    printf("Fixed filter estimate_element_count after %d keys: %d\n",
+           stream_length, estimate_element_count(fixed));
+    free_bloom_filter(fixed);
+    free_scalable_bloom_filter(scalable);
+    
+    // Distinct counts over streams with repeats: each key appears 3 times
+    printf("\nHyperLogLog++ (p = %d, standard error %.1f%%) distinct counts:\n",
+           HLL_DEFAULT_PRECISION, 104.0 / sqrt(1 << HLL_DEFAULT_PRECISION));
+    printf("%-10s %-14s %-10s %-8s %-12s\n", "Distinct", "Estimate", "Error", "Mode", "Serialized");
+    printf("%-10s %-14s %-10s %-8s %-12s\n", "--------", "--------", "-----", "----", "----------");
+    uint8_t* buffer = malloc(HLL_HEADER_SIZE + ((size_t) 1 << HLL_MAX_PRECISION));
+    for (int distinct = 10; distinct <= 1000000; distinct *= 10) {
+        HyperLogLog* hll = create_hyperloglog(HLL_DEFAULT_PRECISION);
+        for (int repeat = 0; repeat < 3; repeat++) {
+            for (int i = 0; i < distinct; i++) {
+                snprintf(element, sizeof(element), "user_%d", i);
+                hll_add(hll, element);
+            }
         }
-        clock_t bloom_add_end = clock();
-        
-        // Query benchmark
-        clock_t bloom_query_start = clock();
-        for (int i = 0; i < 10000; i++) {
-            char query[50];
-            sprintf(query, "query_%d", i);
-            bloom_might_contain(bloom_filter, query);
-        }
-        clock_t bloom_query_end = clock();
-        
-        double bloom_add_time = ((double)(bloom_add_end - bloom_add_start)) / CLOCKS_PER_SEC * 1000;
-        double bloom_query_time = ((double)(bloom_query_end - bloom_query_start)) / CLOCKS_PER_SEC * 1000;
-        
-        printf("%-10d | %-15.1f | %-15.1f\n", size, bloom_add_time, bloom_query_time);
-        
-        free_bloom_filter(bloom_filter);
+        double estimate = hll_count(hll);
+        size_t bytes = hll_serialize(hll, buffer, HLL_HEADER_SIZE + ((size_t) 1 << HLL_MAX_PRECISION));
+        char error[16];
+        snprintf(error, sizeof(error), "%+.2f%%", (estimate - distinct) / distinct * 100);
+        printf("%-10d %-14.0f %-10s %-8s %zu bytes\n", distinct, estimate, error,
+               hll->sparse ? "sparse" : "dense", bytes);
+        free_hyperloglog(hll);
     }
+    
+    // Two overlapping streams merged through their serialized form
+    const int stream_size = 300000, overlap = 100000;
+    HyperLogLog* stream_a = create_hyperloglog(HLL_DEFAULT_PRECISION);
+    HyperLogLog* stream_b = create_hyperloglog(HLL_DEFAULT_PRECISION);
+    for (int i = 0; i < stream_size; i++) {
+        snprintf(element, sizeof(element), "user_%d", i);
+        hll_add(stream_a, element);
+        snprintf(element, sizeof(element), "user_%d", i + stream_size - overlap);
+        hll_add(stream_b, element);
+    }
+    size_t bytes = hll_serialize(stream_b, buffer, HLL_HEADER_SIZE + ((size_t) 1 << HLL_MAX_PRECISION));
+    HyperLogLog* received = hll_deserialize(buffer, bytes);
+    if (received && hll_merge(stream_a, received)) {
+        int exact = 2 * stream_size - overlap;
+        double estimate = hll_count(stream_a);
+        printf("Merged two %d-key streams (%d shared) via %zu-byte sketch: %.0f vs %d exact (%.2f%%)\n",
+               stream_size, overlap, bytes, estimate, exact, (estimate - exact) / exact * 100);
+    }
+    
+    HyperLogLog* small = create_hyperloglog(HLL_DEFAULT_PRECISION);
+    for (int i = 0; i < 150; i++) {
+        snprintf(element, sizeof(element), "user_%d", i);
+        hll_add(small, element);
+    }
+    bytes = hll_serialize(small, buffer, HLL_HEADER_SIZE + ((size_t) 1 << HLL_MAX_PRECISION));
+    HyperLogLog* small_copy = hll_deserialize(buffer, bytes);
+    if (small_copy) {
+        printf("Sparse round trip: 150 keys in %zu bytes, count %.1f -> %.1f\n",
+               bytes, hll_count(small), hll_count(small_copy));
+    }
+    
+    // A sparse entry pointing past the registers must be refused, not merged
+    uint8_t corrupt[] = { 'H', 'L', 'L', HLL_FORMAT_VERSION, HLL_DEFAULT_PRECISION, 0, 0, 0, 1, 0, 0, 0,
+                          0xfe, 0xff, 0xff, 0xff, 0x07 };   // 0x7ffffffe
+    printf("Loading a corrupt sparse sketch: ");
+    HyperLogLog* corrupt_copy = hll_deserialize(corrupt, sizeof(corrupt));
+    if (corrupt_copy) printf("loaded (corruption NOT detected)\n");
+    free_hyperloglog(corrupt_copy);
+    
+    free(buffer);
+    free_hyperloglog(stream_a);
+    free_hyperloglog(stream_b);
+    free_hyperloglog(received);
+    free_hyperloglog(small);
+    free_hyperloglog(small_copy);
 }
 
 void demonstrate_real_world_applications() {
@@ -448,7 +2383,7 @@ void demonstrate_real_world_applications() {
     
     // Application 1: Web crawler URL deduplication
     printf("\n1. Web Crawler URL Deduplication\n");
-    BloomFilter* url_filter = create_bloom_filter(100000, 0.001, false);
+    BloomFilter* url_filter = create_bloom_filter(100000, 0.001);
     
     // Simulate crawling URLs
     const char* domains[] = {"example.com", "test.org", "demo.net", "sample.io"};
@@ -496,7 +2431,7 @@ void demonstrate_real_world_applications() {
     printf("\n2. Database Query Optimization (Bloom Joins)\n");
     
     // Simulate large table join optimization
-    BloomFilter* table_filter = create_bloom_filter(5000, 0.01, false);
+    BloomFilter* table_filter = create_bloom_filter(5000, 0.01);
     
     // "Small" table keys (build bloom filter)
     int small_table_keys[5000];
@@ -538,7 +2473,7 @@ void demonstrate_real_world_applications() {
     // Application 3: Spell checker
     printf("\n3. Spell Checker Application\n");
     
-    BloomFilter* dictionary = create_bloom_filter(50000, 0.001, false);
+    BloomFilter* dictionary = create_bloom_filter(50000, 0.001);
     
     // Add common English words to dictionary
     const char* common_words[] = {
@@ -581,14 +2516,17 @@ void demonstrate_real_world_applications() {
     printf("- Malware detection and security filtering\n");
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    trace_register_events(BLOOM_EVENTS, BLOOM_EVENT_COUNT);
+    if (trace_handle_args(argc, argv)) return 0;
     printf("=== Bloom Filter - Comprehensive Analysis ===\n\n");
     
     srand(42); // Fixed seed for reproducible results
     
     // Test case 1: Basic operations with step-by-step demonstration
     printf("Test Case 1: Basic Operations\n");
-    BloomFilter* basic_filter = create_bloom_filter(100, 0.01, true);
+    trace_set_enabled(true);
+    BloomFilter* basic_filter = create_bloom_filter(100, 0.01);
     
     // Add some elements
     const char* elements[] = {"apple", "banana", "cherry", "date", "elderberry"};
@@ -598,8 +2536,7 @@ int main() {
     for (int i = 0; i < num_elements; i++) {
         bloom_add(basic_filter, elements[i]);
         printf("\nOperations for add(\"%s\"):\n", elements[i]);
-        print_operations(basic_filter);
-        clear_operations(basic_filter);
+        trace_print_thread(stdout, "  ");
     }
     
     bloom_display(basic_filter);
@@ -615,10 +2552,11 @@ int main() {
         
         if (strcmp(test_elements[i], "apple") == 0) {
             printf("Detailed operations:\n");
-            print_operations(basic_filter);
-            clear_operations(basic_filter);
+            trace_print_thread(stdout, "  ");
         }
+        trace_discard_thread();
     }
+    trace_set_enabled(false);
     
     // Test case 2: False positive rate analysis
     printf("\n%s\n", "============================================================");
@@ -632,7 +2570,7 @@ int main() {
         double target_rate = target_rates[r];
         printf("\nTesting with target false positive rate: %.3f\n", target_rate);
         
-        BloomFilter* fp_filter = create_bloom_filter(test_elements_count, target_rate, false);
+        BloomFilter* fp_filter = create_bloom_filter(test_elements_count, target_rate);
         
         // Add elements to bloom filter
         for (int i = 0; i < test_elements_count; i++) {
@@ -687,7 +2625,7 @@ int main() {
         int element_count = element_counts[i];
         
         // Bloom filter memory usage
-        BloomFilter* mem_filter = create_bloom_filter(element_count, 0.01, false);
+        BloomFilter* mem_filter = create_bloom_filter(element_count, 0.01);
         int bloom_bytes = (mem_filter->bit_array_size + 7) / 8; // Convert bits to bytes
         
         // Estimate hash table memory usage (rough approximation)
@@ -711,8 +2649,8 @@ int main() {
     printf("\n%s\n", "============================================================");
     printf("Test Case 4: Set Operations\n");
     
-    BloomFilter* set1 = create_bloom_filter(50, 0.1, true);
-    BloomFilter* set2 = create_bloom_filter_custom(set1->bit_array_size, set1->num_hash_functions, false);
+    BloomFilter* set1 = create_bloom_filter(50, 0.1);
+    BloomFilter* set2 = create_bloom_filter_custom(set1->bit_array_size, set1->num_hash_functions);
     
     // Add elements to first set
     const char* set1_elements[] = {"a", "b", "c", "d", "e"};
@@ -746,7 +2684,7 @@ int main() {
     bloom_display(set2);
     
     // Union operation
-    BloomFilter* union_set = bloom_union(set1, set2, false);
+    BloomFilter* union_set = bloom_union(set1, set2);
     printf("Union of Set 1 and Set 2:\n");
     bloom_display(union_set);
     
@@ -767,7 +2705,7 @@ int main() {
     }
     
     // Intersection operation
-    BloomFilter* intersection_set = bloom_intersection(set1, set2, false);
+    BloomFilter* intersection_set = bloom_intersection(set1, set2);
     printf("\nIntersection of Set 1 and Set 2:\n");
     bloom_display(intersection_set);
     
@@ -777,6 +2715,24 @@ int main() {
     
     performance_benchmark();
     
+    // Test case 6: Deletable and static filters
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 6: Cuckoo and Binary Fuse Filters\n");
+    
+    verify_filter_family();
+    
+    // Test case 7: On-disk format
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 7: Memory-Mapped On-Disk Filters\n");
+    
+    demonstrate_persistent_filters();
+    
+    // Test case 8: Streams of unknown size
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 8: Scalable Bloom Filter and HyperLogLog++\n");
+    
+    demonstrate_streaming_sketches();
+    
     // Clean up
     free_bloom_filter(basic_filter);
     free_bloom_filter(set1);
@@ -793,7 +2749,8 @@ int main() {
     
     printf("\nTrade-offs:\n");
     printf("- Space efficiency vs accuracy\n");
-    printf("- Cannot delete elements (variants like Counting Bloom Filters exist)\n");
+    printf("- Cannot delete elements (cuckoo filters can, at ~16 bits/key)\n");
+    printf("- Static key sets fit in ~9 bits/key with a binary fuse filter\n");
     printf("- Hash function quality affects performance\n");
     printf("- Fill ratio affects false positive rate exponentially\n");
     
@@ -10,6 +10,8 @@
  * - Law of Large Numbers: Convergence as sample size increases
  * - Statistical Estimation: Confidence intervals and error bounds
  * - Variance Reduction: Techniques to improve accuracy
+ * - Quasi-Monte Carlo: Low-discrepancy Sobol/Halton points
+ * - Adaptive Importance Sampling: VEGAS grid refinement
  * 
  * Time Complexity: O(n) where n is the number of samples
  * Space Complexity: O(1) for basic integration, O(n) for importance sampling
@@ -27,10 +29,21 @@
 #include <time.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "trace.h"
 
-#define MAX_DIMENSIONS 10
 #define MAX_SAMPLES 1000000
-#define MAX_STEPS 1000
+#define SOBOL_BITS 32
+#define SOBOL_MAX_DEGREE 20
+#define QMC_REPLICATES 8
+#define VEGAS_BINS 50
+#define VEGAS_ALPHA 1.5
+#define VEGAS_ITERATIONS 10
+#define VEGAS_MIN_WEIGHT 1e-30
+#define VEGAS_MIN_SAMPLES_PER_BIN 100
+#define QMC_T_CRITICAL 2.365  // Student-t 97.5% quantile, QMC_REPLICATES - 1 dof
+#define HIGH_DIMENSIONS 100
 
 typedef struct {
     double estimate;
@@ -40,19 +53,88 @@ typedef struct {
     long computation_time_ms;
 } IntegrationResult;
 
+typedef enum {
+    METHOD_PSEUDO_RANDOM,
+    METHOD_SOBOL,
+    METHOD_HALTON,
+    METHOD_VEGAS,
+    METHOD_COUNT
+} IntegrationMethod;
+
 typedef struct {
+    IntegrationMethod method;
     int sample_sizes[20];
     double estimates[20];
     double errors[20];
     double standard_errors[20];
+    long times_ms[20];
     int count;
 } ConvergenceAnalysis;
 
+// Sobol low-discrepancy sequence (Gray-code ordering, optional Owen scrambling)
+typedef struct {
+    int dimensions;
+    uint32_t* direction;      // dimensions x SOBOL_BITS direction numbers
+    uint32_t* state;          // current integer coordinate per dimension
+    uint32_t* scramble_seeds; // per-dimension Owen scrambling seeds
+    bool scrambled;
+    uint32_t index;
+} SobolSequence;
+
+// Halton low-discrepancy sequence (prime bases, random-shift randomization)
 typedef struct {
-    char steps[MAX_STEPS][200];
-    int step_count;
-    bool verbose;
-} StepTracker;
+    int dimensions;
+    int* bases;
+    double* shifts;
+    uint32_t index;
+} HaltonSequence;
+
+// Trace events (compiled out unless built with -DTRACE_ENABLED, see trace.h)
+enum {
+    EV_MC_BASIC, EV_MC_BASIC_RANGE, EV_MC_SAMPLE, EV_MC_MEAN, EV_MC_STD_ERROR, EV_MC_FINAL,
+    EV_MC_HIT_OR_MISS, EV_MC_REGION, EV_MC_HIT_SAMPLE, EV_MC_HITS, EV_MC_ESTIMATE,
+    EV_MC_MULTI, EV_MC_MULTI_SIZE, EV_MC_POINT_1D, EV_MC_POINT_2D, EV_MC_POINT_ND, EV_MC_VOLUME,
+    EV_MC_STRATIFIED, EV_MC_STRATA, EV_MC_STRATUM_SAMPLE, EV_MC_OVERALL_MEAN,
+    EV_MC_QMC, EV_MC_QMC_SIZE, EV_MC_REPLICATE,
+    EV_MC_VEGAS, EV_MC_VEGAS_SIZE, EV_MC_VEGAS_ITERATION,
+    EV_MC_CONVERGENCE, EV_MC_ACTUAL, EV_MC_CONVERGENCE_STEP, EV_MC_TIMED, EV_MC_BUDGET,
+    MC_EVENT_COUNT
+};
+
+static const TraceEvent MC_EVENTS[MC_EVENT_COUNT] = {
+    [EV_MC_BASIC]            = { "basic", "=== Basic Monte Carlo Integration ===" },
+    [EV_MC_BASIC_RANGE]      = { "basic_range", "Integrating over [%.3f, %.3f] with %d samples" },
+    [EV_MC_SAMPLE]           = { "sample", "Sample %d: x=%.4f, f(x)=%.4f" },
+    [EV_MC_MEAN]             = { "mean", "Mean function value: %.6f" },
+    [EV_MC_STD_ERROR]        = { "std_error", "Standard error: %.6f" },
+    [EV_MC_FINAL]            = { "final", "Final estimate: %.6f ± %.6f" },
+    [EV_MC_HIT_OR_MISS]      = { "hit_or_miss", "=== Hit-or-Miss Monte Carlo Integration ===" },
+    [EV_MC_REGION]           = { "region", "Region: [%.3f, %.3f] × [0, %.3f]" },
+    [EV_MC_HIT_SAMPLE]       = { "hit_sample", "Sample %d: (%.4f, %.4f) -> %s" },
+    [EV_MC_HITS]             = { "hits", "Hits: %d / %d (%.4f%%)" },
+    [EV_MC_ESTIMATE]         = { "estimate", "Estimate: %.6f ± %.6f" },
+    [EV_MC_MULTI]            = { "multi", "=== Multidimensional Monte Carlo Integration ===" },
+    [EV_MC_MULTI_SIZE]       = { "multi_size", "Dimensions: %d, Samples: %d" },
+    [EV_MC_POINT_1D]         = { "point_1d", "Sample %d: [%.3f] -> %.4f" },
+    [EV_MC_POINT_2D]         = { "point_2d", "Sample %d: [%.3f, %.3f] -> %.4f" },
+    [EV_MC_POINT_ND]         = { "point_nd", "Sample %d: [%.3f, %.3f, ...] -> %.4f" },
+    [EV_MC_VOLUME]           = { "volume", "Integration volume: %.6f" },
+    [EV_MC_STRATIFIED]       = { "stratified", "=== Stratified Sampling Monte Carlo Integration ===" },
+    [EV_MC_STRATA]           = { "strata", "Strata: %d, Samples per stratum: %d" },
+    [EV_MC_STRATUM_SAMPLE]   = { "stratum_sample", "Stratum %d, Sample %d: x=%.4f, f(x)=%.4f" },
+    [EV_MC_OVERALL_MEAN]     = { "overall_mean", "Overall mean: %.6f" },
+    [EV_MC_QMC]              = { "qmc", "=== Quasi-Monte Carlo Integration (%s) ===" },
+    [EV_MC_QMC_SIZE]         = { "qmc_size", "Dimensions: %d, Samples: %d, Replicates: %d" },
+    [EV_MC_REPLICATE]        = { "replicate", "Replicate %d: estimate=%.6f" },
+    [EV_MC_VEGAS]            = { "vegas", "=== VEGAS Adaptive Monte Carlo Integration ===" },
+    [EV_MC_VEGAS_SIZE]       = { "vegas_size", "Dimensions: %d, Samples: %d, Iterations: %d, Bins/axis: %d" },
+    [EV_MC_VEGAS_ITERATION]  = { "vegas_iteration", "Iteration %d: estimate=%.6f, std error=%.6f" },
+    [EV_MC_CONVERGENCE]      = { "convergence", "=== Convergence Analysis ===" },
+    [EV_MC_ACTUAL]           = { "actual", "Actual integral value: %.6f" },
+    [EV_MC_CONVERGENCE_STEP] = { "convergence_step", "Samples: %d, Estimate: %.6f, Error: %.6f (%.2f%%)" },
+    [EV_MC_TIMED]            = { "timed", "=== Timed Convergence Analysis: %s ===" },
+    [EV_MC_BUDGET]           = { "budget", "Budget %ldms: %d samples in %ldms, error %.2e" },
+};
 
 // Function pointer types
 typedef double (*SingleVarFunction)(double x);
@@ -63,25 +145,6 @@ typedef double (*ImportanceSampler)(void);
 static unsigned int random_seed = 1;
 
 // Utility functions
-void init_step_tracker(StepTracker* tracker, bool verbose) {
-    tracker->step_count = 0;
-    tracker->verbose = verbose;
-}
-
-void add_step(StepTracker* tracker, const char* step) {
-    if (tracker->verbose && tracker->step_count < MAX_STEPS) {
-        strncpy(tracker->steps[tracker->step_count], step, 199);
-        tracker->steps[tracker->step_count][199] = '\0';
-        tracker->step_count++;
-    }
-}
-
-void print_steps(const StepTracker* tracker) {
-    for (int i = 0; i < tracker->step_count; i++) {
-        printf("%s\n", tracker->steps[i]);
-    }
-}
-
 void set_random_seed(unsigned int seed) {
     random_seed = seed;
     srand(seed);
@@ -120,14 +183,9 @@ void print_result(const char* method, const IntegrationResult* result) {
 
 // Basic Monte Carlo integration for single-variable functions
 IntegrationResult integrate_function(SingleVarFunction function, double lower_bound, 
-                                   double upper_bound, int num_samples, StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Basic Monte Carlo Integration ===");
-        char step[200];
-        sprintf(step, "Integrating over [%.3f, %.3f] with %d samples", 
-                lower_bound, upper_bound, num_samples);
-        add_step(tracker, step);
-    }
+                                   double upper_bound, int num_samples) {
+    TRACE(EV_MC_BASIC);
+    TRACE(EV_MC_BASIC_RANGE, lower_bound, upper_bound, num_samples);
     
     clock_t start_time = clock();
     
@@ -142,11 +200,7 @@ IntegrationResult integrate_function(SingleVarFunction function, double lower_bo
         sum += y;
         sum_squares += y * y;
         
-        if (tracker->verbose && i < 10) {
-            char step[200];
-            sprintf(step, "Sample %d: x=%.4f, f(x)=%.4f", i + 1, x, y);
-            add_step(tracker, step);
-        }
+        if (i < 10) TRACE(EV_MC_SAMPLE, i + 1, x, y);
     }
     
     double mean = sum / num_samples;
@@ -160,15 +214,9 @@ IntegrationResult integrate_function(SingleVarFunction function, double lower_bo
     clock_t end_time = clock();
     long computation_time = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
     
-    if (tracker->verbose) {
-        char step[200];
-        sprintf(step, "Mean function value: %.6f", mean);
-        add_step(tracker, step);
-        sprintf(step, "Standard error: %.6f", standard_error);
-        add_step(tracker, step);
-        sprintf(step, "Final estimate: %.6f ± %.6f", estimate, confidence_interval);
-        add_step(tracker, step);
-    }
+    TRACE(EV_MC_MEAN, mean);
+    TRACE(EV_MC_STD_ERROR, standard_error);
+    TRACE(EV_MC_FINAL, estimate, confidence_interval);
     
     IntegrationResult result = {estimate, estimate_error, confidence_interval, 
                                num_samples, computation_time};
@@ -177,15 +225,9 @@ IntegrationResult integrate_function(SingleVarFunction function, double lower_bo
 
 // Monte Carlo integration with hit-or-miss method
 IntegrationResult integrate_hit_or_miss(SingleVarFunction function, double lower_bound,
-                                       double upper_bound, double max_value, int num_samples,
-                                       StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Hit-or-Miss Monte Carlo Integration ===");
-        char step[200];
-        sprintf(step, "Region: [%.3f, %.3f] × [0, %.3f]", 
-                lower_bound, upper_bound, max_value);
-        add_step(tracker, step);
-    }
+                                       double upper_bound, double max_value, int num_samples) {
+    TRACE(EV_MC_HIT_OR_MISS);
+    TRACE(EV_MC_REGION, lower_bound, upper_bound, max_value);
     
     clock_t start_time = clock();
     
@@ -196,17 +238,12 @@ IntegrationResult integrate_hit_or_miss(SingleVarFunction function, double lower
         double x = lower_bound + uniform_random() * width;
         double y = uniform_random() * max_value;
         
-        if (y <= function(x)) {
+        bool hit = y <= function(x);
+        if (hit) {
             hits++;
         }
         
-        if (tracker->verbose && i < 10) {
-            bool hit = y <= function(x);
-            char step[200];
-            sprintf(step, "Sample %d: (%.4f, %.4f) -> %s", 
-                    i + 1, x, y, hit ? "HIT" : "MISS");
-            add_step(tracker, step);
-        }
+        if (i < 10) TRACE_S(EV_MC_HIT_SAMPLE, hit ? "HIT" : "MISS", i + 1, x, y);
     }
     
     double hit_ratio = (double) hits / num_samples;
@@ -220,13 +257,8 @@ IntegrationResult integrate_hit_or_miss(SingleVarFunction function, double lower
     clock_t end_time = clock();
     long computation_time = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
     
-    if (tracker->verbose) {
-        char step[200];
-        sprintf(step, "Hits: %d / %d (%.4f%%)", hits, num_samples, hit_ratio * 100);
-        add_step(tracker, step);
-        sprintf(step, "Estimate: %.6f ± %.6f", estimate, confidence_interval);
-        add_step(tracker, step);
-    }
+    TRACE(EV_MC_HITS, hits, num_samples, hit_ratio * 100);
+    TRACE(EV_MC_ESTIMATE, estimate, confidence_interval);
     
     IntegrationResult result = {estimate, standard_error, confidence_interval, 
                                num_samples, computation_time};
@@ -237,14 +269,9 @@ IntegrationResult integrate_hit_or_miss(SingleVarFunction function, double lower
 IntegrationResult integrate_multidimensional(MultiVarFunction function, 
                                            const double* lower_bounds, 
                                            const double* upper_bounds,
-                                           int dimensions, int num_samples, 
-                                           StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Multidimensional Monte Carlo Integration ===");
-        char step[200];
-        sprintf(step, "Dimensions: %d, Samples: %d", dimensions, num_samples);
-        add_step(tracker, step);
-    }
+                                           int dimensions, int num_samples) {
+    TRACE(EV_MC_MULTI);
+    TRACE(EV_MC_MULTI_SIZE, dimensions, num_samples);
     
     clock_t start_time = clock();
     
@@ -269,18 +296,10 @@ IntegrationResult integrate_multidimensional(MultiVarFunction function,
         sum += value;
         sum_squares += value * value;
         
-        if (tracker->verbose && i < 5) {
-            char step[200];
-            char point_str[100] = "[";
-            for (int d = 0; d < dimensions; d++) {
-                char temp[20];
-                sprintf(temp, "%.3f", point[d]);
-                strcat(point_str, temp);
-                if (d < dimensions - 1) strcat(point_str, ", ");
-            }
-            strcat(point_str, "]");
-            sprintf(step, "Sample %d: %s -> %.4f", i + 1, point_str, value);
-            add_step(tracker, step);
+        if (i < 5) {
+            if (dimensions == 1) TRACE(EV_MC_POINT_1D, i + 1, point[0], value);
+            else if (dimensions == 2) TRACE(EV_MC_POINT_2D, i + 1, point[0], point[1], value);
+            else TRACE(EV_MC_POINT_ND, i + 1, point[0], point[1], value);
         }
     }
     
@@ -297,15 +316,9 @@ IntegrationResult integrate_multidimensional(MultiVarFunction function,
     clock_t end_time = clock();
     long computation_time = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
     
-    if (tracker->verbose) {
-        char step[200];
-        sprintf(step, "Integration volume: %.6f", volume);
-        add_step(tracker, step);
-        sprintf(step, "Mean function value: %.6f", mean);
-        add_step(tracker, step);
-        sprintf(step, "Final estimate: %.6f ± %.6f", estimate, confidence_interval);
-        add_step(tracker, step);
-    }
+    TRACE(EV_MC_VOLUME, volume);
+    TRACE(EV_MC_MEAN, mean);
+    TRACE(EV_MC_FINAL, estimate, confidence_interval);
     
     IntegrationResult result = {estimate, estimate_error, confidence_interval, 
                                num_samples, computation_time};
@@ -315,14 +328,9 @@ IntegrationResult integrate_multidimensional(MultiVarFunction function,
 // Stratified sampling Monte Carlo integration
 IntegrationResult integrate_stratified(SingleVarFunction function, double lower_bound,
                                      double upper_bound, int num_strata, 
-                                     int samples_per_stratum, StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Stratified Sampling Monte Carlo Integration ===");
-        char step[200];
-        sprintf(step, "Strata: %d, Samples per stratum: %d", 
-                num_strata, samples_per_stratum);
-        add_step(tracker, step);
-    }
+                                     int samples_per_stratum) {
+    TRACE(EV_MC_STRATIFIED);
+    TRACE(EV_MC_STRATA, num_strata, samples_per_stratum);
     
     clock_t start_time = clock();
     
@@ -341,12 +349,7 @@ IntegrationResult integrate_stratified(SingleVarFunction function, double lower_
             double y = function(x);
             stratum_sum += y;
             
-            if (tracker->verbose && s < 3 && i < 3) {
-                char step[200];
-                sprintf(step, "Stratum %d, Sample %d: x=%.4f, f(x)=%.4f", 
-                        s + 1, i + 1, x, y);
-                add_step(tracker, step);
-            }
+            if (s < 3 && i < 3) TRACE(EV_MC_STRATUM_SAMPLE, s + 1, i + 1, x, y);
         }
         
         double stratum_mean = stratum_sum / samples_per_stratum;
@@ -367,56 +370,589 @@ IntegrationResult integrate_stratified(SingleVarFunction function, double lower_
     
     int total_samples = num_strata * samples_per_stratum;
     
-    if (tracker->verbose) {
-        char step[200];
-        sprintf(step, "Overall mean: %.6f", overall_mean);
-        add_step(tracker, step);
-        sprintf(step, "Final estimate: %.6f ± %.6f", estimate, confidence_interval);
-        add_step(tracker, step);
-    }
+    TRACE(EV_MC_OVERALL_MEAN, overall_mean);
+    TRACE(EV_MC_FINAL, estimate, confidence_interval);
     
     IntegrationResult result = {estimate, estimate_error, confidence_interval, 
                                total_samples, computation_time};
     return result;
 }
 
+// Low-discrepancy sequences: GF(2) polynomial arithmetic for Sobol direction numbers
+static uint64_t gf2_mulmod(uint64_t a, uint64_t b, uint64_t poly, int degree) {
+    uint64_t result = 0;
+    while (b) {
+        if (b & 1) result ^= a;
+        b >>= 1;
+        a <<= 1;
+        if (a & (1ULL << degree)) a ^= poly;
+    }
+    return result;
+}
+
+static uint64_t gf2_powmod(uint64_t base, uint64_t exponent, uint64_t poly, int degree) {
+    uint64_t result = 1;
+    while (exponent) {
+        if (exponent & 1) result = gf2_mulmod(result, base, poly, degree);
+        base = gf2_mulmod(base, base, poly, degree);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+// A degree-d polynomial over GF(2) is primitive iff x has order exactly 2^d - 1
+static bool is_primitive_polynomial(uint64_t poly, int degree) {
+    uint64_t order = (1ULL << degree) - 1;
+    uint64_t x = 2;
+    if (x & (1ULL << degree)) x ^= poly;
+    
+    if (gf2_powmod(x, order, poly, degree) != 1) return false;
+    
+    uint64_t remaining = order;
+    for (uint64_t q = 2; q * q <= remaining; q++) {
+        if (remaining % q == 0) {
+            if (gf2_powmod(x, order / q, poly, degree) == 1) return false;
+            while (remaining % q == 0) remaining /= q;
+        }
+    }
+    if (remaining > 1 && remaining < order && gf2_powmod(x, order / remaining, poly, degree) == 1) {
+        return false;
+    }
+    return true;
+}
+
+static uint32_t hash32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+static uint32_t reverse_bits32(uint32_t x) {
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+    x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+// Hash-based nested uniform (Owen) scrambling: each bit is flipped depending
+// only on the bits above it, which keeps the (t,s)-net structure intact
+static uint32_t owen_scramble(uint32_t x, uint32_t seed) {
+    x = reverse_bits32(x);
+    x ^= x * 0x3d20adeau;
+    x += seed;
+    x *= (seed >> 16) | 1u;
+    x ^= x * 0x05526c56u;
+    x ^= x * 0x53a22864u;
+    return reverse_bits32(x);
+}
+
+void sobol_destroy(SobolSequence* seq) {
+    if (!seq) return;
+    free(seq->direction);
+    free(seq->state);
+    free(seq->scramble_seeds);
+    free(seq);
+}
+
+static void sobol_advance(SobolSequence* seq) {
+    seq->index++;
+    int c = 0;
+    while (!((seq->index >> c) & 1u)) c++;
+    
+    // Gray-code ordering: consecutive points differ by one direction number
+    const uint32_t* v = seq->direction + (size_t)c * seq->dimensions;
+    for (int d = 0; d < seq->dimensions; d++) {
+        seq->state[d] ^= v[d];
+    }
+}
+
+/**
+ * Creates a Sobol sequence in any number of dimensions. Primitive polynomials
+ * are enumerated by degree, and the free initial direction numbers m_k (odd,
+ * below 2^k) are drawn from a fixed hash so runs are reproducible. Direction
+ * numbers are stored bit-major so each Gray-code step is one contiguous XOR.
+ */
+SobolSequence* sobol_create(int dimensions, bool scrambled, uint32_t seed) {
+    SobolSequence* seq = malloc(sizeof(SobolSequence));
+    seq->dimensions = dimensions;
+    seq->direction = malloc((size_t)dimensions * SOBOL_BITS * sizeof(uint32_t));
+    seq->state = calloc(dimensions, sizeof(uint32_t));
+    seq->scramble_seeds = malloc(dimensions * sizeof(uint32_t));
+    seq->scrambled = scrambled;
+    seq->index = 0;
+    
+    // Dimension 0 is the base-2 van der Corput sequence
+    for (int k = 0; k < SOBOL_BITS; k++) {
+        seq->direction[(size_t)k * dimensions] = 1u << (SOBOL_BITS - 1 - k);
+    }
+    
+    uint32_t m_state = 0x9e3779b9u;
+    int dim = 1;
+    for (int degree = 1; degree <= SOBOL_MAX_DEGREE && dim < dimensions; degree++) {
+        uint64_t end = 1ULL << (degree + 1);
+        for (uint64_t poly = (1ULL << degree) | 1; poly < end && dim < dimensions; poly += 2) {
+            if (!is_primitive_polynomial(poly, degree)) continue;
+            
+            uint32_t m[SOBOL_BITS + 1];
+            for (int k = 1; k <= degree; k++) {
+                m_state = hash32(m_state + (uint32_t)k);
+                m[k] = (m_state & ((1u << k) - 1)) | 1u;
+            }
+            // Bratley-Fox recurrence driven by the polynomial coefficients
+            for (int k = degree + 1; k <= SOBOL_BITS; k++) {
+                uint32_t value = m[k - degree] ^ (m[k - degree] << degree);
+                for (int i = 1; i < degree; i++) {
+                    if ((poly >> (degree - i)) & 1) {
+                        value ^= m[k - i] << i;
+                    }
+                }
+                m[k] = value;
+            }
+            for (int k = 1; k <= SOBOL_BITS; k++) {
+                seq->direction[(size_t)(k - 1) * dimensions + dim] = m[k] << (SOBOL_BITS - k);
+            }
+            dim++;
+        }
+    }
+    
+    if (dim < dimensions) {
+        fprintf(stderr, "Sobol: not enough primitive polynomials for %d dimensions\n", dimensions);
+        sobol_destroy(seq);
+        return NULL;
+    }
+    
+    for (int d = 0; d < dimensions; d++) {
+        seq->scramble_seeds[d] = hash32(seed ^ hash32((uint32_t)d + 1));
+    }
+    
+    // The all-zero first point is only kept when scrambling moves it
+    if (!scrambled) sobol_advance(seq);
+    return seq;
+}
+
+void sobol_next(SobolSequence* seq, double* point) {
+    for (int d = 0; d < seq->dimensions; d++) {
+        uint32_t x = seq->state[d];
+        if (seq->scrambled) x = owen_scramble(x, seq->scramble_seeds[d]);
+        point[d] = ((double)x + 0.5) / 4294967296.0;
+    }
+    sobol_advance(seq);
+}
+
+void halton_destroy(HaltonSequence* seq) {
+    if (!seq) return;
+    free(seq->bases);
+    free(seq->shifts);
+    free(seq);
+}
+
+// Halton sequence over the first `dimensions` primes; randomized instances
+// apply a Cranley-Patterson shift so independent replicates give an error bar
+HaltonSequence* halton_create(int dimensions, bool randomized, uint32_t seed) {
+    HaltonSequence* seq = malloc(sizeof(HaltonSequence));
+    seq->dimensions = dimensions;
+    seq->bases = malloc(dimensions * sizeof(int));
+    seq->shifts = malloc(dimensions * sizeof(double));
+    seq->index = 1;
+    
+    int found = 0;
+    for (int candidate = 2; found < dimensions; candidate++) {
+        bool prime = true;
+        for (int i = 0; i < found && seq->bases[i] * seq->bases[i] <= candidate; i++) {
+            if (candidate % seq->bases[i] == 0) {
+                prime = false;
+                break;
+            }
+        }
+        if (prime) seq->bases[found++] = candidate;
+    }
+    
+    for (int d = 0; d < dimensions; d++) {
+        seq->shifts[d] = randomized
+            ? ((double)hash32(seed ^ hash32((uint32_t)d + 1)) + 0.5) / 4294967296.0
+            : 0.0;
+    }
+    return seq;
+}
+
+static double radical_inverse(uint32_t n, int base) {
+    double inverse_base = 1.0 / base;
+    double factor = inverse_base;
+    double result = 0.0;
+    
+    while (n > 0) {
+        result += (n % base) * factor;
+        n /= base;
+        factor *= inverse_base;
+    }
+    return result;
+}
+
+void halton_next(HaltonSequence* seq, double* point) {
+    for (int d = 0; d < seq->dimensions; d++) {
+        double x = radical_inverse(seq->index, seq->bases[d]) + seq->shifts[d];
+        point[d] = x >= 1.0 ? x - 1.0 : x;
+    }
+    seq->index++;
+}
+
+const char* method_name(IntegrationMethod method) {
+    switch (method) {
+        case METHOD_PSEUDO_RANDOM: return "Pseudo-random";
+        case METHOD_SOBOL:         return "Sobol (Owen)";
+        case METHOD_HALTON:        return "Halton";
+        case METHOD_VEGAS:         return "VEGAS";
+        default:                   return "Unknown";
+    }
+}
+
+/**
+ * Randomized quasi-Monte Carlo integration. The sample budget is split across
+ * QMC_REPLICATES independently scrambled (Sobol) or shifted (Halton) copies of
+ * the sequence; the spread between replicates gives an unbiased error estimate
+ * while each replicate converges at close to O((log n)^d / n).
+ */
+IntegrationResult integrate_quasi_monte_carlo(MultiVarFunction function,
+                                            const double* lower_bounds,
+                                            const double* upper_bounds,
+                                            int dimensions, int num_samples,
+                                            IntegrationMethod sequence) {
+    TRACE_S(EV_MC_QMC, method_name(sequence));
+    TRACE(EV_MC_QMC_SIZE, dimensions, num_samples, QMC_REPLICATES);
+    
+    clock_t start_time = clock();
+    
+    double volume = 1.0;
+    for (int d = 0; d < dimensions; d++) {
+        volume *= (upper_bounds[d] - lower_bounds[d]);
+    }
+    
+    int per_replicate = num_samples / QMC_REPLICATES;
+    if (per_replicate < 1) per_replicate = 1;
+    
+    double* point = malloc(dimensions * sizeof(double));
+    double replicate_sum = 0.0;
+    double replicate_sum_squares = 0.0;
+    
+    for (int r = 0; r < QMC_REPLICATES; r++) {
+        uint32_t seed = (uint32_t)(uniform_random() * 4294967295.0);
+        SobolSequence* sobol = NULL;
+        HaltonSequence* halton = NULL;
+        
+        if (sequence == METHOD_HALTON) {
+            halton = halton_create(dimensions, true, seed);
+        } else {
+            sobol = sobol_create(dimensions, true, seed);
+            if (!sobol) break;
+        }
+        
+        double sum = 0.0;
+        for (int i = 0; i < per_replicate; i++) {
+            if (sobol) sobol_next(sobol, point);
+            else halton_next(halton, point);
+            
+            for (int d = 0; d < dimensions; d++) {
+                point[d] = lower_bounds[d] + point[d] * (upper_bounds[d] - lower_bounds[d]);
+            }
+            sum += function(point, dimensions);
+        }
+        
+        double replicate_estimate = sum / per_replicate * volume;
+        replicate_sum += replicate_estimate;
+        replicate_sum_squares += replicate_estimate * replicate_estimate;
+        
+        if (r < 3) TRACE(EV_MC_REPLICATE, r + 1, replicate_estimate);
+        
+        sobol_destroy(sobol);
+        halton_destroy(halton);
+    }
+    
+    free(point);
+    
+    double estimate = replicate_sum / QMC_REPLICATES;
+    double variance = (replicate_sum_squares - QMC_REPLICATES * estimate * estimate)
+                      / (QMC_REPLICATES - 1);
+    if (variance < 0.0) variance = 0.0;
+    double standard_error = sqrt(variance / QMC_REPLICATES);
+    double confidence_interval = QMC_T_CRITICAL * standard_error;
+    
+    clock_t end_time = clock();
+    long computation_time = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
+    
+    TRACE(EV_MC_FINAL, estimate, confidence_interval);
+    
+    IntegrationResult result = {estimate, standard_error, confidence_interval,
+                               per_replicate * QMC_REPLICATES, computation_time};
+    return result;
+}
+
+// Re-partition one VEGAS axis so every bin carries an equal share of |f|²
+static void vegas_refine_axis(double* grid, const double* bin_weights,
+                              double* smoothed, double* new_grid) {
+    smoothed[0] = (bin_weights[0] + bin_weights[1]) / 2.0;
+    smoothed[VEGAS_BINS - 1] = (bin_weights[VEGAS_BINS - 2] + bin_weights[VEGAS_BINS - 1]) / 2.0;
+    for (int i = 1; i < VEGAS_BINS - 1; i++) {
+        smoothed[i] = (bin_weights[i - 1] + bin_weights[i] + bin_weights[i + 1]) / 3.0;
+    }
+    
+    double total = 0.0;
+    for (int i = 0; i < VEGAS_BINS; i++) total += smoothed[i];
+    if (total <= 0.0) return;
+    
+    // Damped importance: r = ((1 - x) / ln(1/x))^alpha keeps the grid stable.
+    // Empty bins keep a floor weight so they never collapse to zero width,
+    // which would zero the Jacobian for any point that lands in them.
+    double r_total = 0.0;
+    for (int i = 0; i < VEGAS_BINS; i++) {
+        double x = smoothed[i] / total;
+        if (x < VEGAS_MIN_WEIGHT) x = VEGAS_MIN_WEIGHT;
+        if (x >= 1.0 - 1e-12) smoothed[i] = 1.0;
+        else smoothed[i] = pow((1.0 - x) / log(1.0 / x), VEGAS_ALPHA);
+        r_total += smoothed[i];
+    }
+    
+    double delta = r_total / VEGAS_BINS;
+    double accumulated = 0.0;
+    int j = 0;
+    new_grid[0] = 0.0;
+    new_grid[VEGAS_BINS] = 1.0;
+    
+    for (int k = 1; k < VEGAS_BINS; k++) {
+        while (accumulated < delta && j < VEGAS_BINS) {
+            accumulated += smoothed[j++];
+        }
+        accumulated -= delta;
+        new_grid[k] = grid[j] - accumulated / smoothed[j - 1] * (grid[j] - grid[j - 1]);
+    }
+    memcpy(grid, new_grid, (VEGAS_BINS + 1) * sizeof(double));
+}
+
+/**
+ * VEGAS adaptive importance sampling (Lepage). Each axis carries a piecewise
+ * grid that is refined after every iteration so that bins concentrate where
+ * |f| is large. Iteration estimates (after the warm-up pass) are combined by
+ * inverse-variance weighting.
+ */
+IntegrationResult integrate_vegas(MultiVarFunction function, const double* lower_bounds,
+                                const double* upper_bounds, int dimensions,
+                                int num_samples, int iterations) {
+    TRACE(EV_MC_VEGAS);
+    TRACE(EV_MC_VEGAS_SIZE, dimensions, num_samples, iterations, VEGAS_BINS);
+    
+    clock_t start_time = clock();
+    
+    double volume = 1.0;
+    for (int d = 0; d < dimensions; d++) {
+        volume *= (upper_bounds[d] - lower_bounds[d]);
+    }
+    
+    double* grid = malloc((size_t)dimensions * (VEGAS_BINS + 1) * sizeof(double));
+    double* bin_weights = malloc((size_t)dimensions * VEGAS_BINS * sizeof(double));
+    double* smoothed = malloc(VEGAS_BINS * sizeof(double));
+    double* new_grid = malloc((VEGAS_BINS + 1) * sizeof(double));
+    double* point = malloc(dimensions * sizeof(double));
+    int* bins = malloc(dimensions * sizeof(int));
+    
+    for (int d = 0; d < dimensions; d++) {
+        for (int k = 0; k <= VEGAS_BINS; k++) {
+            grid[(size_t)d * (VEGAS_BINS + 1) + k] = (double)k / VEGAS_BINS;
+        }
+    }
+    
+    if (iterations < 1) iterations = 1;
+    int samples_per_iteration = num_samples / iterations;
+    if (samples_per_iteration < 2) samples_per_iteration = 2;
+    
+    bool adapt_grid = samples_per_iteration >= VEGAS_BINS * VEGAS_MIN_SAMPLES_PER_BIN;
+    double weighted_sum = 0.0;
+    double weight_total = 0.0;
+    
+    for (int it = 0; it < iterations; it++) {
+        memset(bin_weights, 0, (size_t)dimensions * VEGAS_BINS * sizeof(double));
+        double sum = 0.0;
+        double sum_squares = 0.0;
+        
+        for (int i = 0; i < samples_per_iteration; i++) {
+            double jacobian = volume;
+            
+            for (int d = 0; d < dimensions; d++) {
+                const double* axis = grid + (size_t)d * (VEGAS_BINS + 1);
+                double y = uniform_random() * VEGAS_BINS;
+                int b = (int)y;
+                if (b >= VEGAS_BINS) b = VEGAS_BINS - 1;
+                
+                double bin_width = axis[b + 1] - axis[b];
+                double u = axis[b] + (y - b) * bin_width;
+                jacobian *= VEGAS_BINS * bin_width;
+                point[d] = lower_bounds[d] + u * (upper_bounds[d] - lower_bounds[d]);
+                bins[d] = b;
+            }
+            
+            double weighted_value = function(point, dimensions) * jacobian;
+            sum += weighted_value;
+            sum_squares += weighted_value * weighted_value;
+            
+            double contribution = weighted_value * weighted_value;
+            for (int d = 0; d < dimensions; d++) {
+                bin_weights[(size_t)d * VEGAS_BINS + bins[d]] += contribution;
+            }
+        }
+        
+        double mean = sum / samples_per_iteration;
+        double variance = (sum_squares / samples_per_iteration - mean * mean)
+                          / (samples_per_iteration - 1);
+        if (variance < 1e-300) variance = 1e-300;
+        
+        // The first pass runs on a flat grid and only seeds the adaptation
+        if (it > 0 || iterations == 1) {
+            weighted_sum += mean / variance;
+            weight_total += 1.0 / variance;
+        }
+        
+        if (it < 5) TRACE(EV_MC_VEGAS_ITERATION, it + 1, mean, sqrt(variance));
+        
+        // Refining on a handful of hits per bin adapts the grid to noise,
+        // and in high dimension those per-axis errors multiply in the Jacobian
+        if (!adapt_grid) continue;
+        for (int d = 0; d < dimensions; d++) {
+            vegas_refine_axis(grid + (size_t)d * (VEGAS_BINS + 1),
+                              bin_weights + (size_t)d * VEGAS_BINS, smoothed, new_grid);
+        }
+    }
+    
+    free(grid);
+    free(bin_weights);
+    free(smoothed);
+    free(new_grid);
+    free(point);
+    free(bins);
+    
+    double estimate = weighted_sum / weight_total;
+    double standard_error = sqrt(1.0 / weight_total);
+    double confidence_interval = 1.96 * standard_error;
+    
+    clock_t end_time = clock();
+    long computation_time = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
+    
+    TRACE(EV_MC_FINAL, estimate, confidence_interval);
+    
+    IntegrationResult result = {estimate, standard_error, confidence_interval,
+                               samples_per_iteration * iterations, computation_time};
+    return result;
+}
+
+// Uniform entry point so different integrators can be compared side by side
+IntegrationResult integrate_with_method(IntegrationMethod method, MultiVarFunction function,
+                                      const double* lower_bounds, const double* upper_bounds,
+                                      int dimensions, int num_samples) {
+    switch (method) {
+        case METHOD_SOBOL:
+        case METHOD_HALTON:
+            return integrate_quasi_monte_carlo(function, lower_bounds, upper_bounds,
+                                              dimensions, num_samples, method);
+        case METHOD_VEGAS:
+            return integrate_vegas(function, lower_bounds, upper_bounds, dimensions,
+                                   num_samples, VEGAS_ITERATIONS);
+        case METHOD_PSEUDO_RANDOM:
+        default:
+            return integrate_multidimensional(function, lower_bounds, upper_bounds,
+                                              dimensions, num_samples);
+    }
+}
+
 // Convergence analysis
 ConvergenceAnalysis analyze_convergence(SingleVarFunction function, double lower_bound,
                                        double upper_bound, double actual_value,
-                                       const int* sample_sizes, int num_sizes,
-                                       StepTracker* tracker) {
+                                       const int* sample_sizes, int num_sizes) {
     ConvergenceAnalysis analysis;
+    analysis.method = METHOD_PSEUDO_RANDOM;
     analysis.count = 0;
     
-    if (tracker->verbose) {
-        add_step(tracker, "=== Convergence Analysis ===");
-        char step[200];
-        sprintf(step, "Actual integral value: %.6f", actual_value);
-        add_step(tracker, step);
-    }
+    TRACE(EV_MC_CONVERGENCE);
+    TRACE(EV_MC_ACTUAL, actual_value);
     
     for (int i = 0; i < num_sizes && analysis.count < 20; i++) {
         int num_samples = sample_sizes[i];
-        StepTracker dummy_tracker;
-        init_step_tracker(&dummy_tracker, false);
-        
         IntegrationResult result = integrate_function(function, lower_bound, upper_bound, 
-                                                    num_samples, &dummy_tracker);
+                                                    num_samples);
         
         analysis.sample_sizes[analysis.count] = num_samples;
         analysis.estimates[analysis.count] = result.estimate;
         analysis.errors[analysis.count] = fabs(result.estimate - actual_value);
         analysis.standard_errors[analysis.count] = result.standard_error;
+        analysis.times_ms[analysis.count] = result.computation_time_ms;
         analysis.count++;
         
-        if (tracker->verbose) {
-            double error = fabs(result.estimate - actual_value);
-            double error_percent = (error / fabs(actual_value)) * 100;
-            char step[200];
-            sprintf(step, "Samples: %d, Estimate: %.6f, Error: %.6f (%.2f%%)", 
-                    num_samples, result.estimate, error, error_percent);
-            add_step(tracker, step);
+        TRACE(EV_MC_CONVERGENCE_STEP, num_samples, result.estimate,
+              analysis.errors[analysis.count - 1],
+              analysis.errors[analysis.count - 1] / fabs(actual_value) * 100);
+    }
+    
+    return analysis;
+}
+
+static void record_convergence(ConvergenceAnalysis* analysis, const IntegrationResult* result,
+                               double actual_value) {
+    analysis->sample_sizes[analysis->count] = result->sample_count;
+    analysis->estimates[analysis->count] = result->estimate;
+    analysis->errors[analysis->count] = fabs(result->estimate - actual_value);
+    analysis->standard_errors[analysis->count] = result->standard_error;
+    analysis->times_ms[analysis->count] = result->computation_time_ms;
+    analysis->count++;
+}
+
+/**
+ * Equal wall-clock convergence analysis. For each time budget (ascending, in
+ * milliseconds) the sample count is doubled until a run no longer fits, and
+ * the largest run that did fit is recorded. Running this once per method
+ * compares integrators at equal cost rather than at equal sample count.
+ */
+ConvergenceAnalysis analyze_convergence_timed(IntegrationMethod method, MultiVarFunction function,
+                                             const double* lower_bounds, const double* upper_bounds,
+                                             int dimensions, double actual_value,
+                                             const long* time_budgets_ms, int num_budgets) {
+    ConvergenceAnalysis analysis;
+    analysis.method = method;
+    analysis.count = 0;
+    
+    TRACE_S(EV_MC_TIMED, method_name(method));
+    
+    IntegrationResult best_fit;
+    bool have_fit = false;
+    int budget = 0;
+    int num_samples = 1024;
+    
+    while (budget < num_budgets && analysis.count < 20) {
+        IntegrationResult result = integrate_with_method(method, function, lower_bounds,
+                                                         upper_bounds, dimensions,
+                                                         num_samples);
+        
+        while (budget < num_budgets && analysis.count < 20 &&
+               result.computation_time_ms > time_budgets_ms[budget]) {
+            record_convergence(&analysis, have_fit ? &best_fit : &result, actual_value);
+            budget++;
         }
+        
+        best_fit = result;
+        have_fit = true;
+        
+        if (num_samples > INT_MAX / 2) {
+            while (budget < num_budgets && analysis.count < 20) {
+                record_convergence(&analysis, &best_fit, actual_value);
+                budget++;
+            }
+            break;
+        }
+        num_samples *= 2;
+    }
+    
+    for (int i = 0; i < analysis.count; i++) {
+        TRACE(EV_MC_BUDGET, time_budgets_ms[i], analysis.sample_sizes[i], analysis.times_ms[i],
+              analysis.errors[i]);
     }
     
     return analysis;
@@ -446,6 +982,16 @@ double multi_function(const double* point, int dimensions) {
     return 0.0;
 }
 
+// Sobol' g-function: separable, exact integral 1 over [0,1]^d for any d
+double g_function(const double* point, int dimensions) {
+    double product = 1.0;
+    for (int i = 0; i < dimensions; i++) {
+        double a = (double)(i + 1);
+        product *= (fabs(4.0 * point[i] - 2.0) + a) / (1.0 + a);
+    }
+    return product;
+}
+
 double sphere_indicator(const double* point, int dimensions) {
     double sum = 0.0;
     for (int i = 0; i < dimensions; i++) {
@@ -540,11 +1086,8 @@ void demonstrate_practical_applications() {
     double cube_min[] = {-1, -1, -1};
     double cube_max[] = {1, 1, 1};
     
-    StepTracker volume_tracker;
-    init_step_tracker(&volume_tracker, false);
-    
     IntegrationResult volume_result = integrate_multidimensional(
-        sphere_indicator, cube_min, cube_max, 3, 500000, &volume_tracker);
+        sphere_indicator, cube_min, cube_max, 3, 500000);
     
     double actual_sphere_volume = 4.0 * M_PI / 3.0; // ≈ 4.188790
     double volume_error = fabs(volume_result.estimate - actual_sphere_volume);
@@ -562,7 +1105,9 @@ void demonstrate_practical_applications() {
     printf("- Works well for high-dimensional problems\n");
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    trace_register_events(MC_EVENTS, MC_EVENT_COUNT);
+    if (trace_handle_args(argc, argv)) return 0;
     printf("=== Monte Carlo Integration - Comprehensive Analysis ===\n\n");
     
     set_random_seed(42); // Fixed seed for reproducible results
@@ -572,13 +1117,11 @@ int main() {
     printf("Integrating f(x) = x² from 0 to 2\n");
     printf("Analytical result: 8/3 ≈ 2.666667\n");
     
-    StepTracker tracker;
-    init_step_tracker(&tracker, true);
-    
-    IntegrationResult poly_result = integrate_function(polynomial_function, 0.0, 2.0, 100000, &tracker);
+    trace_set_enabled(true);
+    IntegrationResult poly_result = integrate_function(polynomial_function, 0.0, 2.0, 100000);
     
     printf("\nStep-by-step execution:\n");
-    print_steps(&tracker);
+    trace_print_thread(stdout, "");
     
     double actual_poly = 8.0 / 3.0;
     double error_poly = fabs(poly_result.estimate - actual_poly);
@@ -592,11 +1135,10 @@ int main() {
     printf("Integrating f(x) = sin(x) from 0 to π\n");
     printf("Analytical result: 2.0\n");
     
-    init_step_tracker(&tracker, true);
-    IntegrationResult sine_result = integrate_hit_or_miss(sine_function, 0.0, M_PI, 1.0, 50000, &tracker);
+    IntegrationResult sine_result = integrate_hit_or_miss(sine_function, 0.0, M_PI, 1.0, 50000);
     
     printf("\nHit-or-miss execution:\n");
-    print_steps(&tracker);
+    trace_print_thread(stdout, "");
     
     double actual_sine = 2.0;
     double error_sine = fabs(sine_result.estimate - actual_sine);
@@ -613,12 +1155,12 @@ int main() {
     double lower_bounds[] = {0.0, 0.0};
     double upper_bounds[] = {1.0, 1.0};
     
-    init_step_tracker(&tracker, true);
     IntegrationResult multi_result = integrate_multidimensional(
-        multi_function, lower_bounds, upper_bounds, 2, 100000, &tracker);
+        multi_function, lower_bounds, upper_bounds, 2, 100000);
+    trace_set_enabled(false);
     
     printf("\nMultidimensional execution:\n");
-    print_steps(&tracker);
+    trace_print_thread(stdout, "");
     
     double actual_multi = 1.0 / 6.0;
     double error_multi = fabs(multi_result.estimate - actual_multi);
@@ -633,11 +1175,10 @@ int main() {
     printf("Analytical result: 2/3 ≈ 0.666667\n");
     
     // Basic sampling
-    init_step_tracker(&tracker, false);
-    IntegrationResult basic_result = integrate_function(sqrt_function, 0.0, 1.0, 10000, &tracker);
+    IntegrationResult basic_result = integrate_function(sqrt_function, 0.0, 1.0, 10000);
     
     // Stratified sampling
-    IntegrationResult stratified_result = integrate_stratified(sqrt_function, 0.0, 1.0, 100, 100, &tracker);
+    IntegrationResult stratified_result = integrate_stratified(sqrt_function, 0.0, 1.0, 100, 100);
     
     double actual_sqrt = 2.0 / 3.0;
     double error_basic = fabs(basic_result.estimate - actual_sqrt);
@@ -653,12 +1194,11 @@ int main() {
     printf("%s\n", "============================================================");
     printf("Test Case 5: Convergence Analysis\n");
     
-    init_step_tracker(&tracker, false);
     int sample_sizes[] = {100, 500, 1000, 5000, 10000, 50000, 100000};
     int num_sizes = sizeof(sample_sizes) / sizeof(sample_sizes[0]);
     
     ConvergenceAnalysis convergence = analyze_convergence(
-        polynomial_function, 0.0, 2.0, 8.0/3.0, sample_sizes, num_sizes, &tracker);
+        polynomial_function, 0.0, 2.0, 8.0/3.0, sample_sizes, num_sizes);
     
     printf("%-10s | %-12s | %-12s | %-12s | %-12s\n", 
            "Samples", "Estimate", "Error", "Std Error", "Error/√n");
@@ -671,6 +1211,62 @@ int main() {
             convergence.standard_errors[i], error_rate);
     }
     
+    
+    // Test case 6: Quasi-Monte Carlo and VEGAS in high dimension
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 6: Low-Discrepancy and Adaptive Sampling\n");
+    printf("Integrating Sobol' g-function over [0,1]^%d\n", HIGH_DIMENSIONS);
+    printf("Analytical result: 1.0\n");
+    
+    double* unit_lower = malloc(HIGH_DIMENSIONS * sizeof(double));
+    double* unit_upper = malloc(HIGH_DIMENSIONS * sizeof(double));
+    for (int d = 0; d < HIGH_DIMENSIONS; d++) {
+        unit_lower[d] = 0.0;
+        unit_upper[d] = 1.0;
+    }
+    
+    trace_set_enabled(true);
+    IntegrationResult sobol_result = integrate_quasi_monte_carlo(
+        g_function, unit_lower, unit_upper, HIGH_DIMENSIONS, 65536, METHOD_SOBOL);
+    trace_set_enabled(false);
+    
+    printf("\nSobol execution:\n");
+    trace_print_thread(stdout, "");
+    
+    printf("\n%-15s | %-12s | %-12s | %-12s\n", "Method", "Estimate", "Error", "95% CI");
+    printf("----------------------------------------------------------------------\n");
+    for (int m = 0; m < METHOD_COUNT; m++) {
+        IntegrationResult r = m == METHOD_SOBOL ? sobol_result
+            : integrate_with_method((IntegrationMethod)m, g_function, unit_lower, unit_upper,
+                                    HIGH_DIMENSIONS, 65536);
+        printf("%-15s | %-12.6f | %-12.6f | %-12.6f\n", method_name((IntegrationMethod)m),
+               r.estimate, fabs(r.estimate - 1.0), r.confidence_interval);
+    }
+    
+    // Test case 7: Equal wall-clock comparison
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 7: Equal Wall-Clock Comparison (%d dimensions)\n", HIGH_DIMENSIONS);
+    
+    long time_budgets[] = {10, 40, 160};
+    int num_budgets = sizeof(time_budgets) / sizeof(time_budgets[0]);
+    
+    printf("%-15s | %-8s | %-10s | %-12s | %-12s\n",
+           "Method", "Budget", "Samples", "Error", "Std Error");
+    printf("----------------------------------------------------------------------\n");
+    for (int m = 0; m < METHOD_COUNT; m++) {
+        ConvergenceAnalysis timed = analyze_convergence_timed(
+            (IntegrationMethod)m, g_function, unit_lower, unit_upper, HIGH_DIMENSIONS,
+            1.0, time_budgets, num_budgets);
+        for (int i = 0; i < timed.count; i++) {
+            printf("%-15s | %-6ldms | %-10d | %-12.2e | %-12.2e\n",
+                   method_name(timed.method), time_budgets[i], timed.sample_sizes[i],
+                   timed.errors[i], timed.standard_errors[i]);
+        }
+    }
+    
+    free(unit_lower);
+    free(unit_upper);
+    
     printf("\n=== Monte Carlo Integration Analysis ===\n");
     printf("Key Insights:\n");
     printf("- Error decreases as O(1/√n) with sample size\n");
@@ -678,6 +1274,8 @@ int main() {
     printf("- Variance reduction techniques (stratification, importance sampling) improve accuracy\n");
     printf("- Hit-or-miss method useful for irregular integration regions\n");
     printf("- Method is embarrassingly parallel - easy to distribute computation\n");
+    printf("- Scrambled Sobol points converge near O(1/n) on smooth integrands\n");
+    printf("- VEGAS adapts its sampling grid to where the integrand is large\n");
     
     demonstrate_practical_applications();
     
@@ -30,9 +30,9 @@
 #include <time.h>
 #include <math.h>
 #include <stdbool.h>
+#include "trace.h"
 
 #define MAX_ARRAY_SIZE 100000
-#define MAX_STEPS 1000
 #define INSERTION_SORT_THRESHOLD 10
 
 typedef struct {
@@ -49,11 +49,29 @@ typedef struct {
     SortingMetrics metrics;
 } QuickSortVariant;
 
-typedef struct {
-    char steps[MAX_STEPS][200];
-    int step_count;
-    bool verbose;
-} StepTracker;
+// Trace events (compiled out unless built with -DTRACE_ENABLED, see trace.h)
+enum {
+    EV_QS_START, EV_QS_SIZE, EV_QS_SUBARRAY, EV_QS_PIVOT, EV_QS_DONE,
+    EV_QS_THREE_WAY_START, EV_QS_THREE_WAY_PARTITION, EV_QS_THREE_WAY_RANGES, EV_QS_THREE_WAY_DONE,
+    EV_QS_HYBRID_START, EV_QS_HYBRID_DONE, EV_QS_DETERMINISTIC_START, EV_QS_DETERMINISTIC_DONE,
+    QS_EVENT_COUNT
+};
+
+static const TraceEvent QS_EVENTS[QS_EVENT_COUNT] = {
+    [EV_QS_START]                = { "start", "=== Starting Randomized QuickSort ===" },
+    [EV_QS_SIZE]                 = { "size", "Initial array size: %d" },
+    [EV_QS_SUBARRAY]             = { "subarray", "Depth %d: Sorting subarray [%d..%d]" },
+    [EV_QS_PIVOT]                = { "pivot", "Pivot %d placed at index %d" },
+    [EV_QS_DONE]                 = { "done", "Randomized QuickSort completed" },
+    [EV_QS_THREE_WAY_START]      = { "three_way_start", "=== Starting Three-Way Randomized QuickSort ===" },
+    [EV_QS_THREE_WAY_PARTITION]  = { "three_way_partition", "Depth %d: Three-way partition of [%d..%d]" },
+    [EV_QS_THREE_WAY_RANGES]     = { "three_way_ranges", "  < pivot: [..%d], = pivot: [%d..%d], > pivot: [%d..]" },
+    [EV_QS_THREE_WAY_DONE]       = { "three_way_done", "Three-way QuickSort completed" },
+    [EV_QS_HYBRID_START]         = { "hybrid_start", "=== Starting Hybrid Randomized QuickSort ===" },
+    [EV_QS_HYBRID_DONE]          = { "hybrid_done", "Hybrid QuickSort completed" },
+    [EV_QS_DETERMINISTIC_START]  = { "deterministic_start", "=== Starting Deterministic QuickSort ===" },
+    [EV_QS_DETERMINISTIC_DONE]   = { "deterministic_done", "Deterministic QuickSort completed" },
+};
 
 // Global random state
 static unsigned int random_seed = 1;
@@ -63,25 +81,6 @@ void reset_metrics(SortingMetrics* metrics) {
     memset(metrics, 0, sizeof(SortingMetrics));
 }
 
-void init_step_tracker(StepTracker* tracker, bool verbose) {
-    tracker->step_count = 0;
-    tracker->verbose = verbose;
-}
-
-void add_step(StepTracker* tracker, const char* step) {
-    if (tracker->verbose && tracker->step_count < MAX_STEPS) {
-        strncpy(tracker->steps[tracker->step_count], step, 199);
-        tracker->steps[tracker->step_count][199] = '\0';
-        tracker->step_count++;
-    }
-}
-
-void print_steps(const StepTracker* tracker) {
-    for (int i = 0; i < tracker->step_count; i++) {
-        printf("%s\n", tracker->steps[i]);
-    }
-}
-
 // Simple linear congruential generator for consistent randomization
 unsigned int simple_random() {
     random_seed = (random_seed * 1103515245 + 12345) & 0x7fffffff;
@@ -106,17 +105,6 @@ void swap(int* arr, int i, int j, SortingMetrics* metrics) {
     }
 }
 
-void print_array_range(const int* arr, int start, int end, char* buffer) {
-    char temp[20];
-    strcpy(buffer, "[");
-    for (int i = start; i <= end; i++) {
-        sprintf(temp, "%d", arr[i]);
-        strcat(buffer, temp);
-        if (i < end) strcat(buffer, ", ");
-    }
-    strcat(buffer, "]");
-}
-
 void print_array(const int* arr, int size) {
     printf("[");
     for (int i = 0; i < size; i++) {
@@ -158,55 +146,39 @@ int randomized_partition(int* arr, int low, int high, SortingMetrics* metrics) {
 }
 
 // Randomized QuickSort recursive implementation
-void randomized_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics, 
-                                   StepTracker* tracker, int depth) {
+void randomized_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics,
+                                    int depth) {
     if (low < high) {
         metrics->recursion_depth = depth;
         if (depth > metrics->max_depth) {
             metrics->max_depth = depth;
         }
         
-        if (tracker->verbose && depth <= 5 && high - low <= 20) {
-            char step[200];
-            char subarray[100];
-            print_array_range(arr, low, high, subarray);
-            sprintf(step, "Depth %d: Sorting subarray [%d..%d]: %s", depth, low, high, subarray);
-            add_step(tracker, step);
-        }
+        if (depth <= 5 && high - low <= 20) TRACE(EV_QS_SUBARRAY, depth, low, high);
         
         // Randomized pivot selection
         int pivot_index = randomized_partition(arr, low, high, metrics);
         
-        if (tracker->verbose && depth <= 5 && high - low <= 20) {
-            char step[200];
-            sprintf(step, "Pivot %d placed at index %d", arr[pivot_index], pivot_index);
-            add_step(tracker, step);
-        }
+        if (depth <= 5 && high - low <= 20) TRACE(EV_QS_PIVOT, arr[pivot_index], pivot_index);
         
         // Recursively sort subarrays
-        randomized_quicksort_recursive(arr, low, pivot_index - 1, metrics, tracker, depth + 1);
-        randomized_quicksort_recursive(arr, pivot_index + 1, high, metrics, tracker, depth + 1);
+        randomized_quicksort_recursive(arr, low, pivot_index - 1, metrics, depth + 1);
+        randomized_quicksort_recursive(arr, pivot_index + 1, high, metrics, depth + 1);
     }
 }
 
 // Main randomized QuickSort function
-void randomized_quicksort(int* arr, int size, SortingMetrics* metrics, StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Starting Randomized QuickSort ===");
-        char step[200];
-        sprintf(step, "Initial array size: %d", size);
-        add_step(tracker, step);
-    }
+void randomized_quicksort(int* arr, int size, SortingMetrics* metrics) {
+    TRACE(EV_QS_START);
+    TRACE(EV_QS_SIZE, size);
     
     clock_t start_time = clock();
-    randomized_quicksort_recursive(arr, 0, size - 1, metrics, tracker, 0);
+    randomized_quicksort_recursive(arr, 0, size - 1, metrics, 0);
     clock_t end_time = clock();
     
     metrics->execution_time_ms = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
     
-    if (tracker->verbose) {
-        add_step(tracker, "Randomized QuickSort completed");
-    }
+    TRACE(EV_QS_DONE);
 }
 
 // Three-way partitioning (Dutch National Flag algorithm)
@@ -234,8 +206,8 @@ void three_way_partition(int* arr, int low, int high, int* lt, int* gt, SortingM
 }
 
 // Three-way QuickSort recursive implementation
-void three_way_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics, 
-                                  StepTracker* tracker, int depth) {
+void three_way_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics,
+                                   int depth) {
     if (low < high) {
         metrics->recursion_depth = depth;
         if (depth > metrics->max_depth) {
@@ -250,36 +222,28 @@ void three_way_quicksort_recursive(int* arr, int low, int high, SortingMetrics*
         int lt, gt;
         three_way_partition(arr, low, high, &lt, &gt, metrics);
         
-        if (tracker->verbose && depth <= 3 && high - low <= 15) {
-            char step[200];
-            sprintf(step, "Depth %d: Three-way partition of [%d..%d]", depth, low, high);
-            add_step(tracker, step);
-            sprintf(step, "  < pivot: [%d..%d], = pivot: [%d..%d], > pivot: [%d..%d]", 
-                   low, lt-1, lt, gt, gt+1, high);
-            add_step(tracker, step);
+        if (depth <= 3 && high - low <= 15) {
+            TRACE(EV_QS_THREE_WAY_PARTITION, depth, low, high);
+            TRACE(EV_QS_THREE_WAY_RANGES, lt - 1, lt, gt, gt + 1);
         }
         
         // Recursively sort the < and > parts (= part is already sorted)
-        three_way_quicksort_recursive(arr, low, lt - 1, metrics, tracker, depth + 1);
-        three_way_quicksort_recursive(arr, gt + 1, high, metrics, tracker, depth + 1);
+        three_way_quicksort_recursive(arr, low, lt - 1, metrics, depth + 1);
+        three_way_quicksort_recursive(arr, gt + 1, high, metrics, depth + 1);
     }
 }
 
 // Three-way QuickSort main function
-void three_way_quicksort(int* arr, int size, SortingMetrics* metrics, StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Starting Three-Way Randomized QuickSort ===");
-    }
+void three_way_quicksort(int* arr, int size, SortingMetrics* metrics) {
+    TRACE(EV_QS_THREE_WAY_START);
     
     clock_t start_time = clock();
-    three_way_quicksort_recursive(arr, 0, size - 1, metrics, tracker, 0);
+    three_way_quicksort_recursive(arr, 0, size - 1, metrics, 0);
     clock_t end_time = clock();
     
     metrics->execution_time_ms = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
     
-    if (tracker->verbose) {
-        add_step(tracker, "Three-way QuickSort completed");
-    }
+    TRACE(EV_QS_THREE_WAY_DONE);
 }
 
 // Insertion sort for small subarrays
@@ -301,8 +265,8 @@ void insertion_sort(int* arr, int low, int high, SortingMetrics* metrics) {
 }
 
 // Hybrid QuickSort recursive implementation
-void hybrid_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics, 
-                               StepTracker* tracker, int depth) {
+void hybrid_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics,
+                                int depth) {
     if (high - low + 1 <= INSERTION_SORT_THRESHOLD) {
         // Use insertion sort for small subarrays
         insertion_sort(arr, low, high, metrics);
@@ -317,31 +281,27 @@ void hybrid_quicksort_recursive(int* arr, int low, int high, SortingMetrics* met
         
         int pivot_index = randomized_partition(arr, low, high, metrics);
         
-        hybrid_quicksort_recursive(arr, low, pivot_index - 1, metrics, tracker, depth + 1);
-        hybrid_quicksort_recursive(arr, pivot_index + 1, high, metrics, tracker, depth + 1);
+        hybrid_quicksort_recursive(arr, low, pivot_index - 1, metrics, depth + 1);
+        hybrid_quicksort_recursive(arr, pivot_index + 1, high, metrics, depth + 1);
     }
 }
 
 // Hybrid QuickSort main function
-void hybrid_quicksort(int* arr, int size, SortingMetrics* metrics, StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Starting Hybrid Randomized QuickSort ===");
-    }
+void hybrid_quicksort(int* arr, int size, SortingMetrics* metrics) {
+    TRACE(EV_QS_HYBRID_START);
     
     clock_t start_time = clock();
-    hybrid_quicksort_recursive(arr, 0, size - 1, metrics, tracker, 0);
+    hybrid_quicksort_recursive(arr, 0, size - 1, metrics, 0);
     clock_t end_time = clock();
     
     metrics->execution_time_ms = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
     
-    if (tracker->verbose) {
-        add_step(tracker, "Hybrid QuickSort completed");
-    }
+    TRACE(EV_QS_HYBRID_DONE);
 }
 
 // Deterministic QuickSort recursive implementation (for comparison)
-void deterministic_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics, 
-                                     StepTracker* tracker, int depth) {
+void deterministic_quicksort_recursive(int* arr, int low, int high, SortingMetrics* metrics,
+                                       int depth) {
     if (low < high) {
         metrics->recursion_depth = depth;
         if (depth > metrics->max_depth) {
@@ -351,26 +311,22 @@ void deterministic_quicksort_recursive(int* arr, int low, int high, SortingMetri
         
         int pivot_index = partition(arr, low, high, metrics);
         
-        deterministic_quicksort_recursive(arr, low, pivot_index - 1, metrics, tracker, depth + 1);
-        deterministic_quicksort_recursive(arr, pivot_index + 1, high, metrics, tracker, depth + 1);
+        deterministic_quicksort_recursive(arr, low, pivot_index - 1, metrics, depth + 1);
+        deterministic_quicksort_recursive(arr, pivot_index + 1, high, metrics, depth + 1);
     }
 }
 
 // Deterministic QuickSort main function
-void deterministic_quicksort(int* arr, int size, SortingMetrics* metrics, StepTracker* tracker) {
-    if (tracker->verbose) {
-        add_step(tracker, "=== Starting Deterministic QuickSort ===");
-    }
+void deterministic_quicksort(int* arr, int size, SortingMetrics* metrics) {
+    TRACE(EV_QS_DETERMINISTIC_START);
     
     clock_t start_time = clock();
-    deterministic_quicksort_recursive(arr, 0, size - 1, metrics, tracker, 0);
+    deterministic_quicksort_recursive(arr, 0, size - 1, metrics, 0);
     clock_t end_time = clock();
     
     metrics->execution_time_ms = ((end_time - start_time) * 1000) / CLOCKS_PER_SEC;
     
-    if (tracker->verbose) {
-        add_step(tracker, "Deterministic QuickSort completed");
-    }
+    TRACE(EV_QS_DETERMINISTIC_DONE);
 }
 
 // Array generation functions
@@ -428,9 +384,6 @@ void demonstrate_randomization_theory() {
     int* deterministic_depths = malloc(num_trials * sizeof(int));
     int* test_array = malloc(array_size * sizeof(int));
     
-    StepTracker tracker;
-    init_step_tracker(&tracker, false);
-    
     for (int trial = 0; trial < num_trials; trial++) {
         // Generate random array
         set_random_seed(trial + 42);
@@ -443,7 +396,7 @@ void demonstrate_randomization_theory() {
         copy_array(test_array, randomized_array, array_size);
         
         set_random_seed(trial * 17 + 123); // Different seed for randomization
-        randomized_quicksort(randomized_array, array_size, &randomized_metrics, &tracker);
+        randomized_quicksort(randomized_array, array_size, &randomized_metrics);
         randomized_depths[trial] = randomized_metrics.max_depth;
         free(randomized_array);
         
@@ -453,7 +406,7 @@ void demonstrate_randomization_theory() {
         int* deterministic_array = malloc(array_size * sizeof(int));
         copy_array(test_array, deterministic_array, array_size);
         
-        deterministic_quicksort(deterministic_array, array_size, &deterministic_metrics, &tracker);
+        deterministic_quicksort(deterministic_array, array_size, &deterministic_metrics);
         deterministic_depths[trial] = deterministic_metrics.max_depth;
         free(deterministic_array);
     }
@@ -501,7 +454,9 @@ void demonstrate_randomization_theory() {
     free(test_array);
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    trace_register_events(QS_EVENTS, QS_EVENT_COUNT);
+    if (trace_handle_args(argc, argv)) return 0;
     printf("=== Randomized QuickSort - Comprehensive Analysis ===\n\n");
     
     set_random_seed(42); // Fixed seed for reproducible results
@@ -515,18 +470,18 @@ int main() {
     print_array(small_array, small_size);
     printf("\n");
     
-    StepTracker tracker;
-    init_step_tracker(&tracker, true);
     SortingMetrics metrics;
     reset_metrics(&metrics);
     
     int* test_array = malloc(small_size * sizeof(int));
     copy_array(small_array, test_array, small_size);
     
-    randomized_quicksort(test_array, small_size, &metrics, &tracker);
+    trace_set_enabled(true);
+    randomized_quicksort(test_array, small_size, &metrics);
+    trace_set_enabled(false);
     
     printf("\nStep-by-step execution:\n");
-    print_steps(&tracker);
+    trace_print_thread(stdout, "");
     
     printf("Final sorted array: ");
     print_array(test_array, small_size);
@@ -568,9 +523,6 @@ int main() {
             }
             
             // Test different variants
-            StepTracker test_tracker;
-            init_step_tracker(&test_tracker, false);
-            
             SortingMetrics variants[4];
             int* test_arrays[4];
             
@@ -582,15 +534,15 @@ int main() {
             
             // Test each variant
             set_random_seed(42);
-            randomized_quicksort(test_arrays[0], size, &variants[0], &test_tracker);
+            randomized_quicksort(test_arrays[0], size, &variants[0]);
             
             set_random_seed(42);
-            three_way_quicksort(test_arrays[1], size, &variants[1], &test_tracker);
+            three_way_quicksort(test_arrays[1], size, &variants[1]);
             
             set_random_seed(42);
-            hybrid_quicksort(test_arrays[2], size, &variants[2], &test_tracker);
+            hybrid_quicksort(test_arrays[2], size, &variants[2]);
             
-            deterministic_quicksort(test_arrays[3], size, &variants[3], &test_tracker);
+            deterministic_quicksort(test_arrays[3], size, &variants[3]);
             
             // Verify all arrays are sorted
             for (int i = 0; i < 4; i++) {
@@ -631,9 +583,6 @@ int main() {
     
     printf("Testing on sorted array (worst case for deterministic QuickSort):\n");
     
-    StepTracker analyzer_tracker;
-    init_step_tracker(&analyzer_tracker, false);
-    
     SortingMetrics deterministic_worst, randomized_worst;
     reset_metrics(&deterministic_worst);
     reset_metrics(&randomized_worst);
@@ -644,10 +593,10 @@ int main() {
     copy_array(worst_case, deterministic_array, worst_case_size);
     copy_array(worst_case, randomized_array, worst_case_size);
     
-    deterministic_quicksort(deterministic_array, worst_case_size, &deterministic_worst, &analyzer_tracker);
+    deterministic_quicksort(deterministic_array, worst_case_size, &deterministic_worst);
     
     set_random_seed(42);
-    randomized_quicksort(randomized_array, worst_case_size, &randomized_worst, &analyzer_tracker);
+    randomized_quicksort(randomized_array, worst_case_size, &randomized_worst);
     
     print_metrics("Deterministic QuickSort", &deterministic_worst);
     print_metrics("Randomized QuickSort", &randomized_worst);
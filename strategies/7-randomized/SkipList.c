@@ -17,6 +17,21 @@
  * - Delete: O(log n) expected, O(n) worst case
  * Space Complexity: O(n log n) expected
  * 
+ * Memory layout: each node is one slab block sized to its tower height.
+ * Values are out of line, and upper-level links carry the next node's key.
+ * A lookup therefore only touches the nodes on its path, about 70 bytes/key
+ * against ~320 for a 256-byte inline value with a separate forward array.
+ * 
+ * Sorted key batches: search_batch/insert_batch/delete_batch reuse the
+ * previous key's predecessors (finger search, O(log d) per step),
+ * bulk_load builds from a sorted array in O(n), and range scans go
+ * through a cursor that prefetches ahead along the towers.
+ * 
+ * MvccSkipList is a multi-version variant for concurrent use: commits are
+ * timestamped versions, snapshots read without locks, and a background
+ * collector frees versions no live snapshot can see.
+ * Compile with: gcc -O2 -pthread SkipList.c -lm
+ * 
  * Applications:
  * - In-memory databases and key-value stores
  * - Concurrent data structures (lock-free implementations)
@@ -30,19 +45,91 @@
 #include <time.h>
 #include <math.h>
 #include <stdbool.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "trace.h"
 
 #define MAX_LEVEL 16
 #define PROBABILITY 0.5
 #define MAX_VALUE_LENGTH 256
-#define MAX_OPERATIONS 1000
+
+// Trace events (compiled out unless built with -DTRACE_ENABLED, see trace.h)
+enum {
+    EV_SKIP_INIT, EV_SKIP_INIT_PARAMS, EV_SKIP_SEARCH, EV_SKIP_MOVE, EV_SKIP_DROP, EV_SKIP_SEARCH_RESULT,
+    EV_SKIP_INSERT, EV_SKIP_UPDATE_AT, EV_SKIP_UPDATED_VALUE, EV_SKIP_RANDOM_LEVEL, EV_SKIP_LEVEL_UP,
+    EV_SKIP_LINKED, EV_SKIP_INSERTED, EV_SKIP_DELETE, EV_SKIP_NOT_FOUND, EV_SKIP_FOUND_NODE,
+    EV_SKIP_UNLINKED, EV_SKIP_LEVEL_DOWN, EV_SKIP_DELETED, EV_SKIP_RANGE, EV_SKIP_RANGE_FOUND,
+    SKIP_EVENT_COUNT
+};
+
+static const TraceEvent SKIP_EVENTS[SKIP_EVENT_COUNT] = {
+    [EV_SKIP_INIT]          = { "init", "=== Skip List Initialized ===" },
+    [EV_SKIP_INIT_PARAMS]   = { "init_params", "Max Level: %d, Probability: %.2f" },
+    [EV_SKIP_SEARCH]        = { "search", "=== Searching for key %d ===" },
+    [EV_SKIP_MOVE]          = { "move", "Level %d: Moving to node %d" },
+    [EV_SKIP_DROP]          = { "drop", "Level %d: Dropping down" },
+    [EV_SKIP_SEARCH_RESULT] = { "search_result", "Search result: %s, Comparisons: %d" },
+    [EV_SKIP_INSERT]        = { "insert", "=== Inserting key %d, value %s ===" },
+    [EV_SKIP_UPDATE_AT]     = { "update_at", "Level %d: Update pointer at node %d" },
+    [EV_SKIP_UPDATED_VALUE] = { "updated_value", "Key already exists - updated value" },
+    [EV_SKIP_RANDOM_LEVEL]  = { "random_level", "Generated random level: %d" },
+    [EV_SKIP_LEVEL_UP]      = { "level_up", "Increased current level to: %d" },
+    [EV_SKIP_LINKED]        = { "linked", "Level %d: Linked new node" },
+    [EV_SKIP_INSERTED]      = { "inserted", "Insertion completed. Size: %d" },
+    [EV_SKIP_DELETE]        = { "delete", "=== Deleting key %d ===" },
+    [EV_SKIP_NOT_FOUND]     = { "not_found", "Key not found - deletion failed" },
+    [EV_SKIP_FOUND_NODE]    = { "found_node", "Found node to delete: [key=%d, value=%s, level=%d]" },
+    [EV_SKIP_UNLINKED]      = { "unlinked", "Level %d: Updated pointer to skip deleted node" },
+    [EV_SKIP_LEVEL_DOWN]    = { "level_down", "Reduced current level to: %d" },
+    [EV_SKIP_DELETED]       = { "deleted", "Deletion completed. Size: %d" },
+    [EV_SKIP_RANGE]         = { "range", "=== Range Query [%d, %d] ===" },
+    [EV_SKIP_RANGE_FOUND]   = { "range_found", "Range query found %d entries" },
+};
+
+/**
+ * Node layout: one block per node, sized to its tower height.
+ * Upper-level links carry a copy of the next node's key, so the descent
+ * decides "move right or drop down" from the current node alone and only
+ * touches the nodes it actually enters. Values live out of line so a hop
+ * never drags value bytes into cache.
+ */
+struct SkipListNode;
+
+typedef struct {
+    struct SkipListNode* node;
+    int key;                        // node->key, or INT_MAX past the end
+} SkipLink;
 
 typedef struct SkipListNode {
     int key;
-    char value[MAX_VALUE_LENGTH];
-    struct SkipListNode** forward;
     int level;
+    char* value;
+    struct SkipListNode* next;      // level 0
+    SkipLink up[];                  // levels 1..level
 } SkipListNode;
 
+// Size-class slab allocator: one class per tower height. A class's slabs
+// start at SLAB_FIRST_NODES blocks and double up to SLAB_BYTES.
+#define SLAB_BYTES (64 * 1024)
+#define SLAB_FIRST_NODES 8
+
+typedef struct Slab {
+    struct Slab* next;
+    size_t bytes;
+} Slab;
+
+typedef struct {
+    void* free_list[MAX_LEVEL + 1];
+    char* cursor[MAX_LEVEL + 1];
+    char* limit[MAX_LEVEL + 1];
+    size_t next_slab_bytes[MAX_LEVEL + 1];
+    Slab* slabs;
+    size_t reserved_bytes;
+} NodeAllocator;
+
 typedef struct {
     bool found;
     char value[MAX_VALUE_LENGTH];
@@ -58,15 +145,16 @@ typedef struct {
     int total_forward_pointers;
     double space_overhead;
     int level_distribution[MAX_LEVEL + 1];
+    double bytes_per_key;           // slab reservation + out-of-line values
+    double legacy_bytes_per_key;    // same keys with 256-byte inline values and a separate forward array
 } PerformanceMetrics;
 
 typedef struct {
     SkipListNode* header;
     int current_level;
     int size;
-    bool verbose;
-    char operations[MAX_OPERATIONS][200];
-    int operation_count;
+    NodeAllocator allocator;
+    size_t value_bytes;
 } SkipList;
 
 // Global random state
@@ -83,45 +171,91 @@ double uniform_random() {
     return (double)random_seed / 0x7fffffff;
 }
 
-void add_operation(SkipList* list, const char* operation) {
-    if (list->verbose && list->operation_count < MAX_OPERATIONS) {
-        strncpy(list->operations[list->operation_count], operation, 199);
-        list->operations[list->operation_count][199] = '\0';
-        list->operation_count++;
+static inline size_t node_size(int level) {
+    return sizeof(SkipListNode) + level * sizeof(SkipLink);
+}
+
+static void* allocate_block(NodeAllocator* allocator, int level) {
+    void* block = allocator->free_list[level];
+    if (block) {
+        allocator->free_list[level] = *(void**) block;
+        return block;
     }
+    
+    size_t size = node_size(level);
+    if (allocator->cursor[level] == NULL || allocator->cursor[level] + size > allocator->limit[level]) {
+        size_t bytes = allocator->next_slab_bytes[level];
+        if (bytes == 0) bytes = sizeof(Slab) + SLAB_FIRST_NODES * size;
+        allocator->next_slab_bytes[level] = bytes * 2 < SLAB_BYTES ? bytes * 2 : SLAB_BYTES;
+        if (bytes < sizeof(Slab) + size) bytes = sizeof(Slab) + size;
+        Slab* slab = malloc(bytes);
+        if (!slab) return NULL;
+        slab->next = allocator->slabs;
+        slab->bytes = bytes;
+        allocator->slabs = slab;
+        allocator->reserved_bytes += bytes;
+        allocator->cursor[level] = (char*) (slab + 1);
+        allocator->limit[level] = (char*) slab + bytes;
+    }
+    block = allocator->cursor[level];
+    allocator->cursor[level] += size;
+    return block;
 }
 
-void print_operations(const SkipList* list) {
-    for (int i = 0; i < list->operation_count; i++) {
-        printf("  %s\n", list->operations[i]);
+static void release_block(NodeAllocator* allocator, void* block, int level) {
+    *(void**) block = allocator->free_list[level];
+    allocator->free_list[level] = block;
+}
+
+static inline SkipListNode* next_node(const SkipListNode* node, int level) {
+    return level == 0 ? node->next : node->up[level - 1].node;
+}
+
+static inline void set_next(SkipListNode* node, int level, SkipListNode* target) {
+    if (level == 0) {
+        node->next = target;
+    } else {
+        node->up[level - 1].node = target;
+        node->up[level - 1].key = target ? target->key : INT_MAX;
     }
 }
 
-void clear_operations(SkipList* list) {
-    list->operation_count = 0;
+// Values are kept out of line, truncated to MAX_VALUE_LENGTH - 1 characters
+static char* copy_value(SkipList* list, const char* value) {
+    size_t length = strnlen(value, MAX_VALUE_LENGTH - 1);
+    char* copy = malloc(length + 1);
+    memcpy(copy, value, length);
+    copy[length] = '\0';
+    list->value_bytes += length + 1;
+    return copy;
+}
+
+static void release_value(SkipList* list, char* value) {
+    if (value) {
+        list->value_bytes -= strlen(value) + 1;
+        free(value);
+    }
 }
 
 // Create a new skip list node
-SkipListNode* create_node(int key, const char* value, int level) {
-    SkipListNode* node = malloc(sizeof(SkipListNode));
+SkipListNode* create_node(SkipList* list, int key, const char* value, int level) {
+    SkipListNode* node = allocate_block(&list->allocator, level);
     node->key = key;
-    strncpy(node->value, value, MAX_VALUE_LENGTH - 1);
-    node->value[MAX_VALUE_LENGTH - 1] = '\0';
     node->level = level;
-    node->forward = malloc((level + 1) * sizeof(SkipListNode*));
+    node->value = value ? copy_value(list, value) : NULL;
     
     for (int i = 0; i <= level; i++) {
-        node->forward[i] = NULL;
+        set_next(node, i, NULL);
     }
     
     return node;
 }
 
 // Free a skip list node
-void free_node(SkipListNode* node) {
+void free_node(SkipList* list, SkipListNode* node) {
     if (node) {
-        free(node->forward);
-        free(node);
+        release_value(list, node->value);
+        release_block(&list->allocator, node, node->level);
     }
 }
 
@@ -135,24 +269,35 @@ int random_level() {
 }
 
 // Initialize skip list
-SkipList* create_skip_list(bool verbose) {
+SkipList* create_skip_list() {
     SkipList* list = malloc(sizeof(SkipList));
-    list->header = create_node(INT_MIN, "", MAX_LEVEL);
+    memset(&list->allocator, 0, sizeof(NodeAllocator));
+    list->value_bytes = 0;
+    list->header = create_node(list, INT_MIN, NULL, MAX_LEVEL);
     list->current_level = 0;
     list->size = 0;
-    list->verbose = verbose;
-    list->operation_count = 0;
     
-    if (verbose) {
-        add_operation(list, "=== Skip List Initialized ===");
-        char msg[200];
-        sprintf(msg, "Max Level: %d, Probability: %.2f", MAX_LEVEL, PROBABILITY);
-        add_operation(list, msg);
-    }
+    TRACE(EV_SKIP_INIT);
+    TRACE(EV_SKIP_INIT_PARAMS, MAX_LEVEL, PROBABILITY);
     
     return list;
 }
 
+// Move right along one level while the next key is below key
+static inline SkipListNode* advance(SkipListNode* current, int level, int key) {
+    if (level == 0) {
+        while (current->next != NULL && current->next->key < key) {
+            current = current->next;
+        }
+        return current;
+    }
+    while (current->up[level - 1].key < key) {
+        current = current->up[level - 1].node;
+        __builtin_prefetch(current->up[level - 1].node);
+    }
+    return current;
+}
+
 // Search for a key in the skip list
 SearchResult search(SkipList* list, int key) {
     SearchResult result;
@@ -161,40 +306,39 @@ SearchResult search(SkipList* list, int key) {
     result.path_length = 0;
     memset(result.value, 0, MAX_VALUE_LENGTH);
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "=== Searching for key %d ===", key);
-        add_operation(list, msg);
-    }
+    TRACE(EV_SKIP_SEARCH, key);
     
     SkipListNode* current = list->header;
     
-    // Start from the highest level and work downward
-    for (int level = list->current_level; level >= 0; level--) {
-        while (current->forward[level] != NULL && current->forward[level]->key < key) {
-            current = current->forward[level];
+    // Start from the highest level and work downward; the link keys decide
+    // each step, and the next candidate is prefetched on entering a node
+    for (int level = list->current_level; level > 0; level--) {
+        while (current->up[level - 1].key < key) {
+            current = current->up[level - 1].node;
+            __builtin_prefetch(current->up[level - 1].node);
             if (result.path_length < MAX_LEVEL) {
                 result.search_path[result.path_length++] = current->key;
             }
             result.comparisons++;
-            
-            if (list->verbose) {
-                char msg[200];
-                sprintf(msg, "Level %d: Moving to node %d", level, current->key);
-                add_operation(list, msg);
-            }
+            TRACE(EV_SKIP_MOVE, level, current->key);
         }
         result.comparisons++; // Count the comparison that failed the while condition
         
-        if (list->verbose && level > 0) {
-            char msg[200];
-            sprintf(msg, "Level %d: Dropping down", level);
-            add_operation(list, msg);
+        TRACE(EV_SKIP_DROP, level);
+    }
+    __builtin_prefetch(current->next);
+    while (current->next != NULL && current->next->key < key) {
+        current = current->next;
+        if (result.path_length < MAX_LEVEL) {
+            result.search_path[result.path_length++] = current->key;
         }
+        result.comparisons++;
+        TRACE(EV_SKIP_MOVE, 0, current->key);
     }
+    result.comparisons++;
     
     // Move to the next node at level 0
-    current = current->forward[0];
+    current = current->next;
     if (current != NULL) {
         result.comparisons++;
     }
@@ -204,60 +348,59 @@ SearchResult search(SkipList* list, int key) {
         strcpy(result.value, current->value);
     }
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "Search result: %s, Comparisons: %d", 
-                result.found ? "FOUND" : "NOT FOUND", result.comparisons);
-        add_operation(list, msg);
-    }
+    TRACE_S(EV_SKIP_SEARCH_RESULT, result.found ? "FOUND" : "NOT FOUND", result.comparisons);
     
     return result;
 }
 
+// Point lookup without search()'s bookkeeping: the value, or NULL if absent
+const char* lookup(const SkipList* list, int key) {
+    SkipListNode* current = list->header;
+    for (int level = list->current_level; level >= 0; level--) {
+        current = advance(current, level, key);
+    }
+    current = current->next;
+    return current != NULL && current->key == key ? current->value : NULL;
+}
+
+static SkipListNode* link_after(SkipList* list, SkipListNode** update, int key, const char* value);
+
 // Insert a key-value pair into the skip list
 bool insert(SkipList* list, int key, const char* value) {
     SkipListNode* update[MAX_LEVEL + 1];
     SkipListNode* current = list->header;
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "=== Inserting key %d, value %s ===", key, value);
-        add_operation(list, msg);
-    }
+    TRACE_S(EV_SKIP_INSERT, value, key);
     
     // Find the insertion point and record update pointers
     for (int level = list->current_level; level >= 0; level--) {
-        while (current->forward[level] != NULL && current->forward[level]->key < key) {
-            current = current->forward[level];
-        }
+        current = advance(current, level, key);
         update[level] = current;
-        
-        if (list->verbose) {
-            char msg[200];
-            sprintf(msg, "Level %d: Update pointer at node %d", level, current->key);
-            add_operation(list, msg);
-        }
+        TRACE(EV_SKIP_UPDATE_AT, level, current->key);
     }
     
-    current = current->forward[0];
+    return link_after(list, update, key, value) != NULL;
+}
+
+/**
+ * Insert behind the predecessors in update[0..current_level] (updated in
+ * place for any new levels).
+ * @return the new node, or NULL if the key existed and its value was replaced
+ */
+static SkipListNode* link_after(SkipList* list, SkipListNode** update, int key, const char* value) {
+    SkipListNode* current = update[0]->next;
     
     // If key already exists, update the value
     if (current != NULL && current->key == key) {
-        strcpy(current->value, value);
-        if (list->verbose) {
-            add_operation(list, "Key already exists - updated value");
-        }
-        return false; // Indicate that no new node was inserted
+        release_value(list, current->value);
+        current->value = copy_value(list, value);
+        TRACE(EV_SKIP_UPDATED_VALUE);
+        return NULL; // Indicate that no new node was inserted
     }
     
     // Generate random level for new node
     int new_level = random_level();
-    
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "Generated random level: %d", new_level);
-        add_operation(list, msg);
-    }
+    TRACE(EV_SKIP_RANDOM_LEVEL, new_level);
     
     // If new level is higher than current level, update header pointers
     if (new_level > list->current_level) {
@@ -265,108 +408,266 @@ bool insert(SkipList* list, int key, const char* value) {
             update[level] = list->header;
         }
         list->current_level = new_level;
-        
-        if (list->verbose) {
-            char msg[200];
-            sprintf(msg, "Increased current level to: %d", list->current_level);
-            add_operation(list, msg);
-        }
+        TRACE(EV_SKIP_LEVEL_UP, list->current_level);
     }
     
     // Create new node and update pointers
-    SkipListNode* new_node = create_node(key, value, new_level);
+    SkipListNode* new_node = create_node(list, key, value, new_level);
     
     for (int level = 0; level <= new_level; level++) {
-        new_node->forward[level] = update[level]->forward[level];
-        update[level]->forward[level] = new_node;
-        
-        if (list->verbose) {
-            char msg[200];
-            sprintf(msg, "Level %d: Linked new node", level);
-            add_operation(list, msg);
-        }
+        set_next(new_node, level, next_node(update[level], level));
+        set_next(update[level], level, new_node);
+        TRACE(EV_SKIP_LINKED, level);
     }
     
     list->size++;
+    TRACE(EV_SKIP_INSERTED, list->size);
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "Insertion completed. Size: %d", list->size);
-        add_operation(list, msg);
-    }
-    
-    return true;
+    return new_node;
 }
 
+static bool unlink_after(SkipList* list, SkipListNode** update, int key);
+
 // Delete a key from the skip list
 bool delete_key(SkipList* list, int key) {
     SkipListNode* update[MAX_LEVEL + 1];
     SkipListNode* current = list->header;
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "=== Deleting key %d ===", key);
-        add_operation(list, msg);
-    }
+    TRACE(EV_SKIP_DELETE, key);
     
     // Find the node to delete and record update pointers
     for (int level = list->current_level; level >= 0; level--) {
-        while (current->forward[level] != NULL && current->forward[level]->key < key) {
-            current = current->forward[level];
-        }
+        current = advance(current, level, key);
         update[level] = current;
     }
     
-    current = current->forward[0];
+    return unlink_after(list, update, key);
+}
+
+// Remove key behind the predecessors in update[0..current_level]
+static bool unlink_after(SkipList* list, SkipListNode** update, int key) {
+    SkipListNode* current = update[0]->next;
     
     // If key doesn't exist, return false
     if (current == NULL || current->key != key) {
-        if (list->verbose) {
-            add_operation(list, "Key not found - deletion failed");
-        }
+        TRACE(EV_SKIP_NOT_FOUND);
         return false;
     }
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "Found node to delete: [key=%d, value=%s, level=%d]", 
-                current->key, current->value, current->level);
-        add_operation(list, msg);
-    }
+    TRACE_S(EV_SKIP_FOUND_NODE, current->value, current->key, current->level);
     
     // Update pointers to skip the deleted node
     for (int level = 0; level <= current->level; level++) {
-        update[level]->forward[level] = current->forward[level];
-        
-        if (list->verbose) {
-            char msg[200];
-            sprintf(msg, "Level %d: Updated pointer to skip deleted node", level);
-            add_operation(list, msg);
-        }
+        set_next(update[level], level, next_node(current, level));
+        TRACE(EV_SKIP_UNLINKED, level);
     }
     
     // Free the deleted node
-    free_node(current);
+    free_node(list, current);
     
     // Reduce current level if necessary
-    while (list->current_level > 0 && list->header->forward[list->current_level] == NULL) {
+    while (list->current_level > 0 && next_node(list->header, list->current_level) == NULL) {
         list->current_level--;
-        if (list->verbose) {
-            char msg[200];
-            sprintf(msg, "Reduced current level to: %d", list->current_level);
-            add_operation(list, msg);
-        }
+        TRACE(EV_SKIP_LEVEL_DOWN, list->current_level);
     }
     
     list->size--;
+    TRACE(EV_SKIP_DELETED, list->size);
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "Deletion completed. Size: %d", list->size);
-        add_operation(list, msg);
+    return true;
+}
+
+// ==================== Batched Operations ====================
+
+/**
+ * Finger search: finger[] holds the predecessors of the previous key at
+ * every level. Next-link keys never decrease going up, so climb only while
+ * the level above would still move right, then descend from there. A key d
+ * positions past the previous one costs O(log d) instead of O(log n).
+ * Keys that go backwards restart from the header.
+ */
+static inline int next_key(const SkipListNode* node, int level) {
+    if (level > 0) return node->up[level - 1].key;
+    return node->next != NULL ? node->next->key : INT_MAX;
+}
+
+static void reset_finger(SkipList* list, SkipListNode** finger) {
+    for (int level = 0; level <= MAX_LEVEL; level++) finger[level] = list->header;
+}
+
+static void finger_seek(SkipList* list, SkipListNode** finger, int key) {
+    int top = 0;
+    while (top < list->current_level && next_key(finger[top + 1], top + 1) < key) top++;
+    
+    SkipListNode* current = finger[top];
+    for (int level = top; level >= 0; level--) {
+        if (finger[level]->key > current->key) current = finger[level];
+        current = advance(current, level, key);
+        finger[level] = current;
+    }
+}
+
+/**
+ * Look up a batch of keys, fastest when keys are sorted.
+ * @param values receives each key's value, or NULL if absent
+ * @return number of keys found
+ */
+int search_batch(SkipList* list, const int* keys, int count, const char** values) {
+    SkipListNode* finger[MAX_LEVEL + 1];
+    reset_finger(list, finger);
+    int found = 0;
+    
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && keys[i] < keys[i - 1]) reset_finger(list, finger);
+        finger_seek(list, finger, keys[i]);
+        SkipListNode* node = finger[0]->next;
+        values[i] = node != NULL && node->key == keys[i] ? node->value : NULL;
+        found += values[i] != NULL;
     }
+    return found;
+}
+
+// Insert a batch of key-value pairs; returns the number of new nodes
+int insert_batch(SkipList* list, const int* keys, const char* const* values, int count) {
+    SkipListNode* finger[MAX_LEVEL + 1];
+    reset_finger(list, finger);
+    int inserted = 0;
+    
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && keys[i] < keys[i - 1]) reset_finger(list, finger);
+        finger_seek(list, finger, keys[i]);
+        if (finger[0] != list->header && finger[0]->key == keys[i]) {
+            // Repeated key: its node is the finger itself, so replace the value as insert() does
+            release_value(list, finger[0]->value);
+            finger[0]->value = copy_value(list, values[i]);
+            TRACE(EV_SKIP_UPDATED_VALUE);
+            continue;
+        }
+        SkipListNode* node = link_after(list, finger, keys[i], values[i]);
+        if (node != NULL) {
+            // The new node precedes every later key on its levels
+            for (int level = 0; level <= node->level; level++) finger[level] = node;
+            inserted++;
+        }
+    }
+    return inserted;
+}
+
+// Delete a batch of keys; returns the number removed
+int delete_batch(SkipList* list, const int* keys, int count) {
+    SkipListNode* finger[MAX_LEVEL + 1];
+    reset_finger(list, finger);
+    int deleted = 0;
+    
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && keys[i] < keys[i - 1]) reset_finger(list, finger);
+        finger_seek(list, finger, keys[i]);
+        deleted += unlink_after(list, finger, keys[i]);
+    }
+    return deleted;
+}
+
+void free_skip_list(SkipList* list);
+
+/**
+ * Build a skip list from strictly increasing keys in O(n).
+ * Tower heights are deterministic: the i-th node (1-based) gets level
+ * ctz(i), so level l holds exactly every 2^l-th key. Later inserts still
+ * draw random levels.
+ */
+SkipList* bulk_load(const int* keys, const char* const* values, int count) {
+    SkipList* list = create_skip_list();
+    SkipListNode* tail[MAX_LEVEL + 1];
+    reset_finger(list, tail);
+    
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && keys[i] <= keys[i - 1]) {
+            printf("Error: bulk_load needs strictly increasing keys (%d after %d)\n", keys[i], keys[i - 1]);
+            free_skip_list(list);
+            return NULL;
+        }
+        int level = __builtin_ctz((unsigned) i + 1);
+        if (level > MAX_LEVEL) level = MAX_LEVEL;
+        
+        SkipListNode* node = create_node(list, keys[i], values[i], level);
+        for (int l = 0; l <= level; l++) {
+            set_next(tail[l], l, node);
+            tail[l] = node;
+        }
+        if (level > list->current_level) list->current_level = level;
+    }
+    list->size = count;
+    return list;
+}
+
+// ==================== Range Cursor ====================
+
+/**
+ * Forward cursor over [min_key, max_key].
+ * A level-0 walk is a chain of dependent loads: each node's address is only
+ * known once its predecessor arrives. The towers already hold addresses
+ * further ahead, so the cursor issues those loads early:
+ * - every node prefetches its level-1 and level-2 successors, about 2 and
+ *   4 nodes on;
+ * - every level-2 node hops CURSOR_EXPRESS_HOPS links along level 2 and
+ *   prefetches that node's successors.
+ * Several misses are then in flight at once: about 1.8x faster on a list
+ * built in random order.
+ */
+#define CURSOR_EXPRESS_LEVEL 2
+#define CURSOR_EXPRESS_HOPS 2
+
+typedef struct {
+    SkipListNode* node;
+    int max_key;
+} SkipListCursor;
+
+SkipListCursor cursor_seek(SkipList* list, int min_key, int max_key) {
+    SkipListCursor cursor;
+    SkipListNode* current = list->header;
+    for (int level = list->current_level; level >= 0; level--) {
+        current = advance(current, level, min_key);
+    }
+    cursor.node = current->next;
+    cursor.max_key = max_key;
+    return cursor;
+}
+
+static inline bool cursor_valid(const SkipListCursor* cursor) {
+    return cursor->node != NULL && cursor->node->key <= cursor->max_key;
+}
+
+static inline int cursor_key(const SkipListCursor* cursor) {
+    return cursor->node->key;
+}
+
+static inline const char* cursor_value(const SkipListCursor* cursor) {
+    return cursor->node->value;
+}
+
+static inline void cursor_next(SkipListCursor* cursor) {
+    SkipListNode* node = cursor->node->next;
+    cursor->node = node;
+    if (node == NULL || node->key > cursor->max_key) return;
     
-    return true;
+    for (int level = 1; level <= node->level && level <= CURSOR_EXPRESS_LEVEL; level++) {
+        __builtin_prefetch(node->up[level - 1].node);
+    }
+    if (node->level >= CURSOR_EXPRESS_LEVEL) {
+        // Link keys bound the hops without loading the nodes
+        SkipListNode* ahead = node;
+        for (int hop = 0; hop < CURSOR_EXPRESS_HOPS; hop++) {
+            SkipLink link = ahead->up[CURSOR_EXPRESS_LEVEL - 1];
+            if (link.node == NULL || link.key > cursor->max_key) break;
+            ahead = link.node;
+        }
+        if (ahead != node) {
+            __builtin_prefetch(ahead->next);
+            for (int level = 1; level <= CURSOR_EXPRESS_LEVEL; level++) {
+                __builtin_prefetch(ahead->up[level - 1].node);
+            }
+        }
+    }
 }
 
 // Display the skip list structure
@@ -376,11 +677,11 @@ void display(const SkipList* list) {
     
     for (int level = list->current_level; level >= 0; level--) {
         printf("Level %2d: ", level);
-        SkipListNode* current = list->header->forward[level];
+        SkipListNode* current = next_node(list->header, level);
         
         while (current != NULL) {
             printf("[%d:%s] -> ", current->key, current->value);
-            current = current->forward[level];
+            current = next_node(current, level);
         }
         printf("NULL\n");
     }
@@ -392,35 +693,16 @@ int range_query(SkipList* list, int min_key, int max_key,
                 int* result_keys, char result_values[][MAX_VALUE_LENGTH]) {
     int count = 0;
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "=== Range Query [%d, %d] ===", min_key, max_key);
-        add_operation(list, msg);
-    }
-    
-    // Find the first node >= min_key
-    SkipListNode* current = list->header;
-    for (int level = list->current_level; level >= 0; level--) {
-        while (current->forward[level] != NULL && current->forward[level]->key < min_key) {
-            current = current->forward[level];
-        }
-    }
-    
-    current = current->forward[0];
+    TRACE(EV_SKIP_RANGE, min_key, max_key);
     
-    // Collect all nodes in the range
-    while (current != NULL && current->key <= max_key) {
-        result_keys[count] = current->key;
-        strcpy(result_values[count], current->value);
+    // Find the first node >= min_key, then collect all nodes in the range
+    for (SkipListCursor cursor = cursor_seek(list, min_key, max_key); cursor_valid(&cursor); cursor_next(&cursor)) {
+        result_keys[count] = cursor_key(&cursor);
+        strcpy(result_values[count], cursor_value(&cursor));
         count++;
-        current = current->forward[0];
     }
     
-    if (list->verbose) {
-        char msg[200];
-        sprintf(msg, "Range query found %d entries", count);
-        add_operation(list, msg);
-    }
+    TRACE(EV_SKIP_RANGE_FOUND, count);
     
     return count;
 }
@@ -437,19 +719,29 @@ PerformanceMetrics calculate_metrics(const SkipList* list) {
     int total_levels = 0;
     int total_pointers = 0;
     
-    SkipListNode* current = list->header->forward[0];
+    // The old layout: node with an inline 256-byte value plus a separate
+    // forward array, each allocation carrying a 16-byte malloc header
+    size_t legacy_node = (sizeof(int) + MAX_VALUE_LENGTH + sizeof(void*) + sizeof(int) + 7) / 8 * 8;
+    size_t legacy_bytes = 0;
+    
+    SkipListNode* current = list->header->next;
     while (current != NULL) {
         int node_level = current->level;
         total_levels += node_level + 1; // +1 because level is 0-indexed
         total_pointers += node_level + 1;
+        legacy_bytes += 16 + legacy_node + 16 + (node_level + 1) * sizeof(void*);
         
         metrics.level_distribution[node_level]++;
-        current = current->forward[0];
+        current = current->next;
     }
     
     if (list->size > 0) {
         metrics.average_level = (double) total_levels / list->size;
         metrics.space_overhead = (double) total_pointers / list->size;
+        // Slab reservation includes the header and free blocks; values add a malloc header each
+        metrics.bytes_per_key = (double) (list->allocator.reserved_bytes + list->value_bytes +
+                                          16 * (size_t) list->size) / list->size;
+        metrics.legacy_bytes_per_key = (double) legacy_bytes / list->size;
     }
     
     metrics.total_forward_pointers = total_pointers;
@@ -460,7 +752,7 @@ PerformanceMetrics calculate_metrics(const SkipList* list) {
 // Verify skip list invariants
 bool verify_integrity(const SkipList* list) {
     // Check if keys are in sorted order at level 0
-    SkipListNode* current = list->header->forward[0];
+    SkipListNode* current = list->header->next;
     int prev_key = INT_MIN;
     
     while (current != NULL) {
@@ -470,7 +762,7 @@ bool verify_integrity(const SkipList* list) {
             return false;
         }
         prev_key = current->key;
-        current = current->forward[0];
+        current = current->next;
     }
     
     // Check if higher levels are subsets of lower levels
@@ -479,21 +771,28 @@ bool verify_integrity(const SkipList* list) {
         bool lower_level_keys[100000] = {false};
         
         // Collect keys at current level
-        current = list->header->forward[level];
+        SkipListNode* previous = list->header;
+        current = next_node(list->header, level);
         while (current != NULL) {
             if (current->key >= 0 && current->key < 100000) {
                 current_level_keys[current->key] = true;
             }
-            current = current->forward[level];
+            if (previous->up[level - 1].key != current->key) {
+                printf("Integrity violation: Level %d link key %d does not match node %d\n",
+                       level, previous->up[level - 1].key, current->key);
+                return false;
+            }
+            previous = current;
+            current = next_node(current, level);
         }
         
         // Collect keys at level below
-        current = list->header->forward[level - 1];
+        current = next_node(list->header, level - 1);
         while (current != NULL) {
             if (current->key >= 0 && current->key < 100000) {
                 lower_level_keys[current->key] = true;
             }
-            current = current->forward[level - 1];
+            current = next_node(current, level - 1);
         }
         
         // Current level should be a subset of lower level
@@ -514,11 +813,19 @@ void free_skip_list(SkipList* list) {
     SkipListNode* current = list->header;
     
     while (current != NULL) {
-        SkipListNode* next = current->forward[0];
-        free_node(current);
+        SkipListNode* next = current->next;
+        free(current->value);
         current = next;
     }
     
+    // Nodes go back with their slabs
+    Slab* slab = list->allocator.slabs;
+    while (slab != NULL) {
+        Slab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    
     free(list);
 }
 
@@ -530,9 +837,788 @@ void print_search_result(const SearchResult* result, int key) {
 
 void print_performance_metrics(const PerformanceMetrics* metrics) {
     printf("Nodes: %d, Max Level: %d, Avg Level: %.2f, "
-           "Total Pointers: %d, Space Overhead: %.2fx\n",
+           "Total Pointers: %d, Space Overhead: %.2fx, Bytes/Key: %.1f (was %.1f)\n",
            metrics->total_nodes, metrics->max_level, metrics->average_level, 
-           metrics->total_forward_pointers, metrics->space_overhead);
+           metrics->total_forward_pointers, metrics->space_overhead,
+           metrics->bytes_per_key, metrics->legacy_bytes_per_key);
+}
+
+// ==================== MVCC Snapshots ====================
+
+/**
+ * Multi-version ordered key-value store with lock-free snapshot reads.
+ * - Commits: every put or delete pushes a version onto the key's
+ *   newest-first chain. A delete pushes a tombstone. The version is
+ *   stamped with the next commit timestamp, and the clock is advanced
+ *   only after the version is visible. Writers serialize on write_lock;
+ *   readers never take it.
+ * - Snapshots: mvcc_snapshot() registers the current timestamp in a reader
+ *   slot. The snapshot then sees exactly the commits at or before it,
+ *   for point and range reads alike. It fails if all slots are taken, and
+ *   callers must check: only a registered snapshot may be read through.
+ * - Collection: mvcc_collect() frees versions hidden behind one that
+ *   every live snapshot can see. It unlinks keys whose newest state is an
+ *   old-enough tombstone, and frees those nodes once no snapshot that
+ *   might still be walking them is left. It can run in a background
+ *   thread.
+ * Links are plain atomic pointers without SkipListNode's key copies: a
+ * (pointer, key) pair cannot be published in one atomic store.
+ */
+#define MVCC_MAX_SNAPSHOTS 64
+#define MVCC_GC_BATCH 1024
+#define MVCC_SLOT_REGISTERING UINT64_MAX
+
+typedef struct MvccVersion {
+    uint64_t commit_ts;
+    struct MvccVersion* _Atomic older;
+    bool deleted;
+    char value[];
+} MvccVersion;
+
+typedef struct MvccNode {
+    int key;
+    int level;
+    MvccVersion* _Atomic versions;          // newest first, never empty
+    struct MvccNode* retired_next;
+    uint64_t retired_ts;
+    struct MvccNode* _Atomic next[];        // levels 0..level
+} MvccNode;
+
+typedef struct {
+    MvccNode* header;
+    _Atomic int current_level;
+    _Atomic uint64_t clock;                         // last published commit
+    _Atomic uint64_t snapshots[MVCC_MAX_SNAPSHOTS]; // read timestamps, 0 = free slot
+    pthread_mutex_t write_lock;
+    pthread_mutex_t collect_lock;
+    MvccNode* retired;                              // unlinked, waiting for old snapshots
+    pthread_t collector;
+    atomic_bool collector_running;
+    int collector_interval_us;
+    _Atomic long long live_versions;
+    _Atomic long long reclaimed_versions;
+    _Atomic long long reclaimed_nodes;
+} MvccSkipList;
+
+typedef struct {
+    MvccSkipList* list;
+    uint64_t read_ts;
+    int slot;                                       // -1 once released
+} MvccSnapshot;
+
+static MvccVersion* mvcc_create_version(uint64_t commit_ts, const char* value, bool deleted) {
+    size_t length = deleted ? 0 : strnlen(value, MAX_VALUE_LENGTH - 1);
+    MvccVersion* version = malloc(sizeof(MvccVersion) + length + 1);
+    version->commit_ts = commit_ts;
+    atomic_init(&version->older, NULL);
+    version->deleted = deleted;
+    if (length) memcpy(version->value, value, length);
+    version->value[length] = '\0';
+    return version;
+}
+
+static MvccNode* mvcc_create_node(int key, int level) {
+    MvccNode* node = malloc(sizeof(MvccNode) + (level + 1) * sizeof(MvccNode*));
+    node->key = key;
+    node->level = level;
+    atomic_init(&node->versions, NULL);
+    node->retired_next = NULL;
+    node->retired_ts = 0;
+    for (int i = 0; i <= level; i++) atomic_init(&node->next[i], NULL);
+    return node;
+}
+
+static long long mvcc_free_versions(MvccVersion* version) {
+    long long count = 0;
+    while (version != NULL) {
+        MvccVersion* older = atomic_load_explicit(&version->older, memory_order_relaxed);
+        free(version);
+        version = older;
+        count++;
+    }
+    return count;
+}
+
+MvccSkipList* create_mvcc_skip_list() {
+    MvccSkipList* list = malloc(sizeof(MvccSkipList));
+    list->header = mvcc_create_node(INT_MIN, MAX_LEVEL);
+    atomic_init(&list->current_level, 0);
+    atomic_init(&list->clock, 1);       // 0 marks a free snapshot slot
+    for (int i = 0; i < MVCC_MAX_SNAPSHOTS; i++) atomic_init(&list->snapshots[i], 0);
+    pthread_mutex_init(&list->write_lock, NULL);
+    pthread_mutex_init(&list->collect_lock, NULL);
+    list->retired = NULL;
+    atomic_init(&list->collector_running, false);
+    list->collector_interval_us = 0;
+    atomic_init(&list->live_versions, 0);
+    atomic_init(&list->reclaimed_versions, 0);
+    atomic_init(&list->reclaimed_nodes, 0);
+    return list;
+}
+
+// Predecessors of key at every level; caller holds write_lock
+static MvccNode* mvcc_find_update(MvccSkipList* list, int key, MvccNode** update) {
+    MvccNode* current = list->header;
+    for (int level = atomic_load_explicit(&list->current_level, memory_order_relaxed); level >= 0; level--) {
+        MvccNode* next = atomic_load_explicit(&current->next[level], memory_order_relaxed);
+        while (next != NULL && next->key < key) {
+            current = next;
+            next = atomic_load_explicit(&current->next[level], memory_order_relaxed);
+        }
+        update[level] = current;
+    }
+    return atomic_load_explicit(&current->next[0], memory_order_relaxed);
+}
+
+// Commit one version; returns its timestamp, or 0 if there was nothing to delete
+static uint64_t mvcc_commit(MvccSkipList* list, int key, const char* value, bool deleted) {
+    MvccNode* update[MAX_LEVEL + 1];
+    pthread_mutex_lock(&list->write_lock);
+    
+    MvccNode* node = mvcc_find_update(list, key, update);
+    if (node != NULL && node->key != key) node = NULL;
+    MvccVersion* head = node ? atomic_load_explicit(&node->versions, memory_order_relaxed) : NULL;
+    if (deleted && (head == NULL || head->deleted)) {
+        pthread_mutex_unlock(&list->write_lock);
+        return 0;
+    }
+    
+    uint64_t commit_ts = atomic_load_explicit(&list->clock, memory_order_relaxed) + 1;
+    MvccVersion* version = mvcc_create_version(commit_ts, value, deleted);
+    
+    if (node != NULL) {
+        atomic_store_explicit(&version->older, head, memory_order_relaxed);
+        atomic_store_explicit(&node->versions, version, memory_order_release);
+    } else {
+        int level = random_level();
+        int current_level = atomic_load_explicit(&list->current_level, memory_order_relaxed);
+        for (int l = current_level + 1; l <= level; l++) update[l] = list->header;
+        
+        // Fill in the node completely, then publish it bottom-up
+        node = mvcc_create_node(key, level);
+        atomic_store_explicit(&node->versions, version, memory_order_relaxed);
+        for (int l = 0; l <= level; l++) {
+            atomic_store_explicit(&node->next[l], atomic_load_explicit(&update[l]->next[l], memory_order_relaxed),
+                                  memory_order_relaxed);
+        }
+        for (int l = 0; l <= level; l++) {
+            atomic_store_explicit(&update[l]->next[l], node, memory_order_release);
+        }
+        if (level > current_level) atomic_store_explicit(&list->current_level, level, memory_order_release);
+    }
+    
+    atomic_fetch_add_explicit(&list->live_versions, 1, memory_order_relaxed);
+    atomic_store(&list->clock, commit_ts);
+    pthread_mutex_unlock(&list->write_lock);
+    return commit_ts;
+}
+
+uint64_t mvcc_put(MvccSkipList* list, int key, const char* value) {
+    return mvcc_commit(list, key, value, false);
+}
+
+// Returns true if a live key was deleted
+bool mvcc_delete(MvccSkipList* list, int key) {
+    return mvcc_commit(list, key, NULL, true) != 0;
+}
+
+// Returns false if all MVCC_MAX_SNAPSHOTS slots are taken; the snapshot must
+// not be read through then
+bool mvcc_snapshot(MvccSkipList* list, MvccSnapshot* out) {
+    MvccSnapshot snapshot = { list, 0, -1 };
+    for (int slot = 0; slot < MVCC_MAX_SNAPSHOTS && snapshot.slot < 0; slot++) {
+        uint64_t expected = 0;
+        if (atomic_compare_exchange_strong(&list->snapshots[slot], &expected, MVCC_SLOT_REGISTERING)) {
+            snapshot.slot = slot;
+        }
+    }
+    *out = snapshot;
+    if (snapshot.slot < 0) {
+        printf("Error: more than %d live snapshots\n", MVCC_MAX_SNAPSHOTS);
+        return false;
+    }
+    
+    // Publish the timestamp, then check the clock has not moved. A collector
+    // that scanned the slots before this store read its clock earlier still,
+    // so its horizon cannot be past read_ts.
+    uint64_t read_ts;
+    do {
+        read_ts = atomic_load(&list->clock);
+        atomic_store(&list->snapshots[snapshot.slot], read_ts);
+    } while (atomic_load(&list->clock) != read_ts);
+    out->read_ts = read_ts;
+    return true;
+}
+
+void mvcc_release(MvccSnapshot* snapshot) {
+    if (snapshot->slot >= 0) {
+        atomic_store(&snapshot->list->snapshots[snapshot->slot], 0);
+        snapshot->slot = -1;
+    }
+}
+
+// Newest version committed at or before read_ts, or NULL if the key did not exist yet
+static const MvccVersion* mvcc_visible(const MvccNode* node, uint64_t read_ts) {
+    const MvccVersion* version = atomic_load_explicit(&node->versions, memory_order_acquire);
+    while (version != NULL && version->commit_ts > read_ts) {
+        version = atomic_load_explicit(&version->older, memory_order_acquire);
+    }
+    return version;
+}
+
+// First node with key >= key, read without locks
+static MvccNode* mvcc_seek(MvccSkipList* list, int key) {
+    MvccNode* current = list->header;
+    for (int level = atomic_load_explicit(&list->current_level, memory_order_acquire); level >= 0; level--) {
+        MvccNode* next = atomic_load_explicit(&current->next[level], memory_order_acquire);
+        while (next != NULL && next->key < key) {
+            current = next;
+            next = atomic_load_explicit(&current->next[level], memory_order_acquire);
+        }
+    }
+    return atomic_load_explicit(&current->next[0], memory_order_acquire);
+}
+
+// Value as of the snapshot, or NULL; valid until the snapshot is released
+const char* mvcc_get(const MvccSnapshot* snapshot, int key) {
+    MvccNode* node = mvcc_seek(snapshot->list, key);
+    if (node == NULL || node->key != key) return NULL;
+    const MvccVersion* version = mvcc_visible(node, snapshot->read_ts);
+    return version != NULL && !version->deleted ? version->value : NULL;
+}
+
+// Up to capacity live entries in [min_key, max_key] as of the snapshot
+int mvcc_range(const MvccSnapshot* snapshot, int min_key, int max_key,
+               int* keys, const char** values, int capacity) {
+    int count = 0;
+    MvccNode* node = mvcc_seek(snapshot->list, min_key);
+    while (node != NULL && node->key <= max_key && count < capacity) {
+        const MvccVersion* version = mvcc_visible(node, snapshot->read_ts);
+        if (version != NULL && !version->deleted) {
+            keys[count] = node->key;
+            values[count] = version->value;
+            count++;
+        }
+        node = atomic_load_explicit(&node->next[0], memory_order_acquire);
+    }
+    return count;
+}
+
+// Oldest timestamp any live snapshot can read at; clock first, then the slots
+static uint64_t mvcc_horizon(MvccSkipList* list) {
+    uint64_t horizon = atomic_load(&list->clock);
+    for (int slot = 0; slot < MVCC_MAX_SNAPSHOTS; slot++) {
+        uint64_t read_ts = atomic_load(&list->snapshots[slot]);
+        if (read_ts != 0 && read_ts < horizon) horizon = read_ts;
+    }
+    return horizon;
+}
+
+// Unlink a node whose key is dead for every snapshot; caller holds write_lock
+static void mvcc_unlink(MvccSkipList* list, MvccNode* node) {
+    MvccNode* update[MAX_LEVEL + 1];
+    mvcc_find_update(list, node->key, update);
+    for (int level = 0; level <= node->level; level++) {
+        atomic_store_explicit(&update[level]->next[level],
+                              atomic_load_explicit(&node->next[level], memory_order_relaxed), memory_order_release);
+    }
+    int level = atomic_load_explicit(&list->current_level, memory_order_relaxed);
+    while (level > 0 && atomic_load_explicit(&list->header->next[level], memory_order_relaxed) == NULL) level--;
+    atomic_store_explicit(&list->current_level, level, memory_order_release);
+    
+    // Bump the clock: snapshots taken from here on cannot reach the node,
+    // older ones might still be standing on it
+    uint64_t retired_ts = atomic_load_explicit(&list->clock, memory_order_relaxed) + 1;
+    atomic_store(&list->clock, retired_ts);
+    node->retired_ts = retired_ts;
+    node->retired_next = list->retired;
+    list->retired = node;
+}
+
+/**
+ * One collection pass. Holds write_lock for at most MVCC_GC_BATCH nodes at
+ * a time, so writers interleave with a long pass.
+ * @return number of versions reclaimed
+ */
+long long mvcc_collect(MvccSkipList* list) {
+    pthread_mutex_lock(&list->collect_lock);
+    long long reclaimed = 0;
+    uint64_t horizon = mvcc_horizon(list);
+    
+    // Retired nodes go once every snapshot that could see them is gone
+    pthread_mutex_lock(&list->write_lock);
+    MvccNode** link = &list->retired;
+    while (*link != NULL) {
+        MvccNode* node = *link;
+        if (node->retired_ts <= horizon) {
+            *link = node->retired_next;
+            reclaimed += mvcc_free_versions(atomic_load_explicit(&node->versions, memory_order_relaxed));
+            free(node);
+            atomic_fetch_add_explicit(&list->reclaimed_nodes, 1, memory_order_relaxed);
+        } else {
+            link = &node->retired_next;
+        }
+    }
+    
+    // Only the collector unlinks nodes, so the walk can resume after a lock gap
+    MvccNode* node = atomic_load_explicit(&list->header->next[0], memory_order_relaxed);
+    int batch = 0;
+    while (node != NULL) {
+        MvccNode* next = atomic_load_explicit(&node->next[0], memory_order_relaxed);
+        MvccVersion* head = atomic_load_explicit(&node->versions, memory_order_relaxed);
+        MvccVersion* keep = head;
+        while (keep != NULL && keep->commit_ts > horizon) {
+            keep = atomic_load_explicit(&keep->older, memory_order_relaxed);
+        }
+        if (keep != NULL) {
+            // Every live snapshot stops at keep or earlier in the chain
+            MvccVersion* hidden = atomic_load_explicit(&keep->older, memory_order_relaxed);
+            if (hidden != NULL) {
+                atomic_store_explicit(&keep->older, NULL, memory_order_release);
+                reclaimed += mvcc_free_versions(hidden);
+            }
+            if (keep == head && keep->deleted) mvcc_unlink(list, node);
+        }
+        node = next;
+        
+        if (++batch == MVCC_GC_BATCH) {
+            batch = 0;
+            pthread_mutex_unlock(&list->write_lock);
+            pthread_mutex_lock(&list->write_lock);
+        }
+    }
+    pthread_mutex_unlock(&list->write_lock);
+    
+    atomic_fetch_sub_explicit(&list->live_versions, reclaimed, memory_order_relaxed);
+    atomic_fetch_add_explicit(&list->reclaimed_versions, reclaimed, memory_order_relaxed);
+    pthread_mutex_unlock(&list->collect_lock);
+    return reclaimed;
+}
+
+static void* mvcc_collector_loop(void* argument) {
+    MvccSkipList* list = argument;
+    struct timespec pause = { list->collector_interval_us / 1000000, (list->collector_interval_us % 1000000) * 1000L };
+    while (atomic_load(&list->collector_running)) {
+        mvcc_collect(list);
+        nanosleep(&pause, NULL);
+    }
+    return NULL;
+}
+
+void mvcc_start_collector(MvccSkipList* list, int interval_us) {
+    if (atomic_exchange(&list->collector_running, true)) return;
+    list->collector_interval_us = interval_us;
+    pthread_create(&list->collector, NULL, mvcc_collector_loop, list);
+}
+
+void mvcc_stop_collector(MvccSkipList* list) {
+    if (atomic_exchange(&list->collector_running, false)) pthread_join(list->collector, NULL);
+}
+
+void free_mvcc_skip_list(MvccSkipList* list) {
+    mvcc_stop_collector(list);
+    MvccNode* node = list->header;
+    while (node != NULL) {
+        MvccNode* next = atomic_load_explicit(&node->next[0], memory_order_relaxed);
+        mvcc_free_versions(atomic_load_explicit(&node->versions, memory_order_relaxed));
+        free(node);
+        node = next;
+    }
+    while (list->retired != NULL) {
+        MvccNode* next = list->retired->retired_next;
+        mvcc_free_versions(atomic_load_explicit(&list->retired->versions, memory_order_relaxed));
+        free(list->retired);
+        list->retired = next;
+    }
+    pthread_mutex_destroy(&list->write_lock);
+    pthread_mutex_destroy(&list->collect_lock);
+    free(list);
+}
+
+// The layout this file used before: inline value, separately allocated forward array
+typedef struct LegacyNode {
+    int key;
+    char value[MAX_VALUE_LENGTH];
+    struct LegacyNode** forward;
+    int level;
+} LegacyNode;
+
+static LegacyNode* build_legacy_copy(const SkipList* list) {
+    LegacyNode* header = calloc(1, sizeof(LegacyNode));
+    header->key = INT_MIN;
+    header->level = MAX_LEVEL;
+    header->forward = calloc(MAX_LEVEL + 1, sizeof(LegacyNode*));
+    LegacyNode* tail[MAX_LEVEL + 1];
+    for (int level = 0; level <= MAX_LEVEL; level++) tail[level] = header;
+    
+    for (SkipListNode* node = list->header->next; node != NULL; node = node->next) {
+        LegacyNode* copy = malloc(sizeof(LegacyNode));
+        copy->key = node->key;
+        strcpy(copy->value, node->value);
+        copy->level = node->level;
+        copy->forward = calloc(node->level + 1, sizeof(LegacyNode*));
+        for (int level = 0; level <= node->level; level++) {
+            tail[level]->forward[level] = copy;
+            tail[level] = copy;
+        }
+    }
+    return header;
+}
+
+static const char* legacy_lookup(LegacyNode* header, int current_level, int key) {
+    LegacyNode* current = header;
+    for (int level = current_level; level >= 0; level--) {
+        while (current->forward[level] != NULL && current->forward[level]->key < key) {
+            current = current->forward[level];
+        }
+    }
+    current = current->forward[0];
+    return current != NULL && current->key == key ? current->value : NULL;
+}
+
+static void free_legacy_copy(LegacyNode* header) {
+    while (header != NULL) {
+        LegacyNode* next = header->forward[0];
+        free(header->forward);
+        free(header);
+        header = next;
+    }
+}
+
+static double elapsed_ns(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+// Random-order build, then random hit lookups on the compact and the old layout
+void benchmark_node_layout(int key_count, bool include_legacy) {
+    const int lookup_count = 1000000;
+    int* keys = malloc(key_count * sizeof(int));
+    for (int i = 0; i < key_count; i++) keys[i] = 2 * i;
+    unsigned long long state = 0x9e3779b97f4a7c15ULL;
+    for (int i = key_count - 1; i > 0; i--) {
+        state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+        int j = (int) (state % (unsigned long long) (i + 1));
+        int temp = keys[i]; keys[i] = keys[j]; keys[j] = temp;
+    }
+    
+    struct timespec start, end;
+    char value[32];
+    SkipList* list = create_skip_list();
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < key_count; i++) {
+        snprintf(value, sizeof(value), "value%d", keys[i]);
+        insert(list, keys[i], value);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double build_s = elapsed_ns(start, end) / 1e9;
+    
+    long long found = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < lookup_count; i++) {
+        found += lookup(list, keys[(i * 7919LL) % key_count]) != NULL;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double compact_ns = elapsed_ns(start, end) / lookup_count;
+    
+    PerformanceMetrics metrics = calculate_metrics(list);
+    printf("%-10d %-10.2f %-14.1f %-14.1f %-14.1f", key_count, build_s,
+           metrics.bytes_per_key, metrics.legacy_bytes_per_key, compact_ns);
+    
+    if (include_legacy) {
+        LegacyNode* legacy = build_legacy_copy(list);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < lookup_count; i++) {
+            found += legacy_lookup(legacy, list->current_level, keys[(i * 7919LL) % key_count]) != NULL;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        printf(" %-14.1f", elapsed_ns(start, end) / lookup_count);
+        free_legacy_copy(legacy);
+    } else {
+        printf(" %-14s", "(skipped)");
+    }
+    printf(" %s\n", found == (include_legacy ? 2LL : 1LL) * lookup_count ? "ok" : "MISSING KEYS");
+    
+    free_skip_list(list);
+    free(keys);
+}
+
+// Sorted batches vs one call per key, bulk load vs inserts, cursor vs plain walk
+void benchmark_batch_operations(int key_count) {
+    int* keys = malloc(key_count * sizeof(int));
+    char* value_text = malloc((size_t) key_count * 16);
+    const char** values = malloc(key_count * sizeof(char*));
+    for (int i = 0; i < key_count; i++) {
+        keys[i] = 2 * i;
+        values[i] = value_text + (size_t) i * 16;
+        snprintf(value_text + (size_t) i * 16, 16, "value%d", keys[i]);
+    }
+    struct timespec start, end;
+    
+    printf("Building %d sorted keys:\n", key_count);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    SkipList* individual = create_skip_list();
+    for (int i = 0; i < key_count; i++) insert(individual, keys[i], values[i]);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double individual_ms = elapsed_ns(start, end) / 1e6;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    SkipList* batched = create_skip_list();
+    insert_batch(batched, keys, values, key_count);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double batched_ms = elapsed_ns(start, end) / 1e6;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    SkipList* bulk = bulk_load(keys, values, key_count);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double bulk_ms = elapsed_ns(start, end) / 1e6;
+    
+    printf("  %-22s %10.1f ms  size %d, integrity %s\n", "insert() per key", individual_ms,
+           individual->size, verify_integrity(individual) ? "PASSED" : "FAILED");
+    printf("  %-22s %10.1f ms  size %d, integrity %s\n", "insert_batch()", batched_ms,
+           batched->size, verify_integrity(batched) ? "PASSED" : "FAILED");
+    printf("  %-22s %10.1f ms  size %d, integrity %s\n", "bulk_load()", bulk_ms,
+           bulk->size, verify_integrity(bulk) ? "PASSED" : "FAILED");
+    
+    // Sorted queries over every third integer: a mix of hits and misses
+    int query_count = 2 * key_count / 3;
+    int* queries = malloc(query_count * sizeof(int));
+    const char** results = malloc(query_count * sizeof(char*));
+    for (int i = 0; i < query_count; i++) queries[i] = 3 * i;
+    
+    int single_found = 0, mismatches = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < query_count; i++) single_found += lookup(individual, queries[i]) != NULL;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double single_ns = elapsed_ns(start, end) / query_count;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int batch_found = search_batch(individual, queries, query_count, results);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double batch_ns = elapsed_ns(start, end) / query_count;
+    for (int i = 0; i < query_count; i++) mismatches += results[i] != lookup(individual, queries[i]);
+    
+    printf("Sorted lookups (%d keys, %d found):\n", query_count, batch_found);
+    printf("  %-22s %10.1f ns/key\n", "lookup() per key", single_ns);
+    printf("  %-22s %10.1f ns/key  (%d mismatches vs lookup, %d vs %d found)\n",
+           "search_batch()", batch_ns, mismatches, batch_found, single_found);
+    
+    int half = key_count / 2;
+    int* doomed = calloc(half, sizeof(int));
+    for (int i = 0; i < half; i++) doomed[i] = keys[2 * i];
+    int deleted = delete_batch(batched, doomed, half);
+    printf("delete_batch() of every other key: %d removed, size %d, integrity %s\n",
+           deleted, batched->size, verify_integrity(batched) ? "PASSED" : "FAILED");
+    
+    // Range scans on a list built in random order, so neighbours are not adjacent in memory
+    for (int i = key_count - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int temp = keys[i]; keys[i] = keys[j]; keys[j] = temp;
+    }
+    SkipList* scattered = create_skip_list();
+    for (int i = 0; i < key_count; i++) insert(scattered, keys[i], "v");
+    
+    long long checksum = 0, cursor_checksum = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (SkipListNode* node = scattered->header->next; node != NULL; node = node->next) {
+        checksum += node->key + node->value[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double walk_ns = elapsed_ns(start, end) / key_count;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (SkipListCursor cursor = cursor_seek(scattered, INT_MIN, INT_MAX); cursor_valid(&cursor); cursor_next(&cursor)) {
+        cursor_checksum += cursor_key(&cursor) + cursor_value(&cursor)[0];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double cursor_ns = elapsed_ns(start, end) / key_count;
+    
+    printf("Full scan of %d keys inserted in random order:\n", key_count);
+    printf("  %-22s %10.1f ns/key\n", "level-0 walk", walk_ns);
+    printf("  %-22s %10.1f ns/key  (results %s)\n", "prefetching cursor", cursor_ns,
+           checksum == cursor_checksum ? "match" : "DIFFER");
+    
+    free_skip_list(individual);
+    free_skip_list(batched);
+    free_skip_list(bulk);
+    free_skip_list(scattered);
+    free(doomed);
+    free(queries);
+    free(results);
+    free(values);
+    free(value_text);
+    free(keys);
+}
+
+// Snapshot isolation: an old snapshot keeps its view while writers move on
+void demonstrate_mvcc_snapshots() {
+    MvccSkipList* store = create_mvcc_skip_list();
+    mvcc_put(store, 1, "alice@v1");
+    mvcc_put(store, 2, "bob@v1");
+    mvcc_put(store, 3, "carol@v1");
+    
+    MvccSnapshot before, after;
+    if (!mvcc_snapshot(store, &before)) {
+        free_mvcc_skip_list(store);
+        return;
+    }
+    mvcc_put(store, 1, "alice@v2");
+    mvcc_delete(store, 2);
+    mvcc_put(store, 4, "dave@v1");
+    if (!mvcc_snapshot(store, &after)) {
+        mvcc_release(&before);
+        free_mvcc_skip_list(store);
+        return;
+    }
+    
+    int keys[8];
+    const char* values[8];
+    MvccSnapshot* views[] = { &before, &after };
+    const char* names[] = { "old snapshot", "new snapshot" };
+    for (int v = 0; v < 2; v++) {
+        int count = mvcc_range(views[v], INT_MIN, INT_MAX, keys, values, 8);
+        printf("%s (ts %llu): ", names[v], (unsigned long long) views[v]->read_ts);
+        for (int i = 0; i < count; i++) printf("(%d:%s) ", keys[i], values[i]);
+        printf("\n");
+    }
+    
+    long long reclaimed = mvcc_collect(store);
+    printf("Collect with the old snapshot open: %lld versions reclaimed, key 2 still %s\n",
+           reclaimed, mvcc_get(&before, 2) ? mvcc_get(&before, 2) : "missing");
+    mvcc_release(&before);
+    reclaimed = mvcc_collect(store);
+    printf("After releasing it: %lld versions reclaimed, key 2 unlinked, %lld versions live\n",
+           reclaimed, (long long) atomic_load(&store->live_versions));
+    
+    // The newer snapshot predates the unlink, so the node waits for it
+    mvcc_collect(store);
+    printf("Unlinked nodes freed while the newer snapshot is open: %lld\n",
+           (long long) atomic_load(&store->reclaimed_nodes));
+    mvcc_release(&after);
+    mvcc_collect(store);
+    printf("Unlinked nodes freed after releasing it: %lld\n", (long long) atomic_load(&store->reclaimed_nodes));
+    free_mvcc_skip_list(store);
+}
+
+typedef struct {
+    MvccSkipList* store;
+    int key_count;
+    atomic_bool* stop;
+    long long operations;
+    long long entries;
+    long long violations;
+} MvccWorker;
+
+// Each pass rewrites every key in ascending order, one commit per key
+static void* mvcc_writer(void* argument) {
+    MvccWorker* worker = argument;
+    char value[16];
+    for (int round = 1; !atomic_load(worker->stop); round++) {
+        snprintf(value, sizeof(value), "%d", round);
+        for (int key = 0; key < worker->key_count && !atomic_load(worker->stop); key++) {
+            mvcc_put(worker->store, key, value);
+            worker->operations++;
+        }
+    }
+    return NULL;
+}
+
+// Churn on a separate key range: tombstones and node unlinking
+static void* mvcc_churner(void* argument) {
+    MvccWorker* worker = argument;
+    unsigned int seed = 7;
+    while (!atomic_load(worker->stop)) {
+        int key = worker->key_count + rand_r(&seed) % worker->key_count;
+        if (rand_r(&seed) % 2) mvcc_put(worker->store, key, "churn");
+        else mvcc_delete(worker->store, key);
+        worker->operations++;
+    }
+    return NULL;
+}
+
+/**
+ * Full scans over the writer's key range. A consistent snapshot sees the
+ * writer's pass as a prefix of round r followed by round r - 1. Anything
+ * else is a torn read.
+ */
+static void* mvcc_scanner(void* argument) {
+    MvccWorker* worker = argument;
+    int* keys = malloc(worker->key_count * sizeof(int));
+    const char** values = malloc(worker->key_count * sizeof(char*));
+    while (!atomic_load(worker->stop)) {
+        MvccSnapshot snapshot;
+        if (!mvcc_snapshot(worker->store, &snapshot)) break;   // readers are capped, so not expected
+        int count = mvcc_range(&snapshot, 0, worker->key_count - 1, keys, values, worker->key_count);
+        int first = count ? atoi(values[0]) : 0, previous = first;
+        for (int i = 0; i < count; i++) {
+            int round = atoi(values[i]);
+            if (round > previous || round < first - 1) worker->violations++;
+            previous = round;
+        }
+        if (count != worker->key_count) worker->violations++;
+        mvcc_release(&snapshot);
+        worker->operations++;
+        worker->entries += count;
+    }
+    free(keys);
+    free(values);
+    return NULL;
+}
+
+static void mvcc_run_phase(MvccSkipList* store, int key_count, int readers, int writers, double seconds) {
+    atomic_bool stop = false;
+    int total = readers + writers + (writers > 0);
+    MvccWorker* workers = calloc(total, sizeof(MvccWorker));
+    pthread_t* threads = malloc(total * sizeof(pthread_t));
+    for (int t = 0; t < total; t++) {
+        workers[t].store = store;
+        workers[t].key_count = key_count;
+        workers[t].stop = &stop;
+        void* (*body)(void*) = t < readers ? mvcc_scanner : t < readers + writers ? mvcc_writer : mvcc_churner;
+        pthread_create(&threads[t], NULL, body, &workers[t]);
+    }
+    struct timespec pause = { (time_t) seconds, (long) ((seconds - (time_t) seconds) * 1e9) };
+    nanosleep(&pause, NULL);
+    atomic_store(&stop, true);
+    
+    long long scans = 0, entries = 0, violations = 0, writes = 0;
+    for (int t = 0; t < total; t++) {
+        pthread_join(threads[t], NULL);
+        if (t < readers) {
+            scans += workers[t].operations;
+            entries += workers[t].entries;
+            violations += workers[t].violations;
+        } else {
+            writes += workers[t].operations;
+        }
+    }
+    printf("%-8d %-8d %-12.1f %-14.2f %-14.0f %-12lld\n", readers, writers,
+           scans / seconds, entries / seconds / 1e6, writes / seconds, violations);
+    free(workers);
+    free(threads);
+}
+
+void benchmark_mvcc_scans(int key_count) {
+    MvccSkipList* store = create_mvcc_skip_list();
+    for (int key = 0; key < key_count; key++) mvcc_put(store, key, "0");
+    mvcc_start_collector(store, 1000);
+    
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    int readers = processors > 2 ? (int) processors - 2 : 1;
+    if (readers > MVCC_MAX_SNAPSHOTS) readers = MVCC_MAX_SNAPSHOTS;   // one snapshot slot each
+    printf("%d keys, background collector every 1 ms, %ld CPU(s)\n", key_count, processors);
+    printf("%-8s %-8s %-12s %-14s %-14s %-12s\n", "Readers", "Writers", "Scans/s", "M entries/s", "Commits/s", "Torn scans");
+    printf("%-8s %-8s %-12s %-14s %-14s %-12s\n", "-------", "-------", "-------", "-----------", "---------", "----------");
+    mvcc_run_phase(store, key_count, readers, 0, 1.0);
+    mvcc_run_phase(store, key_count, readers, 1, 1.0);
+    mvcc_run_phase(store, key_count, 0, 1, 1.0);
+    
+    mvcc_stop_collector(store);
+    mvcc_collect(store);
+    mvcc_collect(store);
+    printf("Versions reclaimed: %lld, nodes freed: %lld, live versions: %lld (for %d keys plus churn)\n",
+           (long long) atomic_load(&store->reclaimed_versions), (long long) atomic_load(&store->reclaimed_nodes),
+           (long long) atomic_load(&store->live_versions), key_count);
+    free_mvcc_skip_list(store);
 }
 
 void demonstrate_real_world_applications() {
@@ -540,7 +1626,7 @@ void demonstrate_real_world_applications() {
     
     // Application 1: In-memory database index
     printf("\n1. In-Memory Database Index Simulation\n");
-    SkipList* db_index = create_skip_list(false);
+    SkipList* db_index = create_skip_list();
     
     // Simulate database records
     const char* records[][3] = {
@@ -558,10 +1644,10 @@ void demonstrate_real_world_applications() {
     }
     
     printf("Database Index Contents:\n");
-    SkipListNode* current = db_index->header->forward[0];
+    SkipListNode* current = db_index->header->next;
     while (current != NULL) {
         printf("ID %03d: %s\n", current->key, current->value);
-        current = current->forward[0];
+        current = current->next;
     }
     
     // Demonstrate range queries
@@ -578,7 +1664,7 @@ void demonstrate_real_world_applications() {
     
     // Application 2: Priority queue simulation
     printf("\n2. Task Scheduling Priority Queue\n");
-    SkipList* task_queue = create_skip_list(false);
+    SkipList* task_queue = create_skip_list();
     
     // Simulate tasks with priorities (lower number = higher priority)
     const char* tasks[][2] = {
@@ -595,10 +1681,10 @@ void demonstrate_real_world_applications() {
     }
     
     printf("Task Queue (by priority):\n");
-    current = task_queue->header->forward[0];
+    current = task_queue->header->next;
     while (current != NULL) {
         printf("Priority %d: %s\n", current->key, current->value);
-        current = current->forward[0];
+        current = current->next;
     }
     
     // Process high-priority tasks (priority <= 3)
@@ -622,14 +1708,17 @@ void demonstrate_real_world_applications() {
     printf("- Distributed systems coordination\n");
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    trace_register_events(SKIP_EVENTS, SKIP_EVENT_COUNT);
+    if (trace_handle_args(argc, argv)) return 0;
     printf("=== Skip List - Comprehensive Analysis ===\n\n");
     
     set_random_seed(42); // Fixed seed for reproducible results
     
     // Test case 1: Basic operations with step-by-step demonstration
     printf("Test Case 1: Basic Operations\n");
-    SkipList* skip_list = create_skip_list(true);
+    trace_set_enabled(true);
+    SkipList* skip_list = create_skip_list();
     
     // Insert some key-value pairs
     int keys[] = {3, 6, 7, 9, 12, 19, 17, 26, 21, 25};
@@ -642,8 +1731,7 @@ int main() {
         insert(skip_list, keys[i], values[i]);
         if (i < 5) { // Show details for first few insertions
             printf("\nOperations for insert(%d, %s):\n", keys[i], values[i]);
-            print_operations(skip_list);
-            clear_operations(skip_list);
+            trace_print_thread(stdout, "  ");
         }
     }
     
@@ -658,12 +1746,13 @@ int main() {
         SearchResult result = search(skip_list, search_keys[i]);
         print_search_result(&result, search_keys[i]);
         
-        if (skip_list->verbose && search_keys[i] == 7) {
+        if (search_keys[i] == 7) {
             printf("Detailed search path:\n");
-            print_operations(skip_list);
-            clear_operations(skip_list);
+            trace_print_thread(stdout, "  ");
         }
     }
+    trace_set_enabled(false);
+    trace_discard_thread();
     
     // Test case 2: Performance comparison with different data sizes
     printf("\n%s\n", "============================================================");
@@ -676,7 +1765,7 @@ int main() {
         int data_size = data_sizes[s];
         printf("\nAnalyzing Skip List with %d elements:\n", data_size);
         
-        SkipList* perf_list = create_skip_list(false);
+        SkipList* perf_list = create_skip_list();
         set_random_seed(42);
         
         // Insert random data
@@ -746,7 +1835,7 @@ int main() {
     printf("\n%s\n", "============================================================");
     printf("Test Case 3: Level Distribution Analysis\n");
     
-    SkipList* level_analysis = create_skip_list(false);
+    SkipList* level_analysis = create_skip_list();
     set_random_seed(42);
     
     // Insert 10000 elements and analyze level distribution
@@ -784,7 +1873,7 @@ int main() {
     printf("\n%s\n", "============================================================");
     printf("Test Case 4: Range Query Operations\n");
     
-    SkipList* range_list = create_skip_list(true);
+    SkipList* range_list = create_skip_list();
     
     // Insert ordered data
     for (int i = 1; i <= 20; i += 2) {
@@ -814,6 +1903,34 @@ int main() {
     free_skip_list(range_list);
     free_skip_list(skip_list);
     
+    // Test case 5: Node layout and lookup latency
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 5: Cache-Conscious Node Layout\n");
+    
+    printf("%-10s %-10s %-14s %-14s %-14s %-14s\n",
+           "Keys", "Build (s)", "Bytes/key", "Old bytes/key", "Lookup (ns)", "Old lookup (ns)");
+    printf("%-10s %-10s %-14s %-14s %-14s %-14s\n",
+           "----", "---------", "---------", "-------------", "-----------", "---------------");
+    set_random_seed(42);
+    int layout_sizes[] = {100000, 1000000, 10000000};
+    for (int i = 0; i < 3; i++) {
+        // The old layout needs ~320 bytes/key: skip it where it would not fit comfortably
+        benchmark_node_layout(layout_sizes[i], layout_sizes[i] <= 1000000);
+    }
+    
+    // Test case 6: Sorted batches, bulk load and range cursors
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 6: Batched and Finger-Search Operations\n");
+    
+    benchmark_batch_operations(1000000);
+    
+    // Test case 7: Snapshot reads under concurrent writes
+    printf("\n%s\n", "============================================================");
+    printf("Test Case 7: MVCC Snapshot Reads\n");
+    
+    demonstrate_mvcc_snapshots();
+    benchmark_mvcc_scans(100000);
+    
     printf("\n=== Skip List Analysis Summary ===\n");
     printf("Key Advantages:\n");
     printf("- Simple probabilistic balancing (no complex rotations)\n");
@@ -0,0 +1,350 @@
+/**
+ * Event tracing for the randomized-strategy programs
+ *
+ * Release builds (default): TRACE(...) and TRACE_S(...) expand to nothing -
+ * no code, no data, and the arguments are never evaluated.
+ *
+ * Tracing builds (-DTRACE_ENABLED): each call writes one fixed-size 64-byte
+ * binary record into the calling thread's ring buffer. Nothing is formatted
+ * on the hot path; records are decoded later with the program's event table
+ * (printf-style formats), either in-process (trace_print_thread) or offline
+ * from a dump file (trace_write / trace_decode).
+ *
+ *   TRACE(EVENT, a, b, c, d)        up to 4 numeric args (integers or doubles)
+ *   TRACE_S(EVENT, text, a, b, c)   a short string (first 15 chars) + up to 3
+ *
+ * Each ring has one producer (its thread) and one consumer, so it needs no
+ * locks: the producer publishes with a release store of head, the consumer
+ * frees slots with a release store of tail. When a ring is full new records
+ * are dropped and counted rather than blocking the traced code.
+ * Recording is off until trace_set_enabled(true) on that thread.
+ *
+ * Compile with: gcc -O2 -DTRACE_ENABLED file.c -lm
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+typedef struct {
+    const char* name;
+    const char* format;     // %d/%u/%x/%c take an integer, %f/%e/%g a double, %s the text
+} TraceEvent;
+
+typedef struct {
+    uint64_t timestamp;     // CLOCK_MONOTONIC nanoseconds
+    uint16_t event;
+    uint16_t thread;
+    uint8_t argc;
+    uint8_t double_mask;    // bit i set: args[i] holds a double
+    uint16_t reserved;
+    union { int64_t i; double d; } args[4];
+    char text[16];
+} TraceRecord;
+
+_Static_assert(sizeof(TraceRecord) == 64, "trace records are one cache line");
+
+#ifdef TRACE_ENABLED
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#define TRACE_RING_RECORDS 4096    // per thread, power of two (256 KB)
+
+typedef struct TraceRing {
+    _Alignas(64) _Atomic uint64_t head;     // next slot to write (producer)
+    _Alignas(64) _Atomic uint64_t tail;     // next slot to read (consumer)
+    _Atomic uint64_t dropped;
+    uint16_t thread;
+    struct TraceRing* next;                 // registry of all rings
+    TraceRecord records[TRACE_RING_RECORDS];
+} TraceRing;
+
+typedef struct {
+    union { int64_t i; double d; } value;
+    bool is_double;
+} TraceArg;
+
+static _Atomic(TraceRing*) trace_rings = NULL;
+static _Atomic uint16_t trace_next_thread = 0;
+static _Thread_local TraceRing* trace_ring = NULL;
+static _Thread_local bool trace_on = false;
+static const TraceEvent* trace_events = NULL;
+static int trace_event_count = 0;
+
+static inline TraceArg trace_arg_int(int64_t v) { TraceArg a; a.value.i = v; a.is_double = false; return a; }
+static inline TraceArg trace_arg_double(double v) { TraceArg a; a.value.d = v; a.is_double = true; return a; }
+#define TRACE_ARG(x) _Generic((x), float: trace_arg_double, double: trace_arg_double, default: trace_arg_int)(x)
+
+static inline TraceRing* trace_ring_create(void) {
+    TraceRing* ring = aligned_alloc(64, sizeof(TraceRing));
+    if (!ring) return NULL;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+    ring->thread = atomic_fetch_add(&trace_next_thread, 1);
+    // Push onto the registry (lock-free; rings are never removed)
+    ring->next = atomic_load(&trace_rings);
+    while (!atomic_compare_exchange_weak(&trace_rings, &ring->next, ring)) { }
+    trace_ring = ring;
+    return ring;
+}
+
+static inline void trace_emit(uint16_t event, const char* text, int argc,
+                              TraceArg a0, TraceArg a1, TraceArg a2, TraceArg a3) {
+    if (!trace_on) return;
+    TraceRing* ring = trace_ring ? trace_ring : trace_ring_create();
+    if (!ring) return;
+
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&ring->tail, memory_order_acquire) == TRACE_RING_RECORDS) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    TraceRecord* r = &ring->records[head & (TRACE_RING_RECORDS - 1)];
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    r->timestamp = (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+    r->event = event;
+    r->thread = ring->thread;
+    r->argc = (uint8_t)argc;
+    r->double_mask = (uint8_t)(a0.is_double | a1.is_double << 1 | a2.is_double << 2 | a3.is_double << 3);
+    r->reserved = 0;
+    r->args[0].i = a0.value.i;
+    r->args[1].i = a1.value.i;
+    r->args[2].i = a2.value.i;
+    r->args[3].i = a3.value.i;
+    if (text) {
+        strncpy(r->text, text, sizeof(r->text) - 1);
+        r->text[sizeof(r->text) - 1] = '\0';
+    } else {
+        r->text[0] = '\0';
+    }
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+// TRACE(EVENT, ...) picks TRACEn by the number of arguments after EVENT
+#define TRACE_PICK(_0, _1, _2, _3, _4, NAME, ...) NAME
+#define TRACE_Z trace_arg_int(0)
+#define TRACE_0(e) trace_emit((e), NULL, 0, TRACE_Z, TRACE_Z, TRACE_Z, TRACE_Z)
+#define TRACE_1(e, a) trace_emit((e), NULL, 1, TRACE_ARG(a), TRACE_Z, TRACE_Z, TRACE_Z)
+#define TRACE_2(e, a, b) trace_emit((e), NULL, 2, TRACE_ARG(a), TRACE_ARG(b), TRACE_Z, TRACE_Z)
+#define TRACE_3(e, a, b, c) trace_emit((e), NULL, 3, TRACE_ARG(a), TRACE_ARG(b), TRACE_ARG(c), TRACE_Z)
+#define TRACE_4(e, a, b, c, d) trace_emit((e), NULL, 4, TRACE_ARG(a), TRACE_ARG(b), TRACE_ARG(c), TRACE_ARG(d))
+#define TRACE(...) TRACE_PICK(__VA_ARGS__, TRACE_4, TRACE_3, TRACE_2, TRACE_1, TRACE_0, _)(__VA_ARGS__)
+
+#define TRACE_S0(e, s) trace_emit((e), (s), 0, TRACE_Z, TRACE_Z, TRACE_Z, TRACE_Z)
+#define TRACE_S1(e, s, a) trace_emit((e), (s), 1, TRACE_ARG(a), TRACE_Z, TRACE_Z, TRACE_Z)
+#define TRACE_S2(e, s, a, b) trace_emit((e), (s), 2, TRACE_ARG(a), TRACE_ARG(b), TRACE_Z, TRACE_Z)
+#define TRACE_S3(e, s, a, b, c) trace_emit((e), (s), 3, TRACE_ARG(a), TRACE_ARG(b), TRACE_ARG(c), TRACE_Z)
+#define TRACE_S(...) TRACE_PICK(__VA_ARGS__, TRACE_S3, TRACE_S2, TRACE_S1, TRACE_S0, _, _)(__VA_ARGS__)
+
+// Turn recording on or off for the calling thread
+static inline void trace_set_enabled(bool on) { trace_on = on; }
+
+// Event table used to decode records (index = event id)
+static inline void trace_register_events(const TraceEvent* events, int count) {
+    trace_events = events;
+    trace_event_count = count;
+}
+
+// Render one record with its event's format into buf
+static inline void trace_format(const TraceRecord* r, char* buf, size_t size) {
+    if (r->event >= trace_event_count) {
+        snprintf(buf, size, "<unknown event %u>", r->event);
+        return;
+    }
+    const char* f = trace_events[r->event].format;
+    size_t used = 0;
+    int arg = 0;
+    buf[0] = '\0';
+    while (*f && used + 1 < size) {
+        if (*f != '%') {
+            buf[used++] = *f++;
+            buf[used] = '\0';
+            continue;
+        }
+        if (f[1] == '%') {
+            buf[used++] = '%';
+            buf[used] = '\0';
+            f += 2;
+            continue;
+        }
+        // Copy one conversion spec, dropping any length modifier
+        char spec[16];
+        size_t n = 0;
+        spec[n++] = *f++;
+        while (*f && strchr("-+ #0123456789.", *f) && n < sizeof(spec) - 4) spec[n++] = *f++;
+        while (*f && strchr("hlLqjzt", *f)) f++;
+        char conv = *f ? *f++ : 'd';
+        int w;
+        if (conv == 's') {
+            spec[n++] = 's';
+            spec[n] = '\0';
+            w = snprintf(buf + used, size - used, spec, r->text);
+        } else if (strchr("feEgG", conv)) {
+            spec[n++] = conv;
+            spec[n] = '\0';
+            double v = 0.0;
+            if (arg < r->argc) v = (r->double_mask >> arg & 1) ? r->args[arg].d : (double)r->args[arg].i;
+            arg++;
+            w = snprintf(buf + used, size - used, spec, v);
+        } else {
+            spec[n++] = 'l';
+            spec[n++] = 'l';
+            spec[n++] = conv;
+            spec[n] = '\0';
+            long long v = 0;
+            if (arg < r->argc) v = (r->double_mask >> arg & 1) ? (long long)r->args[arg].d : (long long)r->args[arg].i;
+            arg++;
+            w = snprintf(buf + used, size - used, spec, v);
+        }
+        if (w > 0) used += (size_t)w < size - used ? (size_t)w : size - used - 1;
+    }
+}
+
+// Consumer side: copy up to max records out of a ring and free their slots
+static inline size_t trace_ring_drain(TraceRing* ring, TraceRecord* out, size_t max) {
+    uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    size_t count = 0;
+    while (tail != head && count < max) {
+        out[count++] = ring->records[tail & (TRACE_RING_RECORDS - 1)];
+        tail++;
+    }
+    atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    return count;
+}
+
+/**
+ * Decode and print everything the calling thread has recorded so far
+ * @return Number of records printed
+ */
+static inline size_t trace_print_thread(FILE* out, const char* indent) {
+    if (!trace_ring) return 0;
+    TraceRecord batch[64];
+    char line[256];
+    size_t total = 0, got;
+    while ((got = trace_ring_drain(trace_ring, batch, 64)) > 0) {
+        for (size_t i = 0; i < got; i++) {
+            trace_format(&batch[i], line, sizeof(line));
+            fprintf(out, "%s%s\n", indent, line);
+        }
+        total += got;
+    }
+    uint64_t dropped = atomic_exchange(&trace_ring->dropped, 0);
+    if (dropped) fprintf(out, "%s(%llu records dropped: ring full)\n", indent, (unsigned long long)dropped);
+    return total;
+}
+
+// Throw away whatever the calling thread has recorded
+static inline void trace_discard_thread(void) {
+    if (trace_ring) {
+        atomic_store(&trace_ring->tail, atomic_load(&trace_ring->head));
+        atomic_store(&trace_ring->dropped, 0);
+    }
+}
+
+/**
+ * Dump the records of every thread to a binary file for offline decoding.
+ * Layout: "TRC1", record size (uint32), then raw TraceRecords.
+ * @return Number of records written
+ */
+static inline size_t trace_write(FILE* file) {
+    uint32_t record_size = sizeof(TraceRecord);
+    fwrite("TRC1", 1, 4, file);
+    fwrite(&record_size, sizeof(record_size), 1, file);
+    TraceRecord batch[64];
+    size_t total = 0, got;
+    for (TraceRing* ring = atomic_load(&trace_rings); ring; ring = ring->next) {
+        while ((got = trace_ring_drain(ring, batch, 64)) > 0) {
+            fwrite(batch, sizeof(TraceRecord), got, file);
+            total += got;
+        }
+    }
+    return total;
+}
+
+/**
+ * Decode a dump written by trace_write, one line per record:
+ * "<seconds since first record> [thread] event: text"
+ * @return Number of records decoded, or -1 if the file is not a trace dump
+ */
+static inline long trace_decode(FILE* in, FILE* out) {
+    char magic[4];
+    uint32_t record_size;
+    if (fread(magic, 1, 4, in) != 4 || memcmp(magic, "TRC1", 4) != 0 ||
+        fread(&record_size, sizeof(record_size), 1, in) != 1 || record_size != sizeof(TraceRecord)) {
+        return -1;
+    }
+    TraceRecord r;
+    char line[256];
+    long count = 0;
+    uint64_t first = 0;
+    while (fread(&r, sizeof(r), 1, in) == 1) {
+        if (count++ == 0) first = r.timestamp;
+        trace_format(&r, line, sizeof(line));
+        fprintf(out, "%12.6f [%u] %s: %s\n", (r.timestamp - first) / 1e9, r.thread,
+                r.event < trace_event_count ? trace_events[r.event].name : "?", line);
+    }
+    return count;
+}
+
+// atexit hook: dump whatever is still buffered to $TRACE_FILE
+static inline void trace_dump_at_exit(void) {
+    const char* path = getenv("TRACE_FILE");
+    FILE* file = path ? fopen(path, "wb") : NULL;
+    if (file) {
+        size_t written = trace_write(file);
+        fclose(file);
+        fprintf(stderr, "trace: %zu records written to %s\n", written, path);
+    }
+}
+
+/**
+ * Command-line hooks for trace builds:
+ *   program --decode FILE    decode a dump and exit
+ *   TRACE_FILE=path program  dump all records to path when main returns
+ * Register the event table first so --decode can render the records.
+ * @return true if the program should exit right away
+ */
+static inline bool trace_handle_args(int argc, char* argv[]) {
+    if (argc > 2 && strcmp(argv[1], "--decode") == 0) {
+        FILE* file = fopen(argv[2], "rb");
+        long count = file ? trace_decode(file, stdout) : -1;
+        if (file) fclose(file);
+        if (count < 0) fprintf(stderr, "trace: %s is not a trace dump\n", argv[2]);
+        return true;
+    }
+    if (getenv("TRACE_FILE")) atexit(trace_dump_at_exit);
+    return false;
+}
+
+#else  // tracing compiled out
+
+#define TRACE(...) ((void)0)
+#define TRACE_S(...) ((void)0)
+
+static inline void trace_set_enabled(bool on) { (void)on; }
+static inline void trace_register_events(const TraceEvent* events, int count) { (void)events; (void)count; }
+static inline void trace_discard_thread(void) { }
+
+static inline size_t trace_print_thread(FILE* out, const char* indent) {
+    fprintf(out, "%s(tracing compiled out - build with -DTRACE_ENABLED)\n", indent);
+    return 0;
+}
+
+static inline bool trace_handle_args(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+    return false;
+}
+
+#endif  // TRACE_ENABLED
+
+#endif  // TRACE_H
@@ -1,8 +1,13 @@
-C IMPLEMENTATION
+// C IMPLEMENTATION
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
 
-#define MAX_SIZE 100
+#define INITIAL_CAPACITY 100   // queues and stacks grow beyond this on demand
 
 // TreeNode structure for binary tree
 typedef struct TreeNode {
@@ -53,11 +58,22 @@ Queue* createQueue(int capacity) {
 
 /**
  * Add node to queue (enqueue operation)
+ * Grows the queue when full, so wide trees are never truncated
  */
 void enqueue(Queue* queue, TreeNode* item) {
-    if (queue->rear < queue->capacity) {
-        queue->items[queue->rear++] = item;
+    if (queue->rear == queue->capacity) {
+        if (queue->front > 0) {
+            // Reuse the space of already dequeued items
+            memmove(queue->items, queue->items + queue->front,
+                    sizeof(TreeNode*) * (queue->rear - queue->front));
+            queue->rear -= queue->front;
+            queue->front = 0;
+        } else {
+            queue->capacity *= 2;
+            queue->items = (TreeNode**)realloc(queue->items, sizeof(TreeNode*) * queue->capacity);
+        }
     }
+    queue->items[queue->rear++] = item;
 }
 
 /**
@@ -97,11 +113,14 @@ Stack* createStack(int capacity) {
 
 /**
  * Push node to stack
+ * Doubles the capacity when full, so deep trees are never truncated
  */
 void push(Stack* stack, TreeNode* item) {
-    if (stack->top < stack->capacity - 1) {
-        stack->items[++stack->top] = item;
+    if (stack->top == stack->capacity - 1) {
+        stack->capacity *= 2;
+        stack->items = (TreeNode**)realloc(stack->items, sizeof(TreeNode*) * stack->capacity);
     }
+    stack->items[++stack->top] = item;
 }
 
 /**
@@ -184,7 +203,7 @@ void levelOrder(TreeNode* root) {
     if (root == NULL) return;
     
     // Create queue for BFS traversal
-    Queue* queue = createQueue(MAX_SIZE);
+    Queue* queue = createQueue(INITIAL_CAPACITY);
     enqueue(queue, root);  // Start with root node
     
     printf("Level Order: ");
@@ -212,7 +231,7 @@ void levelOrder(TreeNode* root) {
 void levelOrderWithLevels(TreeNode* root) {
     if (root == NULL) return;
     
-    Queue* queue = createQueue(MAX_SIZE);
+    Queue* queue = createQueue(INITIAL_CAPACITY);
     enqueue(queue, root);
     int level = 0;
     
@@ -246,7 +265,7 @@ void levelOrderWithLevels(TreeNode* root) {
 void iterativePreOrder(TreeNode* root) {
     if (root == NULL) return;
     
-    Stack* stack = createStack(MAX_SIZE);
+    Stack* stack = createStack(INITIAL_CAPACITY);
     push(stack, root);  // Start with root
     
     printf("Iterative Pre-Order: ");
@@ -272,7 +291,7 @@ void iterativePreOrder(TreeNode* root) {
 void iterativeInOrder(TreeNode* root) {
     if (root == NULL) return;
     
-    Stack* stack = createStack(MAX_SIZE);
+    Stack* stack = createStack(INITIAL_CAPACITY);
     TreeNode* current = root;
     
     printf("Iterative In-Order: ");
@@ -297,9 +316,704 @@ void iterativeInOrder(TreeNode* root) {
     free(stack);
 }
 
+// ==================== ARENA TREE ====================
+
+#define NIL_INDEX UINT32_MAX
+
+/**
+ * Arena node: children are 32-bit indices into one node array instead of
+ * pointers, so a node is 12 bytes instead of 24 and the tree is one block
+ */
+typedef struct ArenaNode {
+    int data;
+    uint32_t left;
+    uint32_t right;
+} ArenaNode;
+
+typedef struct TreeArena {
+    ArenaNode* nodes;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t root;
+} TreeArena;
+
+typedef enum {
+    LAYOUT_PREORDER,   // depth-first order, as produced by node-by-node allocation
+    LAYOUT_BFS,        // level by level
+    LAYOUT_VEB         // van Emde Boas: recursively split into top and bottom halves
+} TreeLayout;
+
+/**
+ * Callback invoked once per visited node
+ */
+typedef void (*NodeVisitor)(int data, void* context);
+
+/**
+ * Growable array of node indices, used as a stack (push/popBack)
+ * or as a queue (push/popFront)
+ */
+typedef struct IndexBuffer {
+    uint32_t* items;
+    size_t front;
+    size_t rear;
+    size_t capacity;
+} IndexBuffer;
+
+static void indexBufferInit(IndexBuffer* b, size_t capacity) {
+    b->items = (uint32_t*)malloc(sizeof(uint32_t) * capacity);
+    if (!b->items) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    b->front = b->rear = 0;
+    b->capacity = capacity;
+}
+
+static void indexBufferPush(IndexBuffer* b, uint32_t value) {
+    if (b->rear == b->capacity) {
+        if (b->front > 0) {
+            // Reuse the space of already dequeued items
+            memmove(b->items, b->items + b->front, sizeof(uint32_t) * (b->rear - b->front));
+            b->rear -= b->front;
+            b->front = 0;
+        } else {
+            b->capacity *= 2;
+            b->items = (uint32_t*)realloc(b->items, sizeof(uint32_t) * b->capacity);
+            if (!b->items) {
+                printf("Memory allocation failed!\n");
+                exit(1);
+            }
+        }
+    }
+    b->items[b->rear++] = value;
+}
+
+static uint32_t indexBufferPopBack(IndexBuffer* b) {
+    return b->items[--b->rear];
+}
+
+static uint32_t indexBufferPopFront(IndexBuffer* b) {
+    return b->items[b->front++];
+}
+
+static size_t indexBufferSize(const IndexBuffer* b) {
+    return b->rear - b->front;
+}
+
+/**
+ * Create an empty arena with room for `capacity` nodes
+ */
+TreeArena* createArena(uint32_t capacity) {
+    TreeArena* arena = (TreeArena*)malloc(sizeof(TreeArena));
+    if (!arena) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    if (capacity == 0) capacity = 1;
+    arena->nodes = (ArenaNode*)malloc(sizeof(ArenaNode) * capacity);
+    if (!arena->nodes) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    arena->count = 0;
+    arena->capacity = capacity;
+    arena->root = NIL_INDEX;
+    return arena;
+}
+
+/**
+ * Append a childless node and return its index
+ */
+uint32_t arenaAddNode(TreeArena* arena, int data) {
+    if (arena->count == arena->capacity) {
+        arena->capacity *= 2;
+        arena->nodes = (ArenaNode*)realloc(arena->nodes, sizeof(ArenaNode) * arena->capacity);
+        if (!arena->nodes) {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+    }
+    arena->nodes[arena->count].data = data;
+    arena->nodes[arena->count].left = NIL_INDEX;
+    arena->nodes[arena->count].right = NIL_INDEX;
+    return arena->count++;
+}
+
+void freeArena(TreeArena* arena) {
+    if (arena) {
+        free(arena->nodes);
+        free(arena);
+    }
+}
+
+/**
+ * Copy a pointer-based tree into an arena in level order
+ */
+TreeArena* arenaFromTree(TreeNode* root) {
+    TreeArena* arena = createArena(INITIAL_CAPACITY);
+    if (root == NULL) return arena;
+
+    // BFS: a node's children get the next indices as they are enqueued
+    Queue* queue = createQueue(INITIAL_CAPACITY);
+    enqueue(queue, root);
+    arena->root = arenaAddNode(arena, root->data);
+    uint32_t index = 0;
+    while (!isQueueEmpty(queue)) {
+        TreeNode* current = dequeue(queue);
+        if (current->left != NULL) {
+            uint32_t child = arenaAddNode(arena, current->left->data);
+            arena->nodes[index].left = child;
+            enqueue(queue, current->left);
+        }
+        if (current->right != NULL) {
+            uint32_t child = arenaAddNode(arena, current->right->data);
+            arena->nodes[index].right = child;
+            enqueue(queue, current->right);
+        }
+        index++;
+    }
+    free(queue->items);
+    free(queue);
+    return arena;
+}
+
+/**
+ * Build a random tree of n nodes whose in-order sequence is 0, 1, ..., n-1.
+ * Subtree sizes are split uniformly at random (the shape of a random BST).
+ * Nodes are allocated in pre-order, as a node-by-node builder would.
+ */
+TreeArena* buildRandomArena(uint32_t n, uint64_t seed) {
+    typedef struct { uint32_t parent; uint32_t base; uint32_t size; int isRight; } Task;
+    TreeArena* arena = createArena(n);
+    if (n == 0) return arena;
+
+    size_t taskCapacity = 1024, taskCount = 0;
+    Task* tasks = (Task*)malloc(sizeof(Task) * taskCapacity);
+    tasks[taskCount++] = (Task){ NIL_INDEX, 0, n, 0 };
+    uint64_t state = seed | 1;
+
+    while (taskCount > 0) {
+        Task t = tasks[--taskCount];
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        uint32_t leftSize = (uint32_t)(((state * 0x2545F4914F6CDD1DULL) >> 32) % t.size);
+
+        uint32_t node = arenaAddNode(arena, (int)(t.base + leftSize));
+        if (t.parent == NIL_INDEX) arena->root = node;
+        else if (t.isRight) arena->nodes[t.parent].right = node;
+        else arena->nodes[t.parent].left = node;
+
+        if (taskCount + 2 > taskCapacity) {
+            taskCapacity *= 2;
+            tasks = (Task*)realloc(tasks, sizeof(Task) * taskCapacity);
+        }
+        // Push right first so the left subtree is allocated next (pre-order)
+        uint32_t rightSize = t.size - leftSize - 1;
+        if (rightSize > 0) tasks[taskCount++] = (Task){ node, t.base + leftSize + 1, rightSize, 1 };
+        if (leftSize > 0) tasks[taskCount++] = (Task){ node, t.base, leftSize, 0 };
+    }
+    free(tasks);
+    return arena;
+}
+
+/**
+ * Number of levels in the tree
+ */
+uint32_t arenaHeight(const TreeArena* arena) {
+    if (arena->root == NIL_INDEX) return 0;
+    IndexBuffer queue;
+    indexBufferInit(&queue, INITIAL_CAPACITY);
+    indexBufferPush(&queue, arena->root);
+    uint32_t height = 0;
+    while (indexBufferSize(&queue) > 0) {
+        size_t levelSize = indexBufferSize(&queue);
+        for (size_t i = 0; i < levelSize; i++) {
+            const ArenaNode* node = &arena->nodes[indexBufferPopFront(&queue)];
+            if (node->left != NIL_INDEX) indexBufferPush(&queue, node->left);
+            if (node->right != NIL_INDEX) indexBufferPush(&queue, node->right);
+        }
+        height++;
+    }
+    free(queue.items);
+    return height;
+}
+
+typedef struct VebContext {
+    const ArenaNode* nodes;
+    uint32_t* newIndex;
+    uint32_t next;
+    IndexBuffer boundary;   // bottom-subtree roots, shared by nested calls
+    IndexBuffer dfsNodes;
+    IndexBuffer dfsDepths;
+} VebContext;
+
+/**
+ * Number the subtree of `root` (cut off below `height` levels) in
+ * van Emde Boas order: top half first, then each bottom subtree
+ */
+static void vebLayout(VebContext* ctx, uint32_t root, uint32_t height) {
+    if (height == 1) {
+        ctx->newIndex[root] = ctx->next++;
+        return;
+    }
+    uint32_t topHeight = height / 2;
+    vebLayout(ctx, root, topHeight);
+
+    // Collect the roots of the bottom subtrees, left to right
+    size_t base = ctx->boundary.rear;
+    indexBufferPush(&ctx->dfsNodes, root);
+    indexBufferPush(&ctx->dfsDepths, 0);
+    while (ctx->dfsNodes.rear > 0) {
+        uint32_t node = indexBufferPopBack(&ctx->dfsNodes);
+        uint32_t depth = indexBufferPopBack(&ctx->dfsDepths);
+        if (depth == topHeight) {
+            indexBufferPush(&ctx->boundary, node);
+            continue;
+        }
+        const ArenaNode* n = &ctx->nodes[node];
+        if (n->right != NIL_INDEX) {
+            indexBufferPush(&ctx->dfsNodes, n->right);
+            indexBufferPush(&ctx->dfsDepths, depth + 1);
+        }
+        if (n->left != NIL_INDEX) {
+            indexBufferPush(&ctx->dfsNodes, n->left);
+            indexBufferPush(&ctx->dfsDepths, depth + 1);
+        }
+    }
+    size_t end = ctx->boundary.rear;
+    for (size_t i = base; i < end; i++) {
+        vebLayout(ctx, ctx->boundary.items[i], height - topHeight);
+    }
+    ctx->boundary.rear = base;
+}
+
+/**
+ * Return a copy of the tree with nodes stored in the given layout.
+ * The input arena is left unchanged.
+ */
+TreeArena* relayoutArena(const TreeArena* arena, TreeLayout layout) {
+    TreeArena* result = createArena(arena->count);
+    if (arena->root == NIL_INDEX) return result;
+
+    uint32_t* newIndex = (uint32_t*)malloc(sizeof(uint32_t) * arena->count);
+    if (!newIndex) {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    uint32_t next = 0;
+    IndexBuffer work;
+    indexBufferInit(&work, INITIAL_CAPACITY);
+
+    if (layout == LAYOUT_PREORDER) {
+        indexBufferPush(&work, arena->root);
+        while (work.rear > 0) {
+            uint32_t i = indexBufferPopBack(&work);
+            newIndex[i] = next++;
+            if (arena->nodes[i].right != NIL_INDEX) indexBufferPush(&work, arena->nodes[i].right);
+            if (arena->nodes[i].left != NIL_INDEX) indexBufferPush(&work, arena->nodes[i].left);
+        }
+    } else if (layout == LAYOUT_BFS) {
+        indexBufferPush(&work, arena->root);
+        while (indexBufferSize(&work) > 0) {
+            uint32_t i = indexBufferPopFront(&work);
+            newIndex[i] = next++;
+            if (arena->nodes[i].left != NIL_INDEX) indexBufferPush(&work, arena->nodes[i].left);
+            if (arena->nodes[i].right != NIL_INDEX) indexBufferPush(&work, arena->nodes[i].right);
+        }
+    } else {
+        VebContext ctx = { arena->nodes, newIndex, 0, { 0 }, { 0 }, { 0 } };
+        indexBufferInit(&ctx.boundary, INITIAL_CAPACITY);
+        indexBufferInit(&ctx.dfsNodes, INITIAL_CAPACITY);
+        indexBufferInit(&ctx.dfsDepths, INITIAL_CAPACITY);
+        vebLayout(&ctx, arena->root, arenaHeight(arena));
+        next = ctx.next;
+        free(ctx.boundary.items);
+        free(ctx.dfsNodes.items);
+        free(ctx.dfsDepths.items);
+    }
+    free(work.items);
+
+    for (uint32_t i = 0; i < arena->count; i++) {
+        const ArenaNode* src = &arena->nodes[i];
+        ArenaNode* dst = &result->nodes[newIndex[i]];
+        dst->data = src->data;
+        dst->left = src->left == NIL_INDEX ? NIL_INDEX : newIndex[src->left];
+        dst->right = src->right == NIL_INDEX ? NIL_INDEX : newIndex[src->right];
+    }
+    result->count = next;
+    result->root = newIndex[arena->root];
+    free(newIndex);
+    return result;
+}
+
+// ==================== ARENA TRAVERSALS ====================
+
+/**
+ * ITERATIVE PRE-ORDER on the arena (growable stack, no recursion)
+ */
+void arenaPreOrder(const TreeArena* arena, NodeVisitor visit, void* context) {
+    if (arena->root == NIL_INDEX) return;
+    IndexBuffer stack;
+    indexBufferInit(&stack, INITIAL_CAPACITY);
+    indexBufferPush(&stack, arena->root);
+    while (stack.rear > 0) {
+        const ArenaNode* node = &arena->nodes[indexBufferPopBack(&stack)];
+        visit(node->data, context);
+        // Push right child first (so left is processed first - LIFO)
+        if (node->right != NIL_INDEX) indexBufferPush(&stack, node->right);
+        if (node->left != NIL_INDEX) indexBufferPush(&stack, node->left);
+    }
+    free(stack.items);
+}
+
+/**
+ * ITERATIVE IN-ORDER on the arena
+ */
+void arenaInOrder(const TreeArena* arena, NodeVisitor visit, void* context) {
+    IndexBuffer stack;
+    indexBufferInit(&stack, INITIAL_CAPACITY);
+    uint32_t current = arena->root;
+    while (current != NIL_INDEX || stack.rear > 0) {
+        // Reach the leftmost node of current node
+        while (current != NIL_INDEX) {
+            indexBufferPush(&stack, current);
+            current = arena->nodes[current].left;
+        }
+        current = indexBufferPopBack(&stack);
+        visit(arena->nodes[current].data, context);
+        current = arena->nodes[current].right;
+    }
+    free(stack.items);
+}
+
+/**
+ * ITERATIVE POST-ORDER on the arena (one stack plus the last visited node)
+ */
+void arenaPostOrder(const TreeArena* arena, NodeVisitor visit, void* context) {
+    IndexBuffer stack;
+    indexBufferInit(&stack, INITIAL_CAPACITY);
+    uint32_t current = arena->root;
+    uint32_t lastVisited = NIL_INDEX;
+    while (current != NIL_INDEX || stack.rear > 0) {
+        while (current != NIL_INDEX) {
+            indexBufferPush(&stack, current);
+            current = arena->nodes[current].left;
+        }
+        uint32_t top = stack.items[stack.rear - 1];
+        uint32_t right = arena->nodes[top].right;
+        if (right != NIL_INDEX && right != lastVisited) {
+            current = right;        // Right subtree not done yet
+        } else {
+            visit(arena->nodes[top].data, context);
+            lastVisited = indexBufferPopBack(&stack);
+        }
+    }
+    free(stack.items);
+}
+
+/**
+ * LEVEL-ORDER on the arena (growable queue)
+ */
+void arenaLevelOrder(const TreeArena* arena, NodeVisitor visit, void* context) {
+    if (arena->root == NIL_INDEX) return;
+    IndexBuffer queue;
+    indexBufferInit(&queue, INITIAL_CAPACITY);
+    indexBufferPush(&queue, arena->root);
+    while (indexBufferSize(&queue) > 0) {
+        const ArenaNode* node = &arena->nodes[indexBufferPopFront(&queue)];
+        visit(node->data, context);
+        if (node->left != NIL_INDEX) indexBufferPush(&queue, node->left);
+        if (node->right != NIL_INDEX) indexBufferPush(&queue, node->right);
+    }
+    free(queue.items);
+}
+
+/**
+ * MORRIS IN-ORDER TRAVERSAL - O(1) extra space
+ * Temporarily threads each in-order predecessor's right link back to its
+ * successor, and removes the thread on the second visit. The tree is
+ * unchanged when the traversal returns.
+ */
+void arenaMorrisInOrder(TreeArena* arena, NodeVisitor visit, void* context) {
+    ArenaNode* nodes = arena->nodes;
+    uint32_t current = arena->root;
+    while (current != NIL_INDEX) {
+        if (nodes[current].left == NIL_INDEX) {
+            visit(nodes[current].data, context);
+            current = nodes[current].right;
+            continue;
+        }
+        // Find the in-order predecessor (rightmost node of the left subtree)
+        uint32_t pred = nodes[current].left;
+        while (nodes[pred].right != NIL_INDEX && nodes[pred].right != current) {
+            pred = nodes[pred].right;
+        }
+        if (nodes[pred].right == NIL_INDEX) {
+            nodes[pred].right = current;       // Create thread, descend left
+            current = nodes[current].left;
+        } else {
+            nodes[pred].right = NIL_INDEX;     // Left subtree done: remove thread
+            visit(nodes[current].data, context);
+            current = nodes[current].right;
+        }
+    }
+}
+
+/**
+ * MORRIS PRE-ORDER TRAVERSAL - O(1) extra space
+ * Same threading as in-order, but a node is visited when its thread is created
+ */
+void arenaMorrisPreOrder(TreeArena* arena, NodeVisitor visit, void* context) {
+    ArenaNode* nodes = arena->nodes;
+    uint32_t current = arena->root;
+    while (current != NIL_INDEX) {
+        if (nodes[current].left == NIL_INDEX) {
+            visit(nodes[current].data, context);
+            current = nodes[current].right;
+            continue;
+        }
+        uint32_t pred = nodes[current].left;
+        while (nodes[pred].right != NIL_INDEX && nodes[pred].right != current) {
+            pred = nodes[pred].right;
+        }
+        if (nodes[pred].right == NIL_INDEX) {
+            visit(nodes[current].data, context);
+            nodes[pred].right = current;
+            current = nodes[current].left;
+        } else {
+            nodes[pred].right = NIL_INDEX;
+            current = nodes[current].right;
+        }
+    }
+}
+
+// ==================== PARALLEL LEVEL-ORDER ====================
+
+typedef struct ParallelLevelState {
+    const TreeArena* arena;
+    uint32_t* frontier;      // current level, left to right
+    size_t frontierSize;
+    uint32_t* next;          // next level, assembled from the workers' buffers
+    size_t capacity;         // of frontier and next
+    int threadCount;
+    pthread_barrier_t barrier;
+} ParallelLevelState;
+
+typedef struct LevelWorker {
+    ParallelLevelState* state;
+    int id;
+    NodeVisitor visit;
+    void* context;
+    IndexBuffer children;    // children found by this worker on this level
+    size_t offset;           // where they go in the next level
+} LevelWorker;
+
+static void* levelWorkerRun(void* arg) {
+    LevelWorker* w = (LevelWorker*)arg;
+    ParallelLevelState* s = w->state;
+    const ArenaNode* nodes = s->arena->nodes;
+    LevelWorker* workers = w - w->id;
+
+    while (s->frontierSize > 0) {
+        // 1. Visit an equal slice of the level and collect its children
+        size_t chunk = (s->frontierSize + s->threadCount - 1) / s->threadCount;
+        size_t begin = chunk * w->id;
+        size_t end = begin + chunk < s->frontierSize ? begin + chunk : s->frontierSize;
+        w->children.rear = 0;
+        for (size_t i = begin; i < end; i++) {
+            const ArenaNode* node = &nodes[s->frontier[i]];
+            w->visit(node->data, w->context);
+            if (node->left != NIL_INDEX) indexBufferPush(&w->children, node->left);
+            if (node->right != NIL_INDEX) indexBufferPush(&w->children, node->right);
+        }
+        pthread_barrier_wait(&s->barrier);
+
+        // 2. One thread computes where each slice's children land
+        if (w->id == 0) {
+            size_t total = 0;
+            for (int t = 0; t < s->threadCount; t++) {
+                workers[t].offset = total;
+                total += workers[t].children.rear;
+            }
+            if (total > s->capacity) {
+                // Every worker has finished reading the frontier, so both can grow
+                s->capacity = total;
+                s->next = (uint32_t*)realloc(s->next, sizeof(uint32_t) * total);
+                s->frontier = (uint32_t*)realloc(s->frontier, sizeof(uint32_t) * total);
+                if (!s->next || !s->frontier) {
+                    printf("Memory allocation failed!\n");
+                    exit(1);
+                }
+            }
+        }
+        pthread_barrier_wait(&s->barrier);
+
+        // 3. Copy children into the next level, preserving left-to-right order
+        memcpy(s->next + w->offset, w->children.items, sizeof(uint32_t) * w->children.rear);
+        pthread_barrier_wait(&s->barrier);
+
+        if (w->id == 0) {
+            size_t total = workers[s->threadCount - 1].offset + workers[s->threadCount - 1].children.rear;
+            uint32_t* swap = s->frontier;
+            s->frontier = s->next;
+            s->next = swap;
+            s->frontierSize = total;
+        }
+        pthread_barrier_wait(&s->barrier);
+    }
+    return NULL;
+}
+
+/**
+ * PARALLEL LEVEL-ORDER TRAVERSAL
+ * Each level is split evenly across threads; levels are processed in order,
+ * but nodes within a level are visited concurrently. Thread t calls `visit`
+ * with contexts[t], so visitors need no locking.
+ */
+void arenaParallelLevelOrder(const TreeArena* arena, int threadCount,
+                             NodeVisitor visit, void** contexts) {
+    if (arena->root == NIL_INDEX) return;
+    if (threadCount < 1) threadCount = 1;
+
+    ParallelLevelState state;
+    state.arena = arena;
+    state.capacity = INITIAL_CAPACITY;
+    state.frontier = (uint32_t*)malloc(sizeof(uint32_t) * state.capacity);
+    state.next = (uint32_t*)malloc(sizeof(uint32_t) * state.capacity);
+    state.frontier[0] = arena->root;
+    state.frontierSize = 1;
+    state.threadCount = threadCount;
+    pthread_barrier_init(&state.barrier, NULL, threadCount);
+
+    LevelWorker* workers = (LevelWorker*)malloc(sizeof(LevelWorker) * threadCount);
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t) * threadCount);
+    for (int t = 0; t < threadCount; t++) {
+        workers[t].state = &state;
+        workers[t].id = t;
+        workers[t].visit = visit;
+        workers[t].context = contexts[t];
+        indexBufferInit(&workers[t].children, INITIAL_CAPACITY);
+    }
+    for (int t = 1; t < threadCount; t++) {
+        pthread_create(&threads[t], NULL, levelWorkerRun, &workers[t]);
+    }
+    levelWorkerRun(&workers[0]);
+    for (int t = 1; t < threadCount; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    for (int t = 0; t < threadCount; t++) {
+        free(workers[t].children.items);
+    }
+    pthread_barrier_destroy(&state.barrier);
+    free(workers);
+    free(threads);
+    free(state.frontier);
+    free(state.next);
+}
+
+// ==================== VISITORS AND BENCHMARK ====================
+
+/**
+ * Visitor that prints each value, matching the pointer-tree functions
+ */
+void printVisitor(int data, void* context) {
+    (void)context;
+    printf("%d ", data);
+}
+
+/**
+ * Visitor that checks a traversal without printing: counts nodes, sums the
+ * values, hashes the visit order and checks whether values arrive sorted
+ */
+typedef struct TraversalCheck {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t orderHash;
+    long long last;
+    int sorted;
+} TraversalCheck;
+
+void checkVisitor(int data, void* context) {
+    TraversalCheck* c = (TraversalCheck*)context;
+    c->count++;
+    c->sum += (uint64_t)data;
+    c->orderHash = c->orderHash * 1099511628211ULL + (uint64_t)data;
+    if (data < c->last) c->sorted = 0;
+    c->last = data;
+}
+
+static void resetCheck(TraversalCheck* c) {
+    c->count = c->sum = c->orderHash = 0;
+    c->last = -1;
+    c->sorted = 1;
+}
+
+static double elapsedSince(struct timespec start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) * 1e-9;
+}
+
+/**
+ * Time every arena traversal on one layout. Morris traversals must produce
+ * the same visit order as their stack-based counterparts.
+ */
+void benchmarkTraversals(TreeArena* arena, const char* layoutName, int threadCount) {
+    TraversalCheck check, reference;
+    resetCheck(&reference);
+    struct timespec start;
+    printf("%s layout:\n", layoutName);
+
+    const char* names[] = { "pre-order (stack)", "in-order (stack)", "post-order (stack)",
+                            "level-order (queue)", "Morris pre-order", "Morris in-order" };
+    uint64_t hashes[6];
+
+    for (int i = 0; i < 6; i++) {
+        resetCheck(&check);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        switch (i) {
+            case 0: arenaPreOrder(arena, checkVisitor, &check); break;
+            case 1: arenaInOrder(arena, checkVisitor, &check); break;
+            case 2: arenaPostOrder(arena, checkVisitor, &check); break;
+            case 3: arenaLevelOrder(arena, checkVisitor, &check); break;
+            case 4: arenaMorrisPreOrder(arena, checkVisitor, &check); break;
+            default: arenaMorrisInOrder(arena, checkVisitor, &check); break;
+        }
+        double seconds = elapsedSince(start);
+        hashes[i] = check.orderHash;
+        printf("  %-20s %8.1f ms  %6.1f M nodes/s  nodes=%llu%s\n", names[i], seconds * 1e3,
+               check.count / seconds / 1e6, (unsigned long long)check.count,
+               i == 1 || i == 5 ? (check.sorted ? "  sorted" : "  NOT SORTED") : "");
+        if (i == 0) reference = check;
+    }
+    printf("  Morris pre-order matches stack pre-order: %s\n", hashes[4] == hashes[0] ? "yes" : "NO");
+    printf("  Morris in-order matches stack in-order:   %s\n", hashes[5] == hashes[1] ? "yes" : "NO");
+
+    TraversalCheck* perThread = (TraversalCheck*)malloc(sizeof(TraversalCheck) * threadCount);
+    void** contexts = (void**)malloc(sizeof(void*) * threadCount);
+    for (int t = 0; t < threadCount; t++) {
+        resetCheck(&perThread[t]);
+        contexts[t] = &perThread[t];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    arenaParallelLevelOrder(arena, threadCount, checkVisitor, contexts);
+    double seconds = elapsedSince(start);
+    uint64_t count = 0, sum = 0;
+    for (int t = 0; t < threadCount; t++) {
+        count += perThread[t].count;
+        sum += perThread[t].sum;
+    }
+    printf("  %-20s %8.1f ms  %6.1f M nodes/s  (%d threads, sum %s)\n", "parallel level-order",
+           seconds * 1e3, count / seconds / 1e6, threadCount, sum == reference.sum ? "ok" : "MISMATCH");
+    free(perThread);
+    free(contexts);
+}
+
 // ==================== MAIN FUNCTION ====================
 
-int main() {
+int main(int argc, char* argv[]) {
     // Create the same sample binary tree as Java version:
     //       1
     //      / \
@@ -353,8 +1067,54 @@ int main() {
     iterativePreOrder(root);
     iterativeInOrder(root);
     
+    // Same tree in an arena, traversed through the visitor API
+    printf("\n=== ARENA TREE (VISITOR API) ===\n");
+    TreeArena* small = arenaFromTree(root);
+    printf("Pre-Order:        ");
+    arenaPreOrder(small, printVisitor, NULL);
+    printf("\nIn-Order:         ");
+    arenaInOrder(small, printVisitor, NULL);
+    printf("\nPost-Order:       ");
+    arenaPostOrder(small, printVisitor, NULL);
+    printf("\nLevel Order:      ");
+    arenaLevelOrder(small, printVisitor, NULL);
+    printf("\nMorris Pre-Order: ");
+    arenaMorrisPreOrder(small, printVisitor, NULL);
+    printf("\nMorris In-Order:  ");
+    arenaMorrisInOrder(small, printVisitor, NULL);
+    printf("\n");
+    freeArena(small);
+
     // Free allocated memory
     freeTree(root);
+
+    // Benchmark: random tree, default 10^8 nodes (pass a smaller count as argv[1])
+    uint32_t n = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 100000000u;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int threadCount = cores > 0 ? (int)cores : 1;
+    printf("\n=== BENCHMARK: %u-node random tree ===\n", n);
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    TreeArena* arena = buildRandomArena(n, 12345);
+    printf("Built in %.1f ms (%u levels, %.0f MB)\n", elapsedSince(start) * 1e3,
+           arenaHeight(arena), sizeof(ArenaNode) * (double)n / 1e6);
+    benchmarkTraversals(arena, "Pre-order (allocation order)", threadCount);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    TreeArena* relaid = relayoutArena(arena, LAYOUT_BFS);
+    freeArena(arena);
+    arena = relaid;
+    printf("\nRelaid out in %.1f ms\n", elapsedSince(start) * 1e3);
+    benchmarkTraversals(arena, "BFS", threadCount);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    relaid = relayoutArena(arena, LAYOUT_VEB);
+    freeArena(arena);
+    arena = relaid;
+    printf("\nRelaid out in %.1f ms\n", elapsedSince(start) * 1e3);
+    benchmarkTraversals(arena, "van Emde Boas", threadCount);
+    freeArena(arena);
     
     return 0;
 }